@@ -1,23 +0,0 @@
-/////////////////////////////////////////////////
-/// @file
-/// @brief Implementation of the CGrimoireMachina component
-/////////////////////////////////////////////////
-
-#include "CGrimoireMachina.h"
-#include "containers.h"
-#include <SFML/Graphics/Color.hpp>
-#include <SFML/Graphics/PrimitiveType.hpp>
-#include <SFML/System/Vector2.hpp>
-
-namespace steamrot {
-
-/////////////////////////////////////////////////
-size_t CGrimoireMachina::GetComponentRegisterIndex() const {
-
-  // Get the index of this component in the component register
-  static constexpr size_t index =
-      TupleTypeIndex<CGrimoireMachina, ComponentRegister>;
-  return index;
-}
-
-} // namespace steamrot
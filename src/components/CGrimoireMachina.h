@@ -13,7 +13,6 @@
 namespace steamrot {
 
 struct CGrimoireMachina : public Component {
-  CGrimoireMachina() = default;
 
   /////////////////////////////////////////////////
   /// @brief All available fragments in the game.
@@ -35,12 +34,5 @@ struct CGrimoireMachina : public Component {
   /// @brief A holding form used to build up a new structure
   /////////////////////////////////////////////////
   std::unique_ptr<CMachinaForm> m_holding_form{nullptr};
-
-  /////////////////////////////////////////////////
-  /// @brief Get the position of the Component in the Component Register.
-  ///
-  /// @return index of the component in the component register
-  /////////////////////////////////////////////////
-  size_t GetComponentRegisterIndex() const override;
 };
 } // namespace steamrot
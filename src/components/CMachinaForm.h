@@ -20,8 +20,6 @@ namespace steamrot {
 /////////////////////////////////////////////////
 struct CMachinaForm : public Component {
 
-  CMachinaForm() = default;
-
   /////////////////////////////////////////////////
   /// @brief Contains all Fragments for this Entity/MachinaForm
   ///
@@ -31,7 +29,5 @@ struct CMachinaForm : public Component {
   std::vector<Fragment> m_fragments;
 
   std::vector<Joint> m_joints;
-
-  size_t GetComponentRegisterIndex() const override;
 };
 } // namespace steamrot
@@ -46,11 +46,6 @@ struct UIVisibilityState {
 ////////////////////////////////////////////////////////////
 struct CUIState : public Component {
 
-  ////////////////////////////////////////////////////////////
-  /// @brief Default constructor
-  ////////////////////////////////////////////////////////////
-  CUIState() = default;
-
   ////////////////////////////////////////////////////////////
   /// @brief Mapping of state keys to UI visibility states
   ///
@@ -76,13 +71,6 @@ struct CUIState : public Component {
   ////////////////////////////////////////////////////////////
   std::unordered_map<std::string, std::vector<std::shared_ptr<Subscriber>>>
       m_state_subscribers;
-
-  ////////////////////////////////////////////////////////////
-  /// @brief Get the position of the Component in the Component Register.
-  ///
-  /// @return index of the component in the component register
-  ////////////////////////////////////////////////////////////
-  size_t GetComponentRegisterIndex() const override;
 };
 
 } // namespace steamrot
@@ -8,7 +8,9 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "Component.h"
+#include "UIBatch.h"
 #include "UIElement.h"
+#include "UIRenderCache.h"
 #include <SFML/System/Vector2.hpp>
 #include <memory>
 
@@ -16,11 +18,6 @@ namespace steamrot {
 
 struct CUserInterface : public Component {
 
-  ////////////////////////////////////////////////////////////
-  // |brief: Default constructor
-  ////////////////////////////////////////////////////////////
-  CUserInterface() = default;
-
   /////////////////////////////////////////////////
   /// @brief String tag for the user interface component
   ///
@@ -34,15 +31,19 @@ struct CUserInterface : public Component {
   std::unique_ptr<UIElement> m_root_element;
 
   /////////////////////////////////////////////////
-  /// @brief Is the this element of the user interface visible to Users.
+  /// @brief Backgrounds, borders and other shapes of the tree, drawn in one
+  /// call
   /////////////////////////////////////////////////
-  bool m_UI_visible{false};
+  UIBatch m_ui_batch;
 
   /////////////////////////////////////////////////
-  /// @brief returns the index of the component in the component register
-  ///
-  /// @return Index of the component in the component register
+  /// @brief Offscreen copy of the batch, redrawn only when the tree changes
   /////////////////////////////////////////////////
-  size_t GetComponentRegisterIndex() const override;
+  UIRenderCache m_ui_render_cache;
+
+  /////////////////////////////////////////////////
+  /// @brief Is the this element of the user interface visible to Users.
+  /////////////////////////////////////////////////
+  bool m_UI_visible{false};
 };
 } // namespace steamrot
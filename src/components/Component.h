@@ -16,24 +16,14 @@
 namespace steamrot {
 /////////////////////////////////////////////////
 /// @class Component
-/// @brief [TODO:description]
+/// @brief Common data for every Component in the ComponentRegister.
 ///
+/// Deliberately non-virtual so derived Components stay plain aggregates and
+/// pack tightly in the EntityMemoryPool. A Component's position in the
+/// register is found at compile time with TupleTypeIndex.
 /////////////////////////////////////////////////
 struct Component {
 
-  /////////////////////////////////////////////////
-  /// @brief Destrcutor for the abstract Component struct
-  /////////////////////////////////////////////////
-  virtual ~Component() = default;
-
-  /////////////////////////////////////////////////
-  /// @brief Virtual method to find the Component's position in the component
-  /// register
-  ///
-  /// @return Size_t representing the index of the component in the register
-  /////////////////////////////////////////////////
-  virtual size_t GetComponentRegisterIndex() const = 0;
-
   /////////////////////////////////////////////////
   /// @brief Is this Component active?
   ///
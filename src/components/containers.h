@@ -12,6 +12,7 @@
 #include "CUIState.h"
 #include "CUserInterface.h"
 #include <magic_enum/magic_enum.hpp>
+#include <type_traits>
 
 namespace steamrot {
 
@@ -75,4 +76,17 @@ struct IndexOf<T, std::tuple<U, Ts...>> {
 template <typename T, typename Tuple>
 constexpr size_t TupleTypeIndex = IndexOf<T, Tuple>::value;
 
+////////////////////////////////////////////////////////////
+// |brief: true if no type in the tuple carries a vtable
+////////////////////////////////////////////////////////////
+template <typename Tuple> struct NonPolymorphic;
+
+template <typename... Ts> struct NonPolymorphic<std::tuple<Ts...>> {
+  static constexpr bool value = (!std::is_polymorphic_v<Ts> && ...);
+};
+
+// a vptr in a Component would be paid for by every slot in the pool
+static_assert(NonPolymorphic<ComponentRegister>::value,
+              "Components in the ComponentRegister must not be polymorphic");
+
 }; // namespace steamrot
@@ -5,8 +5,9 @@ namespace steamrot {
 GameContext::GameContext(sf::RenderWindow &window, EventHandler &event_handler,
 
                          const size_t &loop_number, AssetManager &asset_manager,
-                         const EnvironmentType &env_type)
+                         JobSystem &job_system, const EnvironmentType &env_type,
+                         const DisplayMode display_mode)
     : game_window(window), event_handler(event_handler),
       loop_number(loop_number), asset_manager(asset_manager),
-      env_type(env_type) {}
+      job_system(job_system), env_type(env_type), display_mode(display_mode) {}
 } // namespace steamrot
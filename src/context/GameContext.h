@@ -6,17 +6,29 @@
 #pragma once
 #include "AssetManager.h"
 #include "EventHandler.h"
+#include "InputState.h"
+#include "JobSystem.h"
 #include "PathProvider.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/System/Vector2.hpp>
 
 namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Whether the game opens a window and renders, or only simulates.
+/////////////////////////////////////////////////
+enum class DisplayMode {
+  Windowed,
+  Headless,
+};
+
 struct GameContext {
   GameContext() = delete;
 
   GameContext(sf::RenderWindow &window, EventHandler &event_handler,
               const size_t &loop_number, AssetManager &asset_manager,
-              const EnvironmentType &env_type);
+              JobSystem &job_system, const EnvironmentType &env_type,
+              const DisplayMode display_mode = DisplayMode::Windowed);
 
   /////////////////////////////////////////////////
   /// @brief Reference to the game window.
@@ -37,6 +49,14 @@ struct GameContext {
   /////////////////////////////////////////////////
   sf::Vector2i mouse_position{0, 0};
 
+  /////////////////////////////////////////////////
+  /// @brief Keys and mouse buttons down this tick and the tick before.
+  ///
+  /// Window events update it every frame and the GameEngine snapshots it at
+  /// the start of every tick, Logic can poll it instead of subscribing.
+  /////////////////////////////////////////////////
+  InputState input_state;
+
   /////////////////////////////////////////////////
   /// @brief Loop number for the current game loop. Lives on the GameEngine
   /////////////////////////////////////////////////
@@ -48,9 +68,21 @@ struct GameContext {
   /////////////////////////////////////////////////
   AssetManager &asset_manager;
 
+  /////////////////////////////////////////////////
+  /// @brief Reference to the JobSystem living on the GameEngine, shared by
+  /// every Scene.
+  /////////////////////////////////////////////////
+  JobSystem &job_system;
+
   /////////////////////////////////////////////////
   /// @brief Desc
   /////////////////////////////////////////////////
   const EnvironmentType env_type;
+
+  /////////////////////////////////////////////////
+  /// @brief Display mode of the game, in Headless mode the window is never
+  /// created and nothing is rendered.
+  /////////////////////////////////////////////////
+  const DisplayMode display_mode;
 };
 } // namespace steamrot
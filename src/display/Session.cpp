@@ -2,7 +2,7 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "Session.h"
-#include <iostream>
+#include "log_channel.h"
 #include <memory>
 
 namespace steamrot {
@@ -23,9 +23,10 @@ void Session::AddTile() {
 
   // print whether the tiles are the same
   if (m_tiles.back() == new_tile) {
-    std::cout << "Session: New tile added successfully." << std::endl;
+    STEAMROT_LOG_DEBUG(LogChannel::Display, "tile added tile_count={}",
+                       m_tiles.size());
   } else {
-    std::cout << "Session: Failed to add new tile." << std::endl;
+    STEAMROT_LOG_WARN(LogChannel::Display, "failed to add tile");
   }
 };
 
@@ -2,7 +2,7 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "Tile.h"
-#include <iostream>
+#include "log_channel.h"
 
 namespace steamrot {
 ////////////////////////////////////////////////////////////
@@ -11,7 +11,8 @@ Tile::Tile() {}
 ////////////////////////////////////////////////////////////
 void Tile::SetSceneId(const uuids::uuid &scene_id) {
   m_scene_id = scene_id;
-  std::cout << "Tile: Scene ID set to " << m_scene_id << std::endl;
+  STEAMROT_LOG_DEBUG(LogChannel::Display, "tile scene set scene_id={}",
+                     uuids::to_string(m_scene_id));
 }
 
 ////////////////////////////////////////////////////////////
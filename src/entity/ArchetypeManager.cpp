@@ -8,17 +8,18 @@
 /////////////////////////////////////////////////
 #include "ArchetypeManager.h"
 #include "containers.h"
-#include "emp_helpers.h"
 #include <cstddef>
 #include <expected>
+#include <format>
 #include <magic_enum/magic_enum.hpp>
 #include <variant>
 #include <vector>
 
 namespace steamrot {
 ////////////////////////////////////////////////////////////
-ArchetypeManager::ArchetypeManager(const EntityMemoryPool &emp)
-    : m_entity_memory_pool(emp) {}
+ArchetypeManager::ArchetypeManager(
+    const std::vector<ArchetypeID> &entity_signatures)
+    : m_entity_signatures(entity_signatures) {}
 
 ////////////////////////////////////////////////////////////
 std::vector<size_t> ArchetypeManager::GetEntityIndexes(
@@ -48,53 +49,114 @@ std::vector<size_t> ArchetypeManager::GetEntityIndexes(
 }
 
 /////////////////////////////////////////////////
-std::expected<const ArchetypeID, FailInfo>
-ArchetypeManager::GenerateArchetypeID(size_t entity_index) {
+std::expected<std::monostate, FailInfo>
+ArchetypeManager::GenerateAllArchetypes() {
+  // clear existing archetypes and the per entity positions
+  m_archetypes.clear();
+  m_entity_archetype_positions.clear();
+  ++m_archetype_set_version;
 
-  // create blank archetypeID
-  ArchetypeID archetypeID{0};
+  // file every entity, TrackNewEntities will treat them all as new
+  return TrackNewEntities();
+}
 
-  // iterate over all the vectors in the entity memory pool
-  std::apply(
-      [&](const auto &...component_vector) {
-        // for each component vector, check if the entity has that component
+/////////////////////////////////////////////////
+void ArchetypeManager::InsertIntoArchetype(size_t entity_index) {
+
+  // try_emplace creates a new vector if the key does not exist, and tells us
+  // when it did so cached views can be invalidated
+  auto [it, inserted] =
+      m_archetypes.try_emplace(m_entity_signatures[entity_index]);
+  if (inserted) {
+    ++m_archetype_set_version;
+  }
 
-        ((archetypeID.set(
-             component_vector[entity_index].GetComponentRegisterIndex(),
-             component_vector[entity_index].m_active)),
-         ...);
-      },
-      m_entity_memory_pool);
+  Archetype &archetype = it->second;
 
-  return archetypeID;
-};
+  m_entity_archetype_positions[entity_index] = archetype.size();
+  archetype.push_back(entity_index);
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo> ArchetypeManager::TrackNewEntities() {
+
+  size_t signature_count = m_entity_signatures.size();
+  size_t tracked_count = m_entity_archetype_positions.size();
+
+  // no new entities, nothing to track
+  if (tracked_count >= signature_count) {
+    return std::monostate{};
+  }
+
+  m_entity_archetype_positions.resize(signature_count);
+
+  // only the signature column is read, component payloads are never touched
+  for (size_t entity_index = tracked_count; entity_index < signature_count;
+       ++entity_index) {
+    InsertIntoArchetype(entity_index);
+  }
+
+  return std::monostate{};
+}
 
 /////////////////////////////////////////////////
 std::expected<std::monostate, FailInfo>
-ArchetypeManager::GenerateAllArchetypes() {
-  // clear existing archetypes
-  m_archetypes.clear();
+ArchetypeManager::ValidateEntityIndex(size_t entity_index) const {
+
+  if (entity_index >= m_entity_archetype_positions.size()) {
+    std::string fail_msg =
+        std::format("Entity index {} is not tracked by the ArchetypeManager "
+                    "(tracking {})",
+                    entity_index, m_entity_archetype_positions.size());
+    return std::unexpected(FailInfo{FailMode::IndexOutOfBounds, fail_msg});
+  }
 
-  // get current pool size
-  size_t pool_size = emp_helpers::GetMemoryPoolSize(m_entity_memory_pool);
+  return std::monostate{};
+}
 
-  // iterate over all entities in the memory pool
-  for (size_t entity_index = 0; entity_index < pool_size; ++entity_index) {
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+ArchetypeManager::MoveEntity(size_t entity_index,
+                             const ArchetypeID &previous_signature) {
 
-    // check if attempt to generate archetype id is successful
-    auto id_result = GenerateArchetypeID(entity_index);
-    if (!id_result.has_value()) {
-      return std::unexpected(
-          id_result.error()); // return error if failed to generate ID
-    }
-    // get the component mask for the current entity
-    ArchetypeID archetypeID = GenerateArchetypeID(entity_index).value();
+  auto validate_result = ValidateEntityIndex(entity_index);
+  if (!validate_result.has_value()) {
+    return std::unexpected(validate_result.error());
+  }
 
-    // [] operator should create a new vector if the key does not exist, hence
-    // this over .find()
-    m_archetypes[archetypeID].push_back(entity_index);
+  // nothing to do if the entity is already in the right place
+  if (previous_signature == m_entity_signatures[entity_index]) {
+    return std::monostate{};
   }
 
+  auto it = m_archetypes.find(previous_signature);
+  const size_t position = m_entity_archetype_positions[entity_index];
+
+  // make sure the entity really is filed where the caller says it is
+  if (it == m_archetypes.end() || position >= it->second.size() ||
+      it->second[position] != entity_index) {
+    return std::unexpected(
+        FailInfo{FailMode::NotAddedToMap,
+                 "Entity is not filed under its previous signature"});
+  }
+
+  // swap-remove the entity from its current archetype, the last entity takes
+  // over its slot so only one position needs updating
+  Archetype &previous_archetype = it->second;
+  const size_t last_entity = previous_archetype.back();
+
+  previous_archetype[position] = last_entity;
+  m_entity_archetype_positions[last_entity] = position;
+  previous_archetype.pop_back();
+
+  // keep the map free of empty archetypes, matching GenerateAllArchetypes
+  if (previous_archetype.empty()) {
+    m_archetypes.erase(it);
+    ++m_archetype_set_version;
+  }
+
+  InsertIntoArchetype(entity_index);
+
   return std::monostate{};
 }
 
@@ -103,4 +165,9 @@ const std::unordered_map<ArchetypeID, Archetype> &
 ArchetypeManager::GetArchetypes() const {
   return m_archetypes;
 }
+
+/////////////////////////////////////////////////
+size_t ArchetypeManager::GetArchetypeSetVersion() const {
+  return m_archetype_set_version;
+}
 } // namespace steamrot
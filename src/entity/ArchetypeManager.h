@@ -31,6 +31,8 @@ using Archetype = std::vector<size_t>;
 /// @class ArchetypeManager
 /// @brief Manages the creation and retrieval of Archetypes
 ///
+/// Archetypes are built from the per entity signature column owned by the
+/// EntityManager, so component payloads are never touched here.
 /////////////////////////////////////////////////
 class ArchetypeManager {
 private:
@@ -40,26 +42,50 @@ private:
   std::unordered_map<ArchetypeID, Archetype> m_archetypes;
 
   /////////////////////////////////////////////////
-  /// @brief Reference to the EntityMemoryPool in the scene.
+  /// @brief Reference to the signature (active components) of every entity,
+  /// indexed by entity index.
   /////////////////////////////////////////////////
-  const EntityMemoryPool &m_entity_memory_pool;
+  const std::vector<ArchetypeID> &m_entity_signatures;
 
   /////////////////////////////////////////////////
-  /// @brief Inspects the entity memory pool and that index and generates an ID
+  /// @brief Position of each entity inside its Archetype vector, indexed by
+  /// entity index. Allows O(1) swap-remove when an entity changes archetype.
+  /////////////////////////////////////////////////
+  std::vector<size_t> m_entity_archetype_positions;
+
+  /////////////////////////////////////////////////
+  /// @brief Bumped whenever an Archetype is added to or erased from the map.
+  ///
+  /// Views compare against this to know when their cached list of matching
+  /// Archetypes is stale. Entities moving between existing Archetypes do not
+  /// change it.
+  /////////////////////////////////////////////////
+  size_t m_archetype_set_version{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Appends an entity to the back of the Archetype matching its
+  /// signature and records where it was placed.
+  ///
+  /// @param entity_index Index of the entity to file.
+  /////////////////////////////////////////////////
+  void InsertIntoArchetype(size_t entity_index);
+
+  /////////////////////////////////////////////////
+  /// @brief Checks an entity index is covered by the signature column.
   ///
-  /// @param entity_index Index of the entity to generate an ArchetypeID for.
+  /// @param entity_index Index of the entity.
   /////////////////////////////////////////////////
-  std::expected<const ArchetypeID, FailInfo>
-  GenerateArchetypeID(size_t entity_index);
+  std::expected<std::monostate, FailInfo>
+  ValidateEntityIndex(size_t entity_index) const;
 
 public:
   /////////////////////////////////////////////////
-  /// @brief Constructor for the ArchetypeManager class taking an
-  /// EntityMemoryPool reference.
+  /// @brief Constructor for the ArchetypeManager class taking a reference to
+  /// the entity signature column.
   ///
-  /// @param entity_memory_pool Reference to the EntityMemoryPool in the scene.
+  /// @param entity_signatures Signature of every entity in the scene.
   /////////////////////////////////////////////////
-  ArchetypeManager(const EntityMemoryPool &entity_memory_pool);
+  ArchetypeManager(const std::vector<ArchetypeID> &entity_signatures);
 
   /////////////////////////////////////////////////
   /// @brief Returns the entity indexes for the given archetype IDs.
@@ -70,16 +96,39 @@ public:
   GetEntityIndexes(const std::vector<ArchetypeID> &archtype_IDs) const;
 
   /////////////////////////////////////////////////
-  /// @brief Clears current archetypes and generates all archetypes
-  ///
-  /// @param entity_memory_pool Reference to the EntityMemoryPool in the scene
+  /// @brief Clears current archetypes and generates all archetypes from the
+  /// signature column
   /////////////////////////////////////////////////
   std::expected<std::monostate, FailInfo> GenerateAllArchetypes();
 
+  /////////////////////////////////////////////////
+  /// @brief Files any entities appended to the signature column since
+  /// archetypes were last generated, without touching existing entries.
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo> TrackNewEntities();
+
+  /////////////////////////////////////////////////
+  /// @brief Moves a single entity whose signature has changed into the
+  /// Archetype matching its new signature.
+  ///
+  /// The entity is swap-removed from its old Archetype (the last entity takes
+  /// its slot) so the move is O(1). Empty Archetypes are erased from the map.
+  ///
+  /// @param entity_index Index of the entity that changed.
+  /// @param previous_signature Signature the entity was filed under.
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  MoveEntity(size_t entity_index, const ArchetypeID &previous_signature);
+
   /////////////////////////////////////////////////
   /// @brief Returns the archetypes map.
   /////////////////////////////////////////////////
   const std::unordered_map<ArchetypeID, Archetype> &GetArchetypes() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the current version of the set of Archetypes.
+  /////////////////////////////////////////////////
+  size_t GetArchetypeSetVersion() const;
 };
 
 } // namespace steamrot
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the EntityAllocator class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EntityAllocator.h"
+#include <algorithm>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+EntityAllocator::EntityAllocator(const size_t capacity)
+    : m_generations(capacity, 0), m_alive(capacity, false) {
+
+  // push in reverse so the lowest index is handed out first
+  m_free_indexes.reserve(capacity);
+  for (size_t i = capacity; i > 0; --i) {
+    m_free_indexes.push_back(i - 1);
+  }
+}
+
+/////////////////////////////////////////////////
+void EntityAllocator::Rebuild(const std::vector<CMeta> &meta_data) {
+
+  // keep existing generations, new indexes start at 0
+  m_generations.resize(meta_data.size(), 0);
+  m_alive.assign(meta_data.size(), false);
+  m_free_indexes.clear();
+
+  for (size_t i = meta_data.size(); i > 0; --i) {
+    const size_t index = i - 1;
+
+    if (meta_data[index].m_entity_active) {
+      m_alive[index] = true;
+    } else {
+      m_free_indexes.push_back(index);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void EntityAllocator::Grow() {
+
+  const size_t old_capacity = m_generations.size();
+  const size_t new_capacity =
+      std::max(kMinimumEntityCapacity, old_capacity * 2);
+
+  m_generations.resize(new_capacity, 0);
+  m_alive.resize(new_capacity, false);
+
+  // only called once the free-list is exhausted, so the new indexes can be
+  // pushed straight on (in reverse so the lowest is handed out first)
+  for (size_t i = new_capacity; i > old_capacity; --i) {
+    m_free_indexes.push_back(i - 1);
+  }
+}
+
+/////////////////////////////////////////////////
+EntityHandle EntityAllocator::Allocate() {
+
+  if (m_free_indexes.empty()) {
+    Grow();
+  }
+
+  const size_t index = m_free_indexes.back();
+  m_free_indexes.pop_back();
+  m_alive[index] = true;
+
+  return EntityHandle{index, m_generations[index]};
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+EntityAllocator::Release(const EntityHandle &handle) {
+
+  if (!IsValid(handle)) {
+    return std::unexpected(FailInfo{FailMode::StaleHandle,
+                                    "Entity handle is stale or out of range"});
+  }
+
+  Release(handle.index);
+  return std::monostate{};
+}
+
+/////////////////////////////////////////////////
+void EntityAllocator::Release(const size_t index) {
+
+  // ignore indexes that are out of range or already free
+  if (index >= m_alive.size() || !m_alive[index]) {
+    return;
+  }
+
+  m_alive[index] = false;
+  // invalidate any handles still pointing at this index
+  ++m_generations[index];
+  m_free_indexes.push_back(index);
+}
+
+/////////////////////////////////////////////////
+bool EntityAllocator::IsValid(const EntityHandle &handle) const {
+
+  return handle.index < m_alive.size() && m_alive[handle.index] &&
+         m_generations[handle.index] == handle.generation;
+}
+
+/////////////////////////////////////////////////
+std::expected<EntityHandle, FailInfo>
+EntityAllocator::GetHandle(const size_t index) const {
+
+  if (index >= m_alive.size() || !m_alive[index]) {
+    return std::unexpected(FailInfo{FailMode::IndexOutOfBounds,
+                                    "No allocated entity at the given index"});
+  }
+
+  return EntityHandle{index, m_generations[index]};
+}
+
+/////////////////////////////////////////////////
+size_t EntityAllocator::PeekNextFreeIndex() const {
+
+  // Allocate would grow and hand out the first new index
+  if (m_free_indexes.empty()) {
+    return m_generations.size();
+  }
+
+  return m_free_indexes.back();
+}
+
+/////////////////////////////////////////////////
+size_t EntityAllocator::GetCapacity() const { return m_generations.size(); }
+
+} // namespace steamrot
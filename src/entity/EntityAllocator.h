@@ -0,0 +1,141 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the EntityAllocator class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "CMeta.h"
+#include "FailInfo.h"
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <variant>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Smallest capacity the allocator will grow to from an empty pool
+/////////////////////////////////////////////////
+constexpr size_t kMinimumEntityCapacity = 16;
+
+/////////////////////////////////////////////////
+/// @class EntityHandle
+/// @brief Versioned reference to an entity in the EntityMemoryPool.
+///
+/// The generation is bumped every time the index is released, so a handle
+/// kept after its entity was destroyed can be detected as stale.
+/////////////////////////////////////////////////
+struct EntityHandle {
+  /////////////////////////////////////////////////
+  /// @brief Index of the entity in the EntityMemoryPool
+  /////////////////////////////////////////////////
+  size_t index{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Generation of the index when the handle was created
+  /////////////////////////////////////////////////
+  uint32_t generation{0};
+
+  bool operator==(const EntityHandle &) const = default;
+};
+
+/////////////////////////////////////////////////
+/// @class EntityAllocator
+/// @brief Hands out free entity indexes in O(1) using a free-list.
+///
+/////////////////////////////////////////////////
+class EntityAllocator {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Current generation of each index
+  /////////////////////////////////////////////////
+  std::vector<uint32_t> m_generations;
+
+  /////////////////////////////////////////////////
+  /// @brief Whether each index is currently handed out
+  /////////////////////////////////////////////////
+  std::vector<bool> m_alive;
+
+  /////////////////////////////////////////////////
+  /// @brief Stack of free indexes, the next index to hand out is at the back
+  /////////////////////////////////////////////////
+  std::vector<size_t> m_free_indexes;
+
+  /////////////////////////////////////////////////
+  /// @brief Double the capacity (or grow to kMinimumEntityCapacity) once the
+  /// free-list is empty
+  /////////////////////////////////////////////////
+  void Grow();
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for EntityAllocator
+  ///
+  /// @param capacity Number of free indexes to start with
+  /////////////////////////////////////////////////
+  EntityAllocator(const size_t capacity = 0);
+
+  /////////////////////////////////////////////////
+  /// @brief Rebuild the free-list from the CMeta vector of a pool
+  ///
+  /// Indexes whose CMeta is marked as active are treated as handed out.
+  /// Generations of existing indexes are kept.
+  ///
+  /// @param meta_data CMeta vector from the EntityMemoryPool
+  /////////////////////////////////////////////////
+  void Rebuild(const std::vector<CMeta> &meta_data);
+
+  /////////////////////////////////////////////////
+  /// @brief Hand out the next free index, growing the capacity if needed
+  ///
+  /// @return Handle to the newly allocated entity
+  /////////////////////////////////////////////////
+  EntityHandle Allocate();
+
+  /////////////////////////////////////////////////
+  /// @brief Return an entity to the free-list
+  ///
+  /// @param handle Handle of the entity to release
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo> Release(const EntityHandle &handle);
+
+  /////////////////////////////////////////////////
+  /// @brief Return an index to the free-list, ignored if it is already free
+  ///
+  /// @param index Index of the entity to release
+  /////////////////////////////////////////////////
+  void Release(const size_t index);
+
+  /////////////////////////////////////////////////
+  /// @brief Check a handle still points at the entity it was created for
+  ///
+  /// @param handle Handle to check
+  /////////////////////////////////////////////////
+  bool IsValid(const EntityHandle &handle) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Get a handle for an index that is currently handed out
+  ///
+  /// @param index Index of the entity
+  /////////////////////////////////////////////////
+  std::expected<EntityHandle, FailInfo> GetHandle(const size_t index) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Index that the next call to Allocate will return
+  /////////////////////////////////////////////////
+  size_t PeekNextFreeIndex() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of indexes (free and handed out) the allocator manages
+  /////////////////////////////////////////////////
+  size_t GetCapacity() const;
+};
+} // namespace steamrot
@@ -12,23 +12,32 @@
 #include "FlatbuffersConfigurator.h"
 #include "PathProvider.h"
 #include "emp_helpers.h"
+#include "log_handler.h"
 #include <expected>
+#include <type_traits>
 #include <variant>
 
 namespace steamrot {
 
 ////////////////////////////////////////////////////////////
 EntityManager::EntityManager(EventHandler &event_handler)
-    : m_archetype_manager(m_entity_memory_pool),
+    : m_archetype_manager(m_entity_signatures),
       m_event_handler(event_handler) {}
 
 /////////////////////////////////////////////////
 EntityManager::EntityManager(const size_t pool_size,
                              EventHandler &event_handler)
-    : m_archetype_manager(m_entity_memory_pool),
+    : m_archetype_manager(m_entity_signatures),
       m_event_handler(event_handler) {
-  // resize the entity memory pool to the given size
-  ResizeEntityMemoryPool(pool_size);
+  // resize the entity memory pool to the given size, a constructor cannot
+  // return the failure so it is logged
+  auto resize_result = ResizeEntityMemoryPool(pool_size);
+  if (!resize_result) {
+    log_handler::ProcessErrorLog(log_handler::LogCode::kNoCode,
+                                 resize_result.error().message);
+  }
+  m_entity_allocator.Rebuild(
+      emp_helpers::GetComponentVector<CMeta>(m_entity_memory_pool));
 }
 /////////////////////////////////////////////////
 EntityMemoryPool &EntityManager::GetEntityMemoryPool() {
@@ -48,8 +57,67 @@ const ArchetypeManager &EntityManager::GetArchetypeManager() const {
   return m_archetype_manager;
 }
 
+/////////////////////////////////////////////////
+const std::vector<ArchetypeID> &EntityManager::GetEntitySignatures() const {
+  return m_entity_signatures;
+}
+
+/////////////////////////////////////////////////
+ArchetypeID
+EntityManager::GenerateSignatureFromPool(const size_t entity_index) const {
+
+  // create blank signature
+  ArchetypeID signature{0};
+
+  // iterate over all the vectors in the entity memory pool
+  std::apply(
+      [&](const auto &...component_vector) {
+        // for each component vector, check if the entity has that component.
+        // the bit position is resolved at compile time from the vector type
+        ((signature.set(
+             TupleTypeIndex<
+                 typename std::decay_t<decltype(component_vector)>::value_type,
+                 ComponentRegister>,
+             component_vector[entity_index].m_active)),
+         ...);
+      },
+      m_entity_memory_pool);
+
+  return signature;
+}
+
+/////////////////////////////////////////////////
+void EntityManager::RebuildEntitySignatures() {
+
+  size_t pool_size = emp_helpers::GetMemoryPoolSize(m_entity_memory_pool);
+  m_entity_signatures.resize(pool_size);
+
+  for (size_t i = 0; i < pool_size; ++i) {
+    m_entity_signatures[i] = GenerateSignatureFromPool(i);
+  }
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+EntityManager::SetEntitySignature(const size_t entity_index,
+                                  const ArchetypeID &signature) {
+
+  ArchetypeID previous_signature = m_entity_signatures[entity_index];
+  m_entity_signatures[entity_index] = signature;
+
+  auto move_result =
+      m_archetype_manager.MoveEntity(entity_index, previous_signature);
+  if (!move_result.has_value()) {
+    // the entity is still filed under its previous signature, keep the column
+    // in line with it so later moves can find it
+    m_entity_signatures[entity_index] = previous_signature;
+  }
+  return move_result;
+}
+
 ////////////////////////////////////////////////////////////
-void EntityManager::ResizeEntityMemoryPool(const size_t pool_size) {
+std::expected<std::monostate, FailInfo>
+EntityManager::ResizeEntityMemoryPool(const size_t pool_size) {
 
   // use std::apply to resize the memory pool with lambda function
   std::apply(
@@ -57,6 +125,12 @@ void EntityManager::ResizeEntityMemoryPool(const size_t pool_size) {
         (component_vector.resize(pool_size), ...);
       },
       m_entity_memory_pool);
+
+  // new entities have no active components
+  m_entity_signatures.resize(pool_size);
+
+  // file the new (empty) entities so the archetype map stays complete
+  return m_archetype_manager.TrackNewEntities();
 }
 
 /////////////////////////////////////////////////
@@ -74,6 +148,16 @@ EntityManager::ConfigureEntitiesFromDefaultData(
     if (!configure_result.has_value())
       return std::unexpected<FailInfo>(configure_result.error());
 
+    // configured entities are marked active in CMeta, the rest are free
+    m_entity_allocator.Rebuild(
+        emp_helpers::GetComponentVector<CMeta>(m_entity_memory_pool));
+
+    // components were set directly on the pool, so this is the one place the
+    // payloads are scanned to build signatures
+    RebuildEntitySignatures();
+    auto generate_result = m_archetype_manager.GenerateAllArchetypes();
+    if (!generate_result.has_value())
+      return std::unexpected(generate_result.error());
     break;
   }
   default:
@@ -84,21 +168,73 @@ EntityManager::ConfigureEntitiesFromDefaultData(
   return std::monostate();
 }
 ////////////////////////////////////////////////////////////
-size_t EntityManager::GetNextFreeEntityIndex() {
+size_t EntityManager::GetNextFreeEntityIndex() const {
 
-  // get CMeta vector from the pool
-  std::vector<CMeta> meta_data =
-      emp_helpers::GetComponentVector<CMeta>(m_entity_memory_pool);
+  // if the free-list is empty this is the first index after a pool growth
+  return m_entity_allocator.PeekNextFreeIndex();
+};
 
-  // find next inactive entity index
-  for (size_t i = 0; i < meta_data.size(); ++i) {
-    if (!meta_data[i].m_entity_active) {
-      return i;
-    }
+/////////////////////////////////////////////////
+std::expected<EntityHandle, FailInfo> EntityManager::CreateEntity() {
+
+  EntityHandle handle = m_entity_allocator.Allocate();
+
+  // the allocator grew, grow every component vector with it
+  if (m_entity_allocator.GetCapacity() >
+      emp_helpers::GetMemoryPoolSize(m_entity_memory_pool)) {
+
+    auto resize_result =
+        ResizeEntityMemoryPool(m_entity_allocator.GetCapacity());
+    if (!resize_result.has_value())
+      return std::unexpected(resize_result.error());
   }
-  // if no inactive entity found, return the size of the vector
-  return meta_data.size();
-};
+
+  emp_helpers::GetComponent<CMeta>(handle.index, m_entity_memory_pool)
+      .m_entity_active = true;
+
+  return handle;
+}
+
+/////////////////////////////////////////////////
+bool EntityManager::IsEntityValid(const EntityHandle &handle) const {
+  return m_entity_allocator.IsValid(handle);
+}
+
+/////////////////////////////////////////////////
+std::expected<EntityHandle, FailInfo>
+EntityManager::GetEntityHandle(const size_t entity_index) const {
+  return m_entity_allocator.GetHandle(entity_index);
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+EntityManager::DestroyEntity(const size_t entity_index) {
+
+  if (entity_index >= emp_helpers::GetMemoryPoolSize(m_entity_memory_pool)) {
+    return std::unexpected(
+        FailInfo{FailMode::IndexOutOfBounds,
+                 "Cannot destroy entity, index outside of the memory pool"});
+  }
+
+  // default construct every component at the index
+  RefreshEntity(m_entity_memory_pool, entity_index);
+  m_entity_allocator.Release(entity_index);
+
+  // destroyed entities live in the empty archetype, same as unused slots
+  return SetEntitySignature(entity_index, ArchetypeID{0});
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+EntityManager::DestroyEntity(const EntityHandle &handle) {
+
+  if (!m_entity_allocator.IsValid(handle)) {
+    return std::unexpected(FailInfo{
+        FailMode::StaleHandle, "Cannot destroy entity, handle is stale"});
+  }
+
+  return DestroyEntity(handle.index);
+}
 
 /////////////////////////////////////////////////
 std::expected<std::monostate, FailInfo> EntityManager::GenerateAllArchetypes() {
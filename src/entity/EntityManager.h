@@ -13,10 +13,12 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "ArchetypeManager.h"
+#include "EntityAllocator.h"
 #include "EventHandler.h"
 #include "FailInfo.h"
 #include "PathProvider.h"
 #include "containers.h"
+#include "emp_helpers.h"
 #include <cstddef>
 #include <expected>
 #include <variant>
@@ -41,12 +43,27 @@ private:
   /////////////////////////////////////////////////
   EntityMemoryPool m_entity_memory_pool;
 
+  /////////////////////////////////////////////////
+  /// @brief Dense column of every entity's signature (which components are
+  /// active), indexed by entity index.
+  ///
+  /// Kept apart from the component payloads so archetype generation and
+  /// queries only scan this contiguous array. Updated by AddComponent,
+  /// RemoveComponent and DestroyEntity.
+  /////////////////////////////////////////////////
+  std::vector<ArchetypeID> m_entity_signatures;
+
   /////////////////////////////////////////////////
   /// @brief Holds the archetype manager instance for this EntityManager and
   /// this Scene
   /////////////////////////////////////////////////
   ArchetypeManager m_archetype_manager;
 
+  /////////////////////////////////////////////////
+  /// @brief Free-list allocator handing out entity indexes in the pool
+  /////////////////////////////////////////////////
+  EntityAllocator m_entity_allocator;
+
   /////////////////////////////////////////////////
   /// @brief Reference to the EventHandler for the game
   /////////////////////////////////////////////////
@@ -89,13 +106,44 @@ private:
                        index);
   }
 
+  /////////////////////////////////////////////////
+  /// @brief Inspect the component payloads at an index and build its
+  /// signature. Only needed when components were configured outside of
+  /// AddComponent e.g. from default data.
+  ///
+  /// @param entity_index Index of the entity in the memory pool
+  /////////////////////////////////////////////////
+  ArchetypeID GenerateSignatureFromPool(const size_t entity_index) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Regenerate the whole signature column from the memory pool
+  /////////////////////////////////////////////////
+  void RebuildEntitySignatures();
+
+  /////////////////////////////////////////////////
+  /// @brief Write a new signature for an entity and move it to the matching
+  /// Archetype.
+  ///
+  /// If the move fails the previous signature is put back, so the signature
+  /// column still matches where the entity is filed.
+  ///
+  /// @param entity_index Index of the entity in the memory pool
+  /// @param signature New signature for the entity
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  SetEntitySignature(const size_t entity_index, const ArchetypeID &signature);
+
   /////////////////////////////////////////////////
   /// @brief Function to resize the entity memory pool.
   ///
+  /// Every component vector is resized together and any new entities are
+  /// filed in the empty archetype.
+  ///
   /// @param new_size New size for the memory pool. (essentially the number of
   /// entities);
   /////////////////////////////////////////////////
-  void ResizeEntityMemoryPool(const size_t pool_size);
+  std::expected<std::monostate, FailInfo>
+  ResizeEntityMemoryPool(const size_t pool_size);
 
 public:
   /////////////////////////////////////////////////
@@ -113,6 +161,15 @@ public:
   /////////////////////////////////////////////////
   EntityManager(const size_t pool_size, EventHandler &event_handler);
 
+  /////////////////////////////////////////////////
+  /// @brief Not copyable or movable, m_archetype_manager refers to
+  /// m_entity_signatures of this instance
+  /////////////////////////////////////////////////
+  EntityManager(const EntityManager &) = delete;
+  EntityManager &operator=(const EntityManager &) = delete;
+  EntityManager(EntityManager &&) = delete;
+  EntityManager &operator=(EntityManager &&) = delete;
+
   /////////////////////////////////////////////////
   /// @brief Call correct configurator to configure entities from default data
   ///
@@ -147,10 +204,111 @@ public:
   /////////////////////////////////////////////////
   const ArchetypeManager &GetArchetypeManager() const;
 
+  /////////////////////////////////////////////////
+  /// @brief Read only reference to the signature of every entity
+  ///
+  /// @return Signature column indexed by entity index
+  /////////////////////////////////////////////////
+  const std::vector<ArchetypeID> &GetEntitySignatures() const;
+
   ////////////////////////////////////////////////////////////
   /// \brief return index of next "free" entity
   ///
   ////////////////////////////////////////////////////////////
-  size_t GetNextFreeEntityIndex();
+  size_t GetNextFreeEntityIndex() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Allocate a new entity, growing the memory pool if it is full
+  ///
+  /// @return Versioned handle to the new entity
+  /////////////////////////////////////////////////
+  std::expected<EntityHandle, FailInfo> CreateEntity();
+
+  /////////////////////////////////////////////////
+  /// @brief Check a handle still refers to a live entity
+  ///
+  /// @param handle Handle returned by CreateEntity or GetEntityHandle
+  /////////////////////////////////////////////////
+  bool IsEntityValid(const EntityHandle &handle) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Get a versioned handle for a live entity index
+  ///
+  /// @param entity_index Index of the entity in the memory pool
+  /////////////////////////////////////////////////
+  std::expected<EntityHandle, FailInfo>
+  GetEntityHandle(const size_t entity_index) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Adds (or replaces) a component on an entity and moves the entity
+  /// into its new Archetype without rebuilding the others.
+  ///
+  /// @tparam T Component type from the ComponentRegister
+  /// @param entity_index Index of the entity to add the component to
+  /// @param component Component to move into the pool, defaults to a default
+  /// constructed component
+  /////////////////////////////////////////////////
+  template <typename T>
+  std::expected<std::monostate, FailInfo> AddComponent(const size_t entity_index,
+                                                       T component = T{}) {
+
+    if (entity_index >= emp_helpers::GetMemoryPoolSize(m_entity_memory_pool)) {
+      return std::unexpected(FailInfo{
+          FailMode::IndexOutOfBounds,
+          "Cannot add component, entity index outside of the memory pool"});
+    }
+
+    // an added component is always included in archetype calculations
+    component.m_active = true;
+    emp_helpers::GetComponent<T>(entity_index, m_entity_memory_pool) =
+        std::move(component);
+
+    ArchetypeID signature = m_entity_signatures[entity_index];
+    signature.set(TupleTypeIndex<T, ComponentRegister>);
+    return SetEntitySignature(entity_index, signature);
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Resets a component on an entity to its default (inactive) values
+  /// and moves the entity into its new Archetype.
+  ///
+  /// @tparam T Component type from the ComponentRegister
+  /// @param entity_index Index of the entity to remove the component from
+  /////////////////////////////////////////////////
+  template <typename T>
+  std::expected<std::monostate, FailInfo>
+  RemoveComponent(const size_t entity_index) {
+
+    if (entity_index >= emp_helpers::GetMemoryPoolSize(m_entity_memory_pool)) {
+      return std::unexpected(FailInfo{
+          FailMode::IndexOutOfBounds,
+          "Cannot remove component, entity index outside of the memory pool"});
+    }
+
+    ResetValues(emp_helpers::GetComponentVector<T>(m_entity_memory_pool),
+                entity_index);
+
+    ArchetypeID signature = m_entity_signatures[entity_index];
+    signature.reset(TupleTypeIndex<T, ComponentRegister>);
+    return SetEntitySignature(entity_index, signature);
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Resets every component of an entity, returns it to the empty
+  /// Archetype and releases its index.
+  ///
+  /// @param entity_index Index of the entity to destroy
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  DestroyEntity(const size_t entity_index);
+
+  /////////////////////////////////////////////////
+  /// @brief Destroy an entity through a versioned handle, stale handles are
+  /// rejected.
+  ///
+  /// @param handle Handle of the entity to destroy
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  DestroyEntity(const EntityHandle &handle);
 };
 } // namespace steamrot
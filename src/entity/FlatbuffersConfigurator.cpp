@@ -13,10 +13,10 @@
 #include "SubscriberFactory.h"
 #include "UIElementFactory.h"
 #include "emp_helpers.h"
+#include "log_channel.h"
 
 #include "user_interface_generated.h"
 #include <expected>
-#include <iostream>
 #include <variant>
 
 namespace steamrot {
@@ -80,7 +80,12 @@ FlatbuffersConfigurator::ConfigureEntitiesFromDefaultData(
     if (entity_data == nullptr) {
       continue; // Skip null entities
     }
-    std::cout << "Configuring entity index: " << i << std::endl;
+    STEAMROT_LOG_TRACE(LogChannel::Entity, "configuring entity index={}", i);
+
+    // mark the entity as in use so the EntityAllocator does not hand it out
+    emp_helpers::GetComponent<CMeta>(i, entity_memory_pool).m_entity_active =
+        true;
+
     // CUserInterface component configuration
     if (entity_data->c_user_interface()) {
       auto configure_result = ConfigureComponent(
@@ -0,0 +1,270 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration and implementation of the View class template
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ArchetypeHelpers.h"
+#include "ArchetypeManager.h"
+#include "JobSystem.h"
+#include "containers.h"
+#include "emp_helpers.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Default number of entities handed to each job by
+/// View::ParallelForEach
+/////////////////////////////////////////////////
+constexpr size_t kDefaultParallelChunkSize = 256;
+
+/////////////////////////////////////////////////
+/// @class View
+/// @brief Iterates every entity that has at least the requested Components.
+///
+/// Any Archetype whose ArchetypeID is a superset of the requested one is
+/// matched, so an entity with CUserInterface and CUIState is visited by a
+/// View<CUserInterface>. The list of matching Archetypes is cached and only
+/// rebuilt when the ArchetypeManager reports the set of Archetypes changed.
+///
+/// @tparam Components Components every visited entity must have.
+/////////////////////////////////////////////////
+template <typename... Components> class View {
+  static_assert(sizeof...(Components) > 0,
+                "A View needs at least one Component to match against");
+
+private:
+  /////////////////////////////////////////////////
+  /// @brief Reference to the EntityMemoryPool components are read from.
+  /////////////////////////////////////////////////
+  EntityMemoryPool &m_entity_memory_pool;
+
+  /////////////////////////////////////////////////
+  /// @brief Reference to the ArchetypeManager holding the Archetypes.
+  /////////////////////////////////////////////////
+  const ArchetypeManager &m_archetype_manager;
+
+  /////////////////////////////////////////////////
+  /// @brief ArchetypeID built from the requested Components.
+  /////////////////////////////////////////////////
+  ArchetypeID m_archetype_id{GenerateArchetypeIDfromTypes<Components...>()};
+
+  /////////////////////////////////////////////////
+  /// @brief Archetypes whose ArchetypeID is a superset of m_archetype_id.
+  ///
+  /// Points straight into the archetypes map, which keeps its values in place
+  /// until they are erased (and erasing bumps the set version).
+  /////////////////////////////////////////////////
+  std::vector<const Archetype *> m_matching_archetypes;
+
+  /////////////////////////////////////////////////
+  /// @brief Archetype set version m_matching_archetypes was built against.
+  /////////////////////////////////////////////////
+  size_t m_cached_version{std::numeric_limits<size_t>::max()};
+
+  /////////////////////////////////////////////////
+  /// @brief Rebuilds m_matching_archetypes if the Archetype set has changed.
+  /////////////////////////////////////////////////
+  void RefreshMatchingArchetypes() {
+
+    const size_t version = m_archetype_manager.GetArchetypeSetVersion();
+    if (version == m_cached_version) {
+      return;
+    }
+
+    m_matching_archetypes.clear();
+    for (const auto &[archetype_id, archetype] :
+         m_archetype_manager.GetArchetypes()) {
+
+      // superset check, every requested bit must be set in the archetype
+      if ((archetype_id & m_archetype_id) == m_archetype_id) {
+        m_matching_archetypes.push_back(&archetype);
+      }
+    }
+
+    m_cached_version = version;
+  }
+
+public:
+  /////////////////////////////////////////////////
+  /// @class Iterator
+  /// @brief Forward iterator yielding the entity index and references to its
+  /// Components.
+  /////////////////////////////////////////////////
+  class Iterator {
+  private:
+    const View *m_view{nullptr};
+    size_t m_archetype_position{0};
+    size_t m_entity_position{0};
+
+    /////////////////////////////////////////////////
+    /// @brief Moves past any exhausted Archetypes.
+    /////////////////////////////////////////////////
+    void SkipExhaustedArchetypes() {
+      while (m_archetype_position < m_view->m_matching_archetypes.size() &&
+             m_entity_position >=
+                 m_view->m_matching_archetypes[m_archetype_position]->size()) {
+        ++m_archetype_position;
+        m_entity_position = 0;
+      }
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::tuple<size_t, Components &...>;
+
+    Iterator() = default;
+
+    Iterator(const View *view, size_t archetype_position)
+        : m_view(view), m_archetype_position(archetype_position) {
+      SkipExhaustedArchetypes();
+    }
+
+    value_type operator*() const {
+      const size_t entity_index =
+          (*m_view->m_matching_archetypes[m_archetype_position])
+              [m_entity_position];
+
+      return value_type{entity_index,
+                        emp_helpers::GetComponent<Components>(
+                            entity_index, m_view->m_entity_memory_pool)...};
+    }
+
+    Iterator &operator++() {
+      ++m_entity_position;
+      SkipExhaustedArchetypes();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator previous = *this;
+      ++(*this);
+      return previous;
+    }
+
+    bool operator==(const Iterator &) const = default;
+  };
+
+  /////////////////////////////////////////////////
+  /// @brief Constructor for the View class.
+  ///
+  /// @param entity_memory_pool EntityMemoryPool to read components from.
+  /// @param archetype_manager ArchetypeManager holding the Archetypes.
+  /////////////////////////////////////////////////
+  View(EntityMemoryPool &entity_memory_pool,
+       const ArchetypeManager &archetype_manager)
+      : m_entity_memory_pool(entity_memory_pool),
+        m_archetype_manager(archetype_manager) {}
+
+  /////////////////////////////////////////////////
+  /// @brief Returns an iterator to the first matching entity.
+  ///
+  /// Refreshes the cached Archetypes first, so begin() must be called before
+  /// end() (as a range based for loop does).
+  /////////////////////////////////////////////////
+  Iterator begin() {
+    RefreshMatchingArchetypes();
+    return Iterator{this, 0};
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Returns an iterator past the last matching entity.
+  /////////////////////////////////////////////////
+  Iterator end() { return Iterator{this, m_matching_archetypes.size()}; }
+
+  /////////////////////////////////////////////////
+  /// @brief Calls func(entity_index, Components &...) for every matching
+  /// entity.
+  ///
+  /// @param func Callable taking the entity index and the Components.
+  /////////////////////////////////////////////////
+  template <typename Func> void ForEach(Func &&func) {
+    RefreshMatchingArchetypes();
+
+    for (const Archetype *archetype : m_matching_archetypes) {
+      for (size_t entity_index : *archetype) {
+        func(entity_index, emp_helpers::GetComponent<Components>(
+                               entity_index, m_entity_memory_pool)...);
+      }
+    }
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Calls func(entity_index, Components &...) for every matching
+  /// entity, splitting each Archetype into chunks run on the JobSystem.
+  ///
+  /// Returns once every chunk has run. func is called concurrently, so it must
+  /// only touch the entity it is given (and anything else thread safe).
+  ///
+  /// @param job_system JobSystem to run the chunks on.
+  /// @param func Callable taking the entity index and the Components.
+  /// @param chunk_size Maximum number of entities per job.
+  /////////////////////////////////////////////////
+  template <typename Func>
+  void ParallelForEach(JobSystem &job_system, Func &&func,
+                       size_t chunk_size = kDefaultParallelChunkSize) {
+    RefreshMatchingArchetypes();
+
+    chunk_size = std::max<size_t>(chunk_size, 1);
+    JobCounter counter;
+
+    for (const Archetype *archetype : m_matching_archetypes) {
+      for (size_t chunk_start = 0; chunk_start < archetype->size();
+           chunk_start += chunk_size) {
+
+        const size_t chunk_end =
+            std::min(chunk_start + chunk_size, archetype->size());
+
+        job_system.Submit(
+            [this, &func, archetype, chunk_start, chunk_end]() {
+              for (size_t position = chunk_start; position < chunk_end;
+                   ++position) {
+                const size_t entity_index = (*archetype)[position];
+                func(entity_index, emp_helpers::GetComponent<Components>(
+                                       entity_index, m_entity_memory_pool)...);
+              }
+            },
+            counter);
+      }
+    }
+
+    job_system.Wait(counter);
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the number of matching entities.
+  /////////////////////////////////////////////////
+  size_t GetEntityCount() {
+    RefreshMatchingArchetypes();
+
+    size_t entity_count{0};
+    for (const Archetype *archetype : m_matching_archetypes) {
+      entity_count += archetype->size();
+    }
+    return entity_count;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the number of Archetypes the View matches.
+  /////////////////////////////////////////////////
+  size_t GetArchetypeCount() {
+    RefreshMatchingArchetypes();
+    return m_matching_archetypes.size();
+  }
+};
+
+} // namespace steamrot
@@ -3,45 +3,310 @@
 ////////////////////////////////////////////////////////////
 #include "EventHandler.h"
 #include "FailInfo.h"
+#include "JobSystem.h"
+#include "TriggerMatcher.h"
 #include "events_generated.h"
+#include "log_channel.h"
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <algorithm>
+#include <atomic>
 #include <expected>
-#include <iostream>
 #include <optional>
 namespace steamrot {
 
+namespace {
+/////////////////////////////////////////////////
+/// @brief Source of EventHandler instance ids, 0 is never handed out
+/////////////////////////////////////////////////
+std::atomic<uint64_t> g_next_event_handler_id{1};
+} // namespace
+
+/////////////////////////////////////////////////
+EventHandler::EventHandler()
+    : m_owner_thread_id(std::this_thread::get_id()),
+      m_instance_id(
+          g_next_event_handler_id.fetch_add(1, std::memory_order_relaxed)) {
+  m_global_event_bus.reserve(kEventBusCapacity);
+  m_waiting_room_event_bus.reserve(kEventBusCapacity);
+}
+
+/////////////////////////////////////////////////
+EventHandler::~EventHandler() {
+  // stop any Subscribers that outlive the EventHandler from deregistering
+  for (auto &slot : m_subscriber_slots) {
+    if (slot.subscriber) {
+      slot.subscriber->m_event_handler = nullptr;
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 std::expected<std::monostate, FailInfo>
 EventHandler::RegisterSubscriber(std::shared_ptr<Subscriber> subscriber) {
 
-  // get the event type the subscriber is interested in and add it to the
-  // register
-  auto event_type = subscriber->GetRegistrationInfo().first;
-  m_subscriber_register[event_type].push_back(subscriber);
+  if (!subscriber) {
+    FailInfo fail_info(FailMode::NullPointer, "Subscriber is a null pointer");
+    return std::unexpected(fail_info);
+  }
+  if (subscriber->IsRegistered()) {
+    FailInfo fail_info(FailMode::NotAddedToMap,
+                       "Subscriber is already registered");
+    return std::unexpected(fail_info);
+  }
+
+  const uint64_t event_mask = static_cast<uint64_t>(subscriber->GetEventMask());
+  if (!IsValidEventMask(subscriber->GetEventMask())) {
+    FailInfo fail_info(FailMode::NonExistentEnumValue,
+                       "Subscriber event mask must hold at least one event "
+                       "type and no unknown bits");
+    return std::unexpected(fail_info);
+  }
+
+  // reuse a free slot where possible
+  uint32_t slot_index;
+  if (m_free_slots.empty()) {
+    slot_index = static_cast<uint32_t>(m_subscriber_slots.size());
+    m_subscriber_slots.emplace_back();
+  } else {
+    slot_index = m_free_slots.back();
+    m_free_slots.pop_back();
+  }
+
+  SubscriberSlot &slot = m_subscriber_slots[slot_index];
+  slot.subscriber = subscriber.get();
+  const SubscriberHandle handle{slot_index, slot.generation};
+
+  subscriber->m_event_handler = this;
+  subscriber->m_handle = handle;
+
+  // add to the dispatch list of every event type in the mask, bucketed by
+  // trigger key where there is one
+  const std::optional<uint64_t> &trigger_key =
+      subscriber->GetTriggerMatcher().GetKey();
+  for (uint64_t remaining_bits = event_mask; remaining_bits != 0;
+       remaining_bits &= remaining_bits - 1) {
+    const size_t event_type_index =
+        static_cast<size_t>(std::countr_zero(remaining_bits));
+    DispatchList &dispatch_list = m_dispatch_table[event_type_index];
+
+    if (trigger_key) {
+      dispatch_list.keyed_entries[trigger_key.value()].push_back(
+          {subscriber.get(), handle});
+    } else {
+      dispatch_list.unkeyed_entries.push_back({subscriber.get(), handle});
+    }
+  }
+  m_subscribed_event_mask |= event_mask;
+  ++m_subscriber_count;
+
+  return std::monostate{};
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+EventHandler::DeregisterSubscriber(const SubscriberHandle &handle) {
+
+  if (!IsSubscriberValid(handle)) {
+    FailInfo fail_info(FailMode::StaleHandle,
+                       "SubscriberHandle does not point at a registered "
+                       "Subscriber");
+    return std::unexpected(fail_info);
+  }
+
+  SubscriberSlot &slot = m_subscriber_slots[handle.index];
+  const uint64_t event_mask =
+      static_cast<uint64_t>(slot.subscriber->GetEventMask());
+
+  slot.subscriber->m_event_handler = nullptr;
+  slot.subscriber = nullptr;
+  ++slot.generation;
+  m_free_slots.push_back(handle.index);
+  --m_subscriber_count;
+
+  // the dispatch entries are left in place until the lists are next compacted
+  m_stale_dispatch_lists |= event_mask;
 
   return std::monostate{};
 }
+
+/////////////////////////////////////////////////
+bool EventHandler::IsSubscriberValid(const SubscriberHandle &handle) const {
+  return handle.index < m_subscriber_slots.size() &&
+         m_subscriber_slots[handle.index].subscriber &&
+         m_subscriber_slots[handle.index].generation == handle.generation;
+}
+
+/////////////////////////////////////////////////
+void EventHandler::CompactDispatchTable() {
+
+  while (m_stale_dispatch_lists != 0) {
+    const size_t event_type_index =
+        static_cast<size_t>(std::countr_zero(m_stale_dispatch_lists));
+    m_stale_dispatch_lists &= m_stale_dispatch_lists - 1;
+
+    auto is_stale = [this](const DispatchEntry &entry) {
+      return !IsSubscriberValid(entry.handle);
+    };
+
+    DispatchList &dispatch_list = m_dispatch_table[event_type_index];
+    std::erase_if(dispatch_list.unkeyed_entries, is_stale);
+    for (auto bucket = dispatch_list.keyed_entries.begin();
+         bucket != dispatch_list.keyed_entries.end();) {
+      std::erase_if(bucket->second, is_stale);
+      if (bucket->second.empty()) {
+        bucket = dispatch_list.keyed_entries.erase(bucket);
+      } else {
+        ++bucket;
+      }
+    }
+
+    if (dispatch_list.empty()) {
+      m_subscribed_event_mask &= ~(uint64_t{1} << event_type_index);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+size_t EventHandler::GetSubscriberCount() const { return m_subscriber_count; }
+
+/////////////////////////////////////////////////
+size_t EventHandler::GetSubscriberCount(const EventType event_type) const {
+
+  auto index_result = GetEventTypeIndex(event_type);
+  if (!index_result.has_value()) {
+    return 0;
+  }
+  auto count_valid = [this](const std::vector<DispatchEntry> &entries) {
+    return static_cast<size_t>(std::count_if(
+        entries.begin(), entries.end(), [this](const DispatchEntry &entry) {
+          return IsSubscriberValid(entry.handle);
+        }));
+  };
+
+  const DispatchList &dispatch_list = m_dispatch_table[index_result.value()];
+  size_t subscriber_count = count_valid(dispatch_list.unkeyed_entries);
+  for (const auto &[trigger_key, entries] : dispatch_list.keyed_entries) {
+    subscriber_count += count_valid(entries);
+  }
+  return subscriber_count;
+}
+
+/////////////////////////////////////////////////
+std::expected<size_t, FailInfo> GetEventTypeIndex(const EventType event_type) {
+
+  const uint64_t event_type_bits = static_cast<uint64_t>(event_type);
+  if (!std::has_single_bit(event_type_bits) ||
+      event_type_bits > static_cast<uint64_t>(EventType::EventType_ANY)) {
+    FailInfo fail_info(FailMode::NonExistentEnumValue,
+                       "EventType must be a single event type");
+    return std::unexpected(fail_info);
+  }
+  return static_cast<size_t>(std::countr_zero(event_type_bits));
+}
+
+/////////////////////////////////////////////////
+bool IsValidEventMask(const EventType event_mask) {
+  const uint64_t event_mask_bits = static_cast<uint64_t>(event_mask);
+  return event_mask_bits != 0 &&
+         (event_mask_bits & ~static_cast<uint64_t>(EventType::EventType_ANY)) ==
+             0;
+}
+
+/////////////////////////////////////////////////
+EventType GetEventMask(const EventBus &event_bus) {
+  uint64_t event_mask{0};
+  for (const auto &event : event_bus) {
+    event_mask |= static_cast<uint64_t>(event.m_event_type);
+  }
+  return static_cast<EventType>(event_mask);
+}
+/////////////////////////////////////////////////
+void EventHandler::PreloadEvents(const InputState &input_state,
+                                 const sf::Vector2i &mouse_position) {
+
+  // where the clicks land is part of the input
+  if (m_event_recorder) {
+    m_event_recorder->RecordMousePosition(mouse_position);
+  }
+
+  // held inputs are left to polling, only changes are published
+  if (!input_state.HasEdges()) {
+    return;
+  }
+
+  // a UserInputEvent (lifetime of 1) for the waiting room event bus
+  EventPacket user_input_event{EventType::EventType_EVENT_USER_INPUT,
+                               input_state.GetEdges()};
+
+  STEAMROT_LOG_TRACE(
+      LogChannel::Events, "user input event inputs={}",
+      std::get<UserInputBitset>(user_input_event.m_event_data).to_string());
+
+  if (m_event_recorder) {
+    m_event_recorder->Record(user_input_event);
+  }
+  AddEvent(std::move(user_input_event));
+}
+
 /////////////////////////////////////////////////
-void EventHandler::PreloadEvents(sf::RenderWindow &window) {
+void EventHandler::PreloadEvents(EventReplay &event_replay,
+                                 size_t loop_number, InputState &input_state,
+                                 sf::Vector2i &mouse_position) {
+
+  // set every tick, the window would otherwise move it back to the real mouse
+  if (const auto recorded_position =
+          event_replay.GetMousePositionAt(loop_number)) {
+    mouse_position = *recorded_position;
+  }
 
-  // handle SMFL events and pass to the waiting room event bus
-  HandleSFMLEvents(window, *this);
+  for (const RecordedEvent &recorded_event :
+       event_replay.TakeEventsUpTo(loop_number)) {
+
+    // recorded input is published, and recorded, by the next snapshot
+    if (const auto *user_input = std::get_if<UserInputBitset>(
+            &recorded_event.event.m_event_data)) {
+      input_state.ApplyUserInput(*user_input);
+      continue;
+    }
+
+    if (m_event_recorder) {
+      m_event_recorder->Record(recorded_event.event);
+    }
+    AddEvent(recorded_event.event);
+  }
+}
+
+/////////////////////////////////////////////////
+void EventHandler::SetEventRecorder(EventRecorder *event_recorder) {
+  m_event_recorder = event_recorder;
 }
 
 /////////////////////////////////////////////////
 void EventHandler::ProcessWaitingRoomEventBus() {
-  // add all events from the waiting room event bus to the global event bus
+  // bring in anything posted from jobs or other threads
+  MergeStagedEvents();
+
+  // add all events from the waiting room event bus to the global event bus,
+  // this leaves the waiting room event bus empty
   AddToGlobalEventBus(m_waiting_room_event_bus);
-  // clear the waiting room event bus
-  m_waiting_room_event_bus.clear();
 }
 /////////////////////////////////////////////////
-void EventHandler::AddToGlobalEventBus(const std::vector<EventPacket> &events) {
+void EventHandler::AddToGlobalEventBus(EventBus &events) {
+
+  m_present_event_mask |= static_cast<uint64_t>(GetEventMask(events));
+
+  if (m_global_event_bus.empty()) {
+    // nothing to keep, trade storage (each keeps its reserved capacity)
+    m_global_event_bus.swap(events);
+    return;
+  }
 
-  for (const auto &event : events) {
-    m_global_event_bus.push_back(event);
+  // events that outlived the last tick stay ahead of the new ones
+  for (auto &event : events) {
+    m_global_event_bus.push_back(std::move(event));
   }
+  events.clear();
 }
 /////////////////////////////////////////////////
 void EventHandler::TickGlobalEventBus() {
@@ -49,6 +314,9 @@ void EventHandler::TickGlobalEventBus() {
   DecrementEventLifetimes(m_global_event_bus);
   // remove all events with a lifetime of 0
   RemoveDeadEvents(m_global_event_bus);
+  // only the surviving events are still present
+  m_present_event_mask =
+      static_cast<uint64_t>(GetEventMask(m_global_event_bus));
 }
 
 /////////////////////////////////////////////////
@@ -58,85 +326,169 @@ const EventBus &EventHandler::GetGlobalEventBus() {
   return m_global_event_bus;
 }
 
+/////////////////////////////////////////////////
+EventType EventHandler::GetPresentEventMask() const {
+  return static_cast<EventType>(m_present_event_mask);
+}
+
 ////////////////////////////////////////////////////////////
-void HandleSFMLEvents(sf::RenderWindow &window, EventHandler &event_handler) {
+bool HandleSFMLEvents(sf::RenderWindow &window, InputState &input_state) {
 
-  // create a vector to hold user input events
-  std::vector<sf::Event> user_input_events;
+  bool close_requested{false};
 
   // poll events from the window
   while (const std::optional<sf::Event> event = window.pollEvent()) {
-    // add in ctrl + c to close the window
+    // escape quits, like the window's close button
     if (const auto *keyPressed = event->getIf<sf::Event::KeyPressed>()) {
       if (keyPressed->code == sf::Keyboard::Key::Escape)
-        window.close();
+        close_requested = true;
     } // if the event is a close event, set the close window flag to true
     if (event->is<sf::Event::Closed>()) {
-      window.close();
-    }
-    // handle keyboard and mouse events by adding to the user input events
-    // vector
-
-    if (event->is<sf::Event::KeyPressed>() ||
-        event->is<sf::Event::KeyReleased>() ||
-        event->is<sf::Event::MouseButtonPressed>() ||
-        event->is<sf::Event::MouseButtonReleased>()) {
-      user_input_events.push_back(*event);
+      close_requested = true;
     }
+    // keyboard and mouse events update the input state, it publishes them on
+    // its next snapshot
+    input_state.ApplyEvent(*event);
   }
 
-  // specifically handle keyboard and mouse events
-  if (!user_input_events.empty()) {
+  // Add other event types here as needed
+  return close_requested;
+}
 
-    // create a new event packet with a lifetime of 1
-    EventPacket event_packet(1);
+/////////////////////////////////////////////////
+void EventHandler::UpateSubscribersFromGlobalEventBus() {
+  // drop deregistered Subscribers so the lists stay short, the handles are
+  // still checked below in case one is deregistered during dispatch
+  CompactDispatchTable();
 
-    // set the event type to UserInputEvent
-    event_packet.m_event_type = EventType::EventType_EVENT_USER_INPUT;
+  // nothing on the bus has a subscriber
+  const uint64_t dispatch_mask = m_present_event_mask & m_subscribed_event_mask;
+  if (dispatch_mask == 0) {
+    return;
+  }
 
-    // create a UserInputBitset from the vector of hardware events
-    auto user_input_bitset = UserInputBitset{user_input_events};
+  // go through each event in the global event bus, in order, so the last
+  // matching event wins for Subscribers with several event types
+  for (const auto &event : m_global_event_bus) {
 
-    // set the event data to the UserInputBitset
-    event_packet.m_event_data = user_input_bitset;
+    const uint64_t event_type_bits = static_cast<uint64_t>(event.m_event_type);
+    if ((event_type_bits & dispatch_mask) == 0 ||
+        !std::has_single_bit(event_type_bits)) {
+      continue;
+    }
+
+    STEAMROT_LOG_TRACE(LogChannel::Events, "dispatching event type={}",
+                       EnumNameEventType(event.m_event_type));
 
-    std::cout << "User Input Event Packet Created " << std::endl;
-    std::cout << "UserInputBitset: " << user_input_bitset << std::endl;
+    const size_t event_type_index =
+        static_cast<size_t>(std::countr_zero(event_type_bits));
+    const DispatchList &dispatch_list = m_dispatch_table[event_type_index];
+
+    // subscribers that have to see every event of the type
+    for (const DispatchEntry &entry : dispatch_list.unkeyed_entries) {
+      if (IsSubscriberValid(entry.handle)) {
+        UpdateSubscriber(*entry.subscriber, event);
+      }
+    }
 
-    // add the event packet to the waiting room event bus
-    event_handler.AddEvent(event_packet);
+    // only the subscribers whose exact trigger can match the event
+    if (dispatch_list.keyed_entries.empty()) {
+      continue;
+    }
+    auto bucket =
+        dispatch_list.keyed_entries.find(GetTriggerKey(event.m_event_data));
+    if (bucket == dispatch_list.keyed_entries.end()) {
+      continue;
+    }
+    for (const DispatchEntry &entry : bucket->second) {
+      if (IsSubscriberValid(entry.handle)) {
+        UpdateSubscriber(*entry.subscriber, event);
+      }
+    }
   }
+}
+/////////////////////////////////////////////////
+void EventHandler::AddEvent(const EventPacket &event) { EmplaceEvent(event); }
 
-  // Add other event types here as needed
+/////////////////////////////////////////////////
+void EventHandler::AddEvent(EventPacket &&event) {
+  EmplaceEvent(std::move(event));
 }
 
 /////////////////////////////////////////////////
-const std::unordered_map<EventType, std::vector<std::weak_ptr<Subscriber>>> &
-EventHandler::GetSubcriberRegister() const {
-  return m_subscriber_register;
+bool EventHandler::CanAddDirectly() const {
+  return std::this_thread::get_id() == m_owner_thread_id &&
+         !JobSystem::IsRunningJob();
 }
 
 /////////////////////////////////////////////////
-void EventHandler::UpateSubscribersFromGlobalEventBus() {
-  // go through each event in the global event bus
-  for (const auto &event : m_global_event_bus) {
+EventStagingBuffer &EventHandler::GetStagingBuffer() {
 
-    std::cout << "Processing Event of type "
-              << EnumNameEventType(event.m_event_type) << std::endl;
-    if (m_subscriber_register.contains(event.m_event_type)) {
-      // go through each subscriber registered for the event type
-      for (auto &subscriber_weak :
-           m_subscriber_register.at(event.m_event_type)) {
+  // the common case of one EventHandler needs no lock after the first post
+  struct CachedStagingBuffer {
+    uint64_t instance_id{0};
+    EventStagingBuffer *staging_buffer{nullptr};
+  };
+  thread_local CachedStagingBuffer t_cached_staging_buffer;
 
-        // pass to the UpdateSubscriber function
-        UpdateSubscriber(subscriber_weak, event.m_event_data);
-      }
-    }
+  if (t_cached_staging_buffer.instance_id == m_instance_id) {
+    return *t_cached_staging_buffer.staging_buffer;
+  }
+
+  std::lock_guard<std::mutex> lock(m_staging_buffers_mutex);
+  const std::thread::id thread_id = std::this_thread::get_id();
+
+  auto found = std::find_if(
+      m_staging_buffers.begin(), m_staging_buffers.end(),
+      [thread_id](const std::unique_ptr<EventStagingBuffer> &staging_buffer) {
+        return staging_buffer->thread_id == thread_id;
+      });
+
+  EventStagingBuffer *staging_buffer;
+  if (found != m_staging_buffers.end()) {
+    staging_buffer = found->get();
+  } else {
+    m_staging_buffers.push_back(std::make_unique<EventStagingBuffer>());
+    staging_buffer = m_staging_buffers.back().get();
+    staging_buffer->thread_id = thread_id;
+    staging_buffer->events.reserve(kEventBusCapacity);
   }
+
+  t_cached_staging_buffer = {m_instance_id, staging_buffer};
+  return *staging_buffer;
 }
+
 /////////////////////////////////////////////////
-void EventHandler::AddEvent(const EventPacket &event) {
-  m_waiting_room_event_bus.push_back(event);
+void EventHandler::MergeStagedEvents() {
+
+  {
+    std::lock_guard<std::mutex> lock(m_staging_buffers_mutex);
+    for (auto &staging_buffer : m_staging_buffers) {
+      for (auto &staged_event : staging_buffer->events) {
+        m_merged_staged_events.push_back(std::move(staged_event));
+      }
+      staging_buffer->events.clear();
+      staging_buffer->next_sequence = 0;
+    }
+  }
+
+  if (m_merged_staged_events.empty()) {
+    return;
+  }
+
+  std::stable_sort(m_merged_staged_events.begin(),
+                   m_merged_staged_events.end(),
+                   [](const StagedEvent &lhs, const StagedEvent &rhs) {
+                     if (lhs.event.source_id != rhs.event.source_id) {
+                       return lhs.event.source_id < rhs.event.source_id;
+                     }
+                     return lhs.sequence < rhs.sequence;
+                   });
+
+  for (auto &staged_event : m_merged_staged_events) {
+    m_waiting_room_event_bus.push_back(std::move(staged_event.event));
+  }
+  m_merged_staged_events.clear();
 }
 
 /////////////////////////////////////////////////
@@ -163,26 +515,20 @@ void RemoveDeadEvents(EventBus &event_bus) {
 }
 
 /////////////////////////////////////////////////
-void UpdateSubscriber(std::weak_ptr<Subscriber> &subscriber,
-                      const EventData &event_data) {
-
-  auto locked_subscriber = subscriber.lock();
-  if (!locked_subscriber)
-    // if the Subscriber has expired, do nothing
-    return;
+void UpdateSubscriber(Subscriber &subscriber, const EventPacket &event) {
 
-  // if the Subscriber has trigger data compare against the event data
-  if (locked_subscriber->GetTriggerData() &&
-      (locked_subscriber->GetTriggerData().value() != event_data))
+  // compare the event data against the Subscriber's compiled trigger
+  if (!subscriber.GetTriggerMatcher().Matches(event.m_event_data))
     // if they do not match, do not update the subscriber
     return;
 
-  std::cout << "Updating Subscriber of type "
-            << EnumNameEventType(locked_subscriber->GetEventType());
+  STEAMROT_LOG_TRACE(LogChannel::Events, "updating subscriber type={}",
+                     EnumNameEventType(event.m_event_type));
   // update any releveant information for the subscriber
-  auto activate_result = locked_subscriber->SetActive();
+  auto activate_result = subscriber.SetActive();
 
-  // copy the event data to the subscriber
-  locked_subscriber->SetEventData(event_data);
+  // copy the event data and type to the subscriber
+  subscriber.SetEventData(event.m_event_data);
+  subscriber.SetTriggeredEventType(event.m_event_type);
 }
 } // namespace steamrot
@@ -8,24 +8,134 @@
 ////////////////////////////////////////////////////////////
 
 #include "EventPacket.h"
+#include "EventRecorder.h"
+#include "EventReplay.h"
+#include "InputState.h"
 #include "Subscriber.h"
 #include "events_generated.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace steamrot {
 
 using EventBus = std::vector<EventPacket>;
 
+/////////////////////////////////////////////////
+/// @brief Number of events each EventBus holds before it has to grow
+/////////////////////////////////////////////////
+constexpr size_t kEventBusCapacity = 256;
+
+/////////////////////////////////////////////////
+/// @brief Number of single bit EventTypes, one dispatch list each
+/////////////////////////////////////////////////
+constexpr size_t kEventTypeCount =
+    std::bit_width(static_cast<uint64_t>(EventType::EventType_ANY));
+
+/////////////////////////////////////////////////
+/// @class SubscriberSlot
+/// @brief A registered Subscriber and the current generation of its slot.
+///
+/////////////////////////////////////////////////
+struct SubscriberSlot {
+  /////////////////////////////////////////////////
+  /// @brief Registered Subscriber, nullptr while the slot is free
+  /////////////////////////////////////////////////
+  Subscriber *subscriber{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Bumped every time the slot is released
+  /////////////////////////////////////////////////
+  uint32_t generation{0};
+};
+
+/////////////////////////////////////////////////
+/// @class DispatchEntry
+/// @brief Entry in an EventType's dispatch list.
+///
+/// The Subscriber pointer is only followed once the handle has been checked
+/// against its slot.
+/////////////////////////////////////////////////
+struct DispatchEntry {
+  Subscriber *subscriber{nullptr};
+  SubscriberHandle handle;
+};
+
+/////////////////////////////////////////////////
+/// @class DispatchList
+/// @brief Subscribers of one EventType, bucketed by their trigger key.
+///
+/// An event only visits the unkeyed entries and the bucket of its own trigger
+/// key, so Subscribers with exact triggers that cannot match are never
+/// touched.
+/////////////////////////////////////////////////
+struct DispatchList {
+  /////////////////////////////////////////////////
+  /// @brief Subscribers without a trigger key, visited by every event
+  /////////////////////////////////////////////////
+  std::vector<DispatchEntry> unkeyed_entries;
+
+  /////////////////////////////////////////////////
+  /// @brief Subscribers with exact triggers, stored by trigger key
+  /////////////////////////////////////////////////
+  std::unordered_map<uint64_t, std::vector<DispatchEntry>> keyed_entries;
+
+  bool empty() const {
+    return unkeyed_entries.empty() && keyed_entries.empty();
+  }
+};
+
+/////////////////////////////////////////////////
+/// @class StagedEvent
+/// @brief An event posted from a job, waiting to be merged into the waiting
+/// room event bus.
+///
+/////////////////////////////////////////////////
+struct StagedEvent {
+  /////////////////////////////////////////////////
+  /// @brief Construct the EventPacket in place
+  ///
+  /// @param sequence Order the event was posted in on its thread
+  /// @param args Arguments forwarded to an EventPacket constructor
+  /////////////////////////////////////////////////
+  template <typename... Args>
+  explicit StagedEvent(uint64_t sequence, Args &&...args)
+      : event(std::forward<Args>(args)...), sequence(sequence) {}
+
+  EventPacket event;
+  uint64_t sequence;
+};
+
+/////////////////////////////////////////////////
+/// @class EventStagingBuffer
+/// @brief Events posted from jobs on one thread, only ever written by that
+/// thread.
+///
+/////////////////////////////////////////////////
+struct EventStagingBuffer {
+  std::thread::id thread_id;
+  std::vector<StagedEvent> events;
+  uint64_t next_sequence{0};
+};
+
 class EventHandler {
 private:
   /////////////////////////////////////////////////
   /// @brief EventBus from which Subscribers will be updated.
+  ///
+  /// The two buses are preallocated and trade storage rather than copying
+  /// events, so steady state event traffic never touches the allocator.
   /////////////////////////////////////////////////
   EventBus m_global_event_bus;
 
@@ -33,54 +143,257 @@ private:
   /// @brief  EventBus for collating all generated Events
   /////////////////////////////////////////////////
   EventBus m_waiting_room_event_bus;
+
+  /////////////////////////////////////////////////
+  /// @brief Thread that may add events straight to the waiting room, the one
+  /// that constructed the EventHandler
+  /////////////////////////////////////////////////
+  const std::thread::id m_owner_thread_id;
+
+  /////////////////////////////////////////////////
+  /// @brief Unique id of the EventHandler, lets each thread cache its staging
+  /// buffer without mistaking a new EventHandler at the same address
+  /////////////////////////////////////////////////
+  const uint64_t m_instance_id;
+
+  /////////////////////////////////////////////////
+  /// @brief Guards registration of staging buffers (not the buffers
+  /// themselves)
+  /////////////////////////////////////////////////
+  std::mutex m_staging_buffers_mutex;
+
+  /////////////////////////////////////////////////
+  /// @brief One staging buffer per thread that has posted from a job
+  /////////////////////////////////////////////////
+  std::vector<std::unique_ptr<EventStagingBuffer>> m_staging_buffers;
+
+  /////////////////////////////////////////////////
+  /// @brief Scratch space for ordering staged events, reused between ticks
+  /////////////////////////////////////////////////
+  std::vector<StagedEvent> m_merged_staged_events;
+
+  /////////////////////////////////////////////////
+  /// @brief Slot of every registered Subscriber, indexed by SubscriberHandle
+  /////////////////////////////////////////////////
+  std::vector<SubscriberSlot> m_subscriber_slots;
+
+  /////////////////////////////////////////////////
+  /// @brief Stack of free slot indexes, the next to hand out is at the back
+  /////////////////////////////////////////////////
+  std::vector<uint32_t> m_free_slots;
+
+  /////////////////////////////////////////////////
+  /// @brief Subscribers of each EventType, indexed by the EventType's bit
+  /// position
+  ///
+  /// A Subscriber with several EventTypes in its mask is in each of their
+  /// lists.
+  /////////////////////////////////////////////////
+  std::array<DispatchList, kEventTypeCount> m_dispatch_table;
+
+  /////////////////////////////////////////////////
+  /// @brief Bit per EventType with a non empty dispatch list
+  /////////////////////////////////////////////////
+  uint64_t m_subscribed_event_mask{0};
+
+  /////////////////////////////////////////////////
+  /// @brief EventTypes of every event on the global event bus, OR-ed together
+  /////////////////////////////////////////////////
+  uint64_t m_present_event_mask{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Bit per dispatch list that holds deregistered entries
+  /////////////////////////////////////////////////
+  uint64_t m_stale_dispatch_lists{0};
+
   /////////////////////////////////////////////////
-  /// @brief Register of all subscribers
+  /// @brief Number of currently registered Subscribers
   /////////////////////////////////////////////////
-  std::unordered_map<EventType, std::vector<std::weak_ptr<Subscriber>>>
-      m_subscriber_register;
+  size_t m_subscriber_count{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Records input events when set, not owned
+  /////////////////////////////////////////////////
+  EventRecorder *m_event_recorder{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Remove deregistered entries from every stale dispatch list
+  /////////////////////////////////////////////////
+  void CompactDispatchTable();
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the calling thread may add straight to the waiting room
+  /// event bus
+  ///
+  /// Anything posted from a job is staged, even on the owning thread, so the
+  /// order does not depend on which thread ran the job.
+  /////////////////////////////////////////////////
+  bool CanAddDirectly() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the calling thread's staging buffer, creating it on first
+  /// use
+  /////////////////////////////////////////////////
+  EventStagingBuffer &GetStagingBuffer();
+
+  /////////////////////////////////////////////////
+  /// @brief Move every staged event onto the waiting room event bus
+  ///
+  /// Staged events follow the events added directly, ordered by source_id and
+  /// then by the order they were posted in, so the result does not depend on
+  /// how jobs were spread over threads.
+  /////////////////////////////////////////////////
+  void MergeStagedEvents();
 
   /////////////////////////////////////////////////
   /// @brief Wrapper function to specifally to add to the global event bus.
   ///
-  /// @param events Vector of events to be added to the global event bus.
+  /// @param events Vector of events to be moved onto the global event bus, it
+  /// is left empty.
   /////////////////////////////////////////////////
-  void AddToGlobalEventBus(const std::vector<EventPacket> &events);
+  void AddToGlobalEventBus(EventBus &events);
 
 public:
   ////////////////////////////////////////////////////////////
-  // |brief default constructor
+  // |brief default constructor, preallocates both EventBuses
   ////////////////////////////////////////////////////////////
-  EventHandler() = default;
+  EventHandler();
+
+  /////////////////////////////////////////////////
+  /// @brief Destructor, detaches any Subscribers still registered
+  /////////////////////////////////////////////////
+  ~EventHandler();
+
+  /////////////////////////////////////////////////
+  /// @brief Subscribers point back at their EventHandler, so it cannot be
+  /// copied or moved
+  /////////////////////////////////////////////////
+  EventHandler(const EventHandler &) = delete;
+  EventHandler &operator=(const EventHandler &) = delete;
 
   /////////////////////////////////////////////////
   /// @brief store a subscriber in the event handler.
   ///
+  /// The EventHandler does not take ownership, the Subscriber deregisters
+  /// itself when destroyed. The Subscriber's event mask must hold at least
+  /// one EventType and nothing outside EventType_ANY.
+  ///
   /// @param subscriber Shared pointer to the subscriber to be registered.
   /////////////////////////////////////////////////
   std::expected<std::monostate, FailInfo>
   RegisterSubscriber(const std::shared_ptr<Subscriber> subscriber);
 
   /////////////////////////////////////////////////
-  /// @brief Handle all events pre Scene updates.
+  /// @brief Remove a subscriber from the event handler.
+  ///
+  /// Its dispatch entry is removed before the next dispatch.
+  ///
+  /// @param handle Handle of the subscriber to remove.
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  DeregisterSubscriber(const SubscriberHandle &handle);
+
+  /////////////////////////////////////////////////
+  /// @brief Check a handle still points at the subscriber it was created for
+  ///
+  /// @param handle Handle to check
+  /////////////////////////////////////////////////
+  bool IsSubscriberValid(const SubscriberHandle &handle) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Handle all events pre Scene updates, publishing a user input event
+  /// if the latest input snapshot pressed or released anything.
+  ///
+  /// Held inputs publish nothing, Logic that needs them polls the InputState.
+  ///
+  /// @param input_state Input state, snapshotted for the coming tick
+  /// @param mouse_position Mouse position the coming tick sees, only used by
+  /// the EventRecorder
+  /////////////////////////////////////////////////
+  void PreloadEvents(const InputState &input_state,
+                     const sf::Vector2i &mouse_position);
+
+  /////////////////////////////////////////////////
+  /// @brief Apply the recorded events due by a loop number, in place of the
+  /// window's events.
+  ///
+  /// Recorded user input goes into the InputState, to be published on its
+  /// next snapshot, anything else is added as it is. The recorded mouse
+  /// position replaces the window's.
+  ///
+  /// @param event_replay Replay to take the events from
+  /// @param loop_number Current loop number
+  /// @param input_state Input state to apply recorded user input to
+  /// @param mouse_position Mouse position to set to the recorded one
   /////////////////////////////////////////////////
-  void PreloadEvents(sf::RenderWindow &window);
+  void PreloadEvents(EventReplay &event_replay, size_t loop_number,
+                     InputState &input_state, sf::Vector2i &mouse_position);
+
+  /////////////////////////////////////////////////
+  /// @brief Record every input event PreloadEvents adds
+  ///
+  /// @param event_recorder Recorder to use, must outlive the EventHandler or
+  /// be replaced first, nullptr stops recording
+  /////////////////////////////////////////////////
+  void SetEventRecorder(EventRecorder *event_recorder);
 
   /////////////////////////////////////////////////
   /// @brief Adds an event to the waiting room event bus.
   ///
+  /// Events posted from jobs or other threads are staged per thread, without
+  /// locking, and join the waiting room event bus at the next
+  /// ProcessWaitingRoomEventBus. The staging buffers are read there unlocked,
+  /// so nothing may be posting from another thread while it runs; in the game
+  /// loop every job batch has finished by then. Staged events are ordered by
+  /// source_id, events sharing one (including the nil id) keep each thread's
+  /// order but interleave between threads in an unspecified order.
+  ///
   /// @param event Newly created event to be added to the waiting room event
   /// bus.
   /////////////////////////////////////////////////
   void AddEvent(const EventPacket &event);
 
+  /////////////////////////////////////////////////
+  /// @brief Adds an event to the waiting room event bus.
+  ///
+  /// @param event Newly created event to be moved onto the waiting room event
+  /// bus.
+  /////////////////////////////////////////////////
+  void AddEvent(EventPacket &&event);
+
+  /////////////////////////////////////////////////
+  /// @brief Construct an event directly on the waiting room event bus.
+  ///
+  /// @param args Arguments forwarded to an EventPacket constructor.
+  /// @return Reference to the new event, valid until the next AddEvent.
+  /////////////////////////////////////////////////
+  template <typename... Args> EventPacket &EmplaceEvent(Args &&...args) {
+    if (CanAddDirectly()) {
+      return m_waiting_room_event_bus.emplace_back(std::forward<Args>(args)...);
+    }
+
+    EventStagingBuffer &staging_buffer = GetStagingBuffer();
+    return staging_buffer.events
+        .emplace_back(staging_buffer.next_sequence++,
+                      std::forward<Args>(args)...)
+        .event;
+  }
+
   /////////////////////////////////////////////////
   /// @brief Add all events from the waiting room event bus to the global event
   /// bus
+  ///
+  /// When the global event bus is empty, which is the case unless events
+  /// outlive a tick, the buses are simply swapped. Call from the owning thread
+  /// while no jobs are posting events.
   /////////////////////////////////////////////////
   void ProcessWaitingRoomEventBus();
 
   /////////////////////////////////////////////////
   /// @brief Update all subscribers based on the events in the global event bus.
+  ///
+  /// Returns straight away unless an event on the bus has a subscriber, and
+  /// events without subscribers are skipped with a single mask test.
   /////////////////////////////////////////////////
   void UpateSubscribersFromGlobalEventBus();
 
@@ -97,12 +410,49 @@ public:
   const EventBus &GetGlobalEventBus();
 
   /////////////////////////////////////////////////
-  /// @brief Return the subscriber register.
+  /// @brief Return the EventTypes of every event on the global event bus,
+  /// OR-ed together.
+  ///
+  /// Lets callers skip work for event types that did not fire this tick.
+  /////////////////////////////////////////////////
+  EventType GetPresentEventMask() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the number of registered subscribers.
+  /////////////////////////////////////////////////
+  size_t GetSubscriberCount() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the number of registered subscribers for an event type.
+  ///
+  /// Subscribers registered for several event types count towards each.
+  ///
+  /// @param event_type EventType to count subscribers for.
   /////////////////////////////////////////////////
-  const std::unordered_map<EventType, std::vector<std::weak_ptr<Subscriber>>> &
-  GetSubcriberRegister() const;
+  size_t GetSubscriberCount(const EventType event_type) const;
 };
 
+/////////////////////////////////////////////////
+/// @brief Return the dispatch table index of a single bit EventType.
+///
+/// @param event_type EventType to index, must have exactly one bit set.
+/////////////////////////////////////////////////
+std::expected<size_t, FailInfo> GetEventTypeIndex(const EventType event_type);
+
+/////////////////////////////////////////////////
+/// @brief Check an event mask holds at least one EventType and nothing else.
+///
+/// @param event_mask Event type, or OR-ed event types, to check.
+/////////////////////////////////////////////////
+bool IsValidEventMask(const EventType event_mask);
+
+/////////////////////////////////////////////////
+/// @brief Return the EventTypes of every event on an EventBus, OR-ed together.
+///
+/// @param event_bus EventBus to collect the EventTypes of.
+/////////////////////////////////////////////////
+EventType GetEventMask(const EventBus &event_bus);
+
 /////////////////////////////////////////////////
 /// @brief Decrement the lifetime of a single event by 1.
 ///
@@ -124,17 +474,21 @@ void RemoveDeadEvents(EventBus &event_bus);
 /////////////////////////////////////////////////
 /// @brief Update releveant informtion for a subscriber object
 ///
-/// @param subscriber Weak pointer to the subscriber to be updated.
+/// @param subscriber Subscriber to be updated.
+/// @param event Event of a type the subscriber is registered for.
 /////////////////////////////////////////////////
-void UpdateSubscriber(std::weak_ptr<Subscriber> &subscriber,
-                      const EventData &event_data);
+void UpdateSubscriber(Subscriber &subscriber, const EventPacket &event);
 
 /////////////////////////////////////////////////
-/// @brief Adapater function to turn SFML events into the game engine's event
-/// system.
+/// @brief Adapater function to turn SFML events into the game engine's input
+/// state.
+///
+/// The window is left open, the caller decides how to shut down when a close
+/// is requested.
 ///
 /// @param window Reference to the SFML window to poll events from.
-/// @param event_bus Reference to the event bus to add events to.
+/// @param input_state Reference to the input state to update.
+/// @return True if Escape was pressed or the window asked to be closed.
 /////////////////////////////////////////////////
-void HandleSFMLEvents(sf::RenderWindow &window, EventHandler &event_handler);
+bool HandleSFMLEvents(sf::RenderWindow &window, InputState &input_state);
 } // namespace steamrot
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "InternedString.h"
 #include "UserInputBitset.h"
 #include "events_generated.h"
 #include "scene_change_packet_generated.h"
@@ -17,7 +18,8 @@ namespace steamrot {
 
 using SceneChangePacket = std::pair<std::optional<uuids::uuid>, SceneType>;
 
-using UIElementName = std::string;
+// interned so EventPackets carrying a name never allocate when copied
+using UIElementName = InternedString;
 
 // all data types that can be used in an event packet (monostate to represent no
 // data)
@@ -0,0 +1,44 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the EventRecorder class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventRecorder.h"
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+EventRecorder::EventRecorder(const size_t &loop_number)
+    : m_loop_number(loop_number) {}
+
+/////////////////////////////////////////////////
+void EventRecorder::Record(const EventPacket &event) {
+  m_recording.events.push_back({m_loop_number, event});
+}
+
+/////////////////////////////////////////////////
+void EventRecorder::RecordMousePosition(const sf::Vector2i &mouse_position) {
+  // a still mouse only needs the position it stopped on
+  if (!m_recording.mouse_positions.empty() &&
+      m_recording.mouse_positions.back().position == mouse_position) {
+    return;
+  }
+  m_recording.mouse_positions.push_back({m_loop_number, mouse_position});
+}
+
+/////////////////////////////////////////////////
+const EventRecording &EventRecorder::GetRecording() {
+  m_recording.end_loop_number = m_loop_number;
+  return m_recording;
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+EventRecorder::WriteToFile(const std::filesystem::path &recording_path) {
+  return WriteEventRecording(GetRecording(), recording_path);
+}
+
+} // namespace steamrot
@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the EventRecorder class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventPacket.h"
+#include "FailInfo.h"
+#include "event_recording.h"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <variant>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class EventRecorder
+/// @brief Records the input events entering the EventHandler, tagged with the
+/// loop number they arrived on.
+///
+/// Attach it with EventHandler::SetEventRecorder. Only input is recorded, the
+/// events the game raises in response follow from it and would be raised
+/// twice if they were replayed too. The mouse position is input as well, it is
+/// kept whenever it changes.
+/////////////////////////////////////////////////
+class EventRecorder {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Current loop number, owned by the GameEngine
+  /////////////////////////////////////////////////
+  const size_t &m_loop_number;
+
+  /////////////////////////////////////////////////
+  /// @brief Everything recorded so far
+  /////////////////////////////////////////////////
+  EventRecording m_recording;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for the EventRecorder
+  ///
+  /// @param loop_number Reference to the loop number events are tagged with
+  /////////////////////////////////////////////////
+  explicit EventRecorder(const size_t &loop_number);
+
+  /////////////////////////////////////////////////
+  /// @brief Record an event on the current loop number
+  ///
+  /// @param event Event to record
+  /////////////////////////////////////////////////
+  void Record(const EventPacket &event);
+
+  /////////////////////////////////////////////////
+  /// @brief Record the mouse position on the current loop number, if it moved
+  /// since the last one recorded
+  ///
+  /// @param mouse_position Mouse position the coming tick sees
+  /////////////////////////////////////////////////
+  void RecordMousePosition(const sf::Vector2i &mouse_position);
+
+  /////////////////////////////////////////////////
+  /// @brief Return the recording, ending on the current loop number
+  /////////////////////////////////////////////////
+  const EventRecording &GetRecording();
+
+  /////////////////////////////////////////////////
+  /// @brief Write the recording, ending on the current loop number
+  ///
+  /// @param recording_path Path of the file to write
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  WriteToFile(const std::filesystem::path &recording_path);
+};
+
+} // namespace steamrot
@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the EventReplay class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventReplay.h"
+#include <utility>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+EventReplay::EventReplay(EventRecording recording)
+    : m_recording(std::move(recording)) {}
+
+/////////////////////////////////////////////////
+std::span<const RecordedEvent>
+EventReplay::TakeEventsUpTo(size_t loop_number) {
+
+  const size_t first_event = m_next_event;
+  while (m_next_event < m_recording.events.size() &&
+         m_recording.events[m_next_event].loop_number <= loop_number) {
+    ++m_next_event;
+  }
+  return std::span<const RecordedEvent>{m_recording.events}.subspan(
+      first_event, m_next_event - first_event);
+}
+
+/////////////////////////////////////////////////
+std::optional<sf::Vector2i>
+EventReplay::GetMousePositionAt(size_t loop_number) {
+
+  const auto &mouse_positions = m_recording.mouse_positions;
+  while (m_next_mouse_position < mouse_positions.size() &&
+         mouse_positions[m_next_mouse_position].loop_number <= loop_number) {
+    ++m_next_mouse_position;
+  }
+  if (m_next_mouse_position == 0) {
+    return std::nullopt;
+  }
+  return mouse_positions[m_next_mouse_position - 1].position;
+}
+
+/////////////////////////////////////////////////
+bool EventReplay::IsFinished(size_t loop_number) const {
+  return loop_number >= m_recording.end_loop_number;
+}
+
+/////////////////////////////////////////////////
+size_t EventReplay::GetEndLoopNumber() const {
+  return m_recording.end_loop_number;
+}
+
+} // namespace steamrot
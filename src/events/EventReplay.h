@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the EventReplay class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "event_recording.h"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class EventReplay
+/// @brief Hands back the events of a recording on the loop numbers they were
+/// recorded on.
+///
+/// Feed it to EventHandler::PreloadEvents once per tick, a headless run then
+/// sees exactly the input of the recorded session.
+/////////////////////////////////////////////////
+class EventReplay {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Recording being replayed
+  /////////////////////////////////////////////////
+  EventRecording m_recording;
+
+  /////////////////////////////////////////////////
+  /// @brief Index of the next event to hand back
+  /////////////////////////////////////////////////
+  size_t m_next_event{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Index of the first mouse position not reached yet
+  /////////////////////////////////////////////////
+  size_t m_next_mouse_position{0};
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for the EventReplay
+  ///
+  /// @param recording Recording to replay, ordered by loop number
+  /////////////////////////////////////////////////
+  explicit EventReplay(EventRecording recording);
+
+  /////////////////////////////////////////////////
+  /// @brief Return the events recorded up to and including a loop number that
+  /// have not been handed back yet
+  ///
+  /// @param loop_number Current loop number
+  /////////////////////////////////////////////////
+  std::span<const RecordedEvent> TakeEventsUpTo(size_t loop_number);
+
+  /////////////////////////////////////////////////
+  /// @brief Return the mouse position recorded last up to and including a loop
+  /// number, nullopt before the first one
+  ///
+  /// @param loop_number Current loop number, never less than the last one
+  /////////////////////////////////////////////////
+  std::optional<sf::Vector2i> GetMousePositionAt(size_t loop_number);
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the recorded session had ended by a loop number, no tick
+  /// ran on the loop number it ended on
+  ///
+  /// @param loop_number Current loop number
+  /////////////////////////////////////////////////
+  bool IsFinished(size_t loop_number) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the loop number the recorded session ended on
+  /////////////////////////////////////////////////
+  size_t GetEndLoopNumber() const;
+};
+
+} // namespace steamrot
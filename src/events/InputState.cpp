@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the InputState class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "InputState.h"
+
+namespace steamrot {
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief Test one input of a set, false when the input has no bit
+/////////////////////////////////////////////////
+bool TestInput(const InputBits &inputs, std::optional<size_t> input_index) {
+  return input_index && inputs.test(*input_index);
+}
+} // namespace
+
+/////////////////////////////////////////////////
+std::optional<size_t> InputState::GetInputIndex(sf::Keyboard::Key key) {
+  const auto key_index = static_cast<int>(key);
+  if (key_index < 0 ||
+      static_cast<size_t>(key_index) >= sf::Keyboard::KeyCount) {
+    return std::nullopt;
+  }
+  return static_cast<size_t>(key_index);
+}
+
+/////////////////////////////////////////////////
+std::optional<size_t> InputState::GetInputIndex(sf::Mouse::Button button) {
+  const auto button_index = static_cast<int>(button);
+  if (button_index < 0 ||
+      static_cast<size_t>(button_index) >= sf::Mouse::ButtonCount) {
+    return std::nullopt;
+  }
+  return sf::Keyboard::KeyCount + static_cast<size_t>(button_index);
+}
+
+/////////////////////////////////////////////////
+void InputState::Press(size_t input_index) {
+  m_live.set(input_index);
+  m_pressed_since_snapshot.set(input_index);
+}
+
+/////////////////////////////////////////////////
+void InputState::Release(size_t input_index) { m_live.reset(input_index); }
+
+/////////////////////////////////////////////////
+bool InputState::ApplyEvent(const sf::Event &event) {
+
+  std::optional<size_t> input_index;
+  bool pressed{false};
+
+  if (const auto *key_pressed = event.getIf<sf::Event::KeyPressed>()) {
+    input_index = GetInputIndex(key_pressed->code);
+    pressed = true;
+
+  } else if (const auto *key_released =
+                 event.getIf<sf::Event::KeyReleased>()) {
+    input_index = GetInputIndex(key_released->code);
+
+  } else if (const auto *mouse_pressed =
+                 event.getIf<sf::Event::MouseButtonPressed>()) {
+    input_index = GetInputIndex(mouse_pressed->button);
+    pressed = true;
+
+  } else if (const auto *mouse_released =
+                 event.getIf<sf::Event::MouseButtonReleased>()) {
+    input_index = GetInputIndex(mouse_released->button);
+
+  } else {
+    if (event.is<sf::Event::FocusLost>()) {
+      m_live.reset();
+    }
+    return false;
+  }
+
+  if (input_index) {
+    pressed ? Press(*input_index) : Release(*input_index);
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+void InputState::ApplyUserInput(const UserInputBitset &user_input) {
+
+  for (size_t key = 0; key < sf::Keyboard::KeyCount; key++) {
+    if (user_input.test(key)) {
+      Press(key);
+    }
+  }
+  for (size_t button = 0; button < sf::Mouse::ButtonCount; button++) {
+    if (user_input.test(kKeyboardBits + button)) {
+      Press(sf::Keyboard::KeyCount + button);
+    }
+  }
+
+  for (size_t key = 0; key < sf::Keyboard::KeyCount; key++) {
+    if (user_input.test(sf::Keyboard::KeyCount + key)) {
+      Release(key);
+    }
+  }
+  for (size_t button = 0; button < sf::Mouse::ButtonCount; button++) {
+    if (user_input.test(kKeyboardBits + sf::Mouse::ButtonCount + button)) {
+      Release(sf::Keyboard::KeyCount + button);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void InputState::Snapshot() {
+  m_previous = m_current;
+  // a tap released before the snapshot is still down for this one
+  m_current = m_live | m_pressed_since_snapshot;
+  m_pressed_since_snapshot.reset();
+}
+
+/////////////////////////////////////////////////
+bool InputState::HasEdges() const { return (m_current ^ m_previous).any(); }
+
+/////////////////////////////////////////////////
+UserInputBitset InputState::GetEdges() const {
+
+  const InputBits pressed = GetPressed();
+  const InputBits released = GetReleased();
+
+  UserInputBitset edges;
+  for (size_t key = 0; key < sf::Keyboard::KeyCount; key++) {
+    if (pressed.test(key)) {
+      edges.set(key);
+    }
+    if (released.test(key)) {
+      edges.set(sf::Keyboard::KeyCount + key);
+    }
+  }
+  for (size_t button = 0; button < sf::Mouse::ButtonCount; button++) {
+    const size_t input_index = sf::Keyboard::KeyCount + button;
+    if (pressed.test(input_index)) {
+      edges.set(kKeyboardBits + button);
+    }
+    if (released.test(input_index)) {
+      edges.set(kKeyboardBits + sf::Mouse::ButtonCount + button);
+    }
+  }
+  return edges;
+}
+
+/////////////////////////////////////////////////
+const InputBits &InputState::GetDown() const { return m_current; }
+
+/////////////////////////////////////////////////
+InputBits InputState::GetPressed() const { return m_current & ~m_previous; }
+
+/////////////////////////////////////////////////
+InputBits InputState::GetReleased() const { return m_previous & ~m_current; }
+
+/////////////////////////////////////////////////
+InputBits InputState::GetHeld() const { return m_current & m_previous; }
+
+/////////////////////////////////////////////////
+bool InputState::IsDown(sf::Keyboard::Key key) const {
+  return TestInput(m_current, GetInputIndex(key));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsDown(sf::Mouse::Button button) const {
+  return TestInput(m_current, GetInputIndex(button));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsPressed(sf::Keyboard::Key key) const {
+  return TestInput(GetPressed(), GetInputIndex(key));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsPressed(sf::Mouse::Button button) const {
+  return TestInput(GetPressed(), GetInputIndex(button));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsReleased(sf::Keyboard::Key key) const {
+  return TestInput(GetReleased(), GetInputIndex(key));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsReleased(sf::Mouse::Button button) const {
+  return TestInput(GetReleased(), GetInputIndex(button));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsHeld(sf::Keyboard::Key key) const {
+  return TestInput(GetHeld(), GetInputIndex(key));
+}
+
+/////////////////////////////////////////////////
+bool InputState::IsHeld(sf::Mouse::Button button) const {
+  return TestInput(GetHeld(), GetInputIndex(button));
+}
+
+} // namespace steamrot
@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the InputState class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UserInputBitset.h"
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <bitset>
+#include <cstddef>
+#include <optional>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief One bit per key, then one per mouse button
+/////////////////////////////////////////////////
+constexpr size_t kInputCount = sf::Keyboard::KeyCount + sf::Mouse::ButtonCount;
+
+using InputBits = std::bitset<kInputCount>;
+
+/////////////////////////////////////////////////
+/// @class InputState
+/// @brief Which keys and mouse buttons are down, snapshotted once per tick.
+///
+/// Window events update the live state as they arrive. Snapshot moves the
+/// current state to previous and the live state to current, so every Logic in
+/// a tick sees the same input, and pressed, released and held are each one
+/// bitwise operation over the two snapshots. A key pressed and released
+/// between two snapshots still shows as pressed for one tick.
+/////////////////////////////////////////////////
+class InputState {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Inputs down right now, as far as the events so far say
+  /////////////////////////////////////////////////
+  InputBits m_live;
+
+  /////////////////////////////////////////////////
+  /// @brief Inputs pressed since the last snapshot, so taps are not lost
+  /////////////////////////////////////////////////
+  InputBits m_pressed_since_snapshot;
+
+  /////////////////////////////////////////////////
+  /// @brief Inputs down at the latest snapshot
+  /////////////////////////////////////////////////
+  InputBits m_current;
+
+  /////////////////////////////////////////////////
+  /// @brief Inputs down at the snapshot before
+  /////////////////////////////////////////////////
+  InputBits m_previous;
+
+  /////////////////////////////////////////////////
+  /// @brief Mark an input as down in the live state
+  /////////////////////////////////////////////////
+  void Press(size_t input_index);
+
+  /////////////////////////////////////////////////
+  /// @brief Mark an input as up in the live state
+  /////////////////////////////////////////////////
+  void Release(size_t input_index);
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Return the bit of a key, std::nullopt for Unknown
+  /////////////////////////////////////////////////
+  static std::optional<size_t> GetInputIndex(sf::Keyboard::Key key);
+
+  /////////////////////////////////////////////////
+  /// @brief Return the bit of a mouse button
+  /////////////////////////////////////////////////
+  static std::optional<size_t> GetInputIndex(sf::Mouse::Button button);
+
+  /////////////////////////////////////////////////
+  /// @brief Update the live state from a window event
+  ///
+  /// Losing focus releases everything, the window will not hear the releases.
+  ///
+  /// @param event Event to apply
+  /// @return False if the event is not keyboard or mouse button input
+  /////////////////////////////////////////////////
+  bool ApplyEvent(const sf::Event &event);
+
+  /////////////////////////////////////////////////
+  /// @brief Update the live state from a user input event, as published by an
+  /// earlier run, presses first
+  ///
+  /// @param user_input Pressed and released inputs to apply
+  /////////////////////////////////////////////////
+  void ApplyUserInput(const UserInputBitset &user_input);
+
+  /////////////////////////////////////////////////
+  /// @brief Take the live state as the state of a new tick
+  /////////////////////////////////////////////////
+  void Snapshot();
+
+  /////////////////////////////////////////////////
+  /// @brief Check if any input was pressed or released at the last snapshot
+  /////////////////////////////////////////////////
+  bool HasEdges() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the inputs pressed and released at the last snapshot, in
+  /// the layout of a user input event
+  /////////////////////////////////////////////////
+  UserInputBitset GetEdges() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the inputs down at the last snapshot
+  /////////////////////////////////////////////////
+  const InputBits &GetDown() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the inputs that went down at the last snapshot
+  /////////////////////////////////////////////////
+  InputBits GetPressed() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the inputs that went up at the last snapshot
+  /////////////////////////////////////////////////
+  InputBits GetReleased() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the inputs down at both of the last two snapshots
+  /////////////////////////////////////////////////
+  InputBits GetHeld() const;
+
+  bool IsDown(sf::Keyboard::Key key) const;
+  bool IsDown(sf::Mouse::Button button) const;
+  bool IsPressed(sf::Keyboard::Key key) const;
+  bool IsPressed(sf::Mouse::Button button) const;
+  bool IsReleased(sf::Keyboard::Key key) const;
+  bool IsReleased(sf::Mouse::Button button) const;
+  bool IsHeld(sf::Keyboard::Key key) const;
+  bool IsHeld(sf::Mouse::Button button) const;
+};
+
+} // namespace steamrot
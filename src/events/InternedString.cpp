@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the InternedString class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "InternedString.h"
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+
+namespace steamrot {
+
+namespace {
+
+/////////////////////////////////////////////////
+/// @brief Hash allowing the string table to be searched with a string_view
+/////////////////////////////////////////////////
+struct StringTableHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view text) const {
+    return std::hash<std::string_view>{}(text);
+  }
+};
+
+using StringTable =
+    std::unordered_set<std::string, StringTableHash, std::equal_to<>>;
+
+/////////////////////////////////////////////////
+/// @brief Guards the string table
+/////////////////////////////////////////////////
+std::mutex &GetStringTableMutex() {
+  static std::mutex string_table_mutex;
+  return string_table_mutex;
+}
+
+/////////////////////////////////////////////////
+/// @brief Every interned string, nodes never move so pointers stay valid
+/////////////////////////////////////////////////
+StringTable &GetStringTable() {
+  static StringTable string_table;
+  return string_table;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////
+const std::string *InternedString::Intern(std::string_view text) {
+  std::lock_guard<std::mutex> lock(GetStringTableMutex());
+
+  StringTable &string_table = GetStringTable();
+  auto found = string_table.find(text);
+  if (found == string_table.end()) {
+    found = string_table.emplace(text).first;
+  }
+  return &*found;
+}
+
+/////////////////////////////////////////////////
+InternedString::InternedString() : m_string(Intern({})) {}
+
+/////////////////////////////////////////////////
+InternedString::InternedString(std::string_view text)
+    : m_string(Intern(text)) {}
+
+/////////////////////////////////////////////////
+const std::string &InternedString::Get() const { return *m_string; }
+
+/////////////////////////////////////////////////
+size_t InternedString::GetInternedCount() {
+  std::lock_guard<std::mutex> lock(GetStringTableMutex());
+  return GetStringTable().size();
+}
+
+} // namespace steamrot
@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the InternedString class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class InternedString
+/// @brief Handle to a string stored once in a global string table.
+///
+/// Interning a string allocates only the first time that text is seen, after
+/// that copying, comparing and hashing an InternedString is a pointer
+/// operation. Strings stay interned for the lifetime of the program, so only
+/// intern names drawn from a bounded set (UI element names, ids from data).
+/////////////////////////////////////////////////
+class InternedString {
+private:
+  /////////////////////////////////////////////////
+  /// @brief The interned text, owned by the string table
+  /////////////////////////////////////////////////
+  const std::string *m_string;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the table entry for text, adding it if needed
+  ///
+  /// @param text Text to intern
+  /////////////////////////////////////////////////
+  static const std::string *Intern(std::string_view text);
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for an empty InternedString
+  /////////////////////////////////////////////////
+  InternedString();
+
+  /////////////////////////////////////////////////
+  /// @brief Constructor interning text
+  ///
+  /// @param text Text to intern
+  /////////////////////////////////////////////////
+  explicit InternedString(std::string_view text);
+
+  /////////////////////////////////////////////////
+  /// @brief Return the interned text
+  /////////////////////////////////////////////////
+  const std::string &Get() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the number of distinct strings interned so far
+  /////////////////////////////////////////////////
+  static size_t GetInternedCount();
+
+  /////////////////////////////////////////////////
+  /// @brief Equal InternedStrings share the same table entry
+  /////////////////////////////////////////////////
+  bool operator==(const InternedString &) const = default;
+};
+
+} // namespace steamrot
@@ -7,6 +7,7 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "Subscriber.h"
+#include "EventHandler.h"
 #include "FailInfo.h"
 #include <expected>
 #include <variant>
@@ -14,17 +15,39 @@
 namespace steamrot {
 
 /////////////////////////////////////////////////
-Subscriber::Subscriber(const EventType event_type)
-    : m_event_type(event_type) {};
+Subscriber::Subscriber(const EventType event_mask)
+    : m_event_mask(event_mask) {};
 
 /////////////////////////////////////////////////
-Subscriber::Subscriber(const EventType event_type,
-                       const EventData &trigger_data)
-    : m_event_type(event_type), m_trigger_data(trigger_data) {};
+Subscriber::Subscriber(const EventType event_mask,
+                       const EventData &trigger_data, TriggerMode trigger_mode)
+    : m_event_mask(event_mask), m_trigger_data(trigger_data),
+      m_trigger_matcher(trigger_data, trigger_mode) {};
+
+/////////////////////////////////////////////////
+Subscriber::Subscriber(const Subscriber &other)
+    : m_active(other.m_active), m_event_mask(other.m_event_mask),
+      m_triggered_event_type(other.m_triggered_event_type),
+      m_trigger_data(other.m_trigger_data),
+      m_trigger_matcher(other.m_trigger_matcher),
+      m_event_data(other.m_event_data) {}
+
+/////////////////////////////////////////////////
+Subscriber::~Subscriber() {
+  if (m_event_handler) {
+    m_event_handler->DeregisterSubscriber(m_handle);
+  }
+}
+
+/////////////////////////////////////////////////
+bool Subscriber::IsRegistered() const { return m_event_handler != nullptr; }
+
+/////////////////////////////////////////////////
+const SubscriberHandle &Subscriber::GetHandle() const { return m_handle; }
 
 /////////////////////////////////////////////////
 std::pair<EventType, EventData> Subscriber::GetRegistrationInfo() const {
-  return {m_event_type, m_event_data};
+  return {m_event_mask, m_event_data};
 }
 
 /////////////////////////////////////////////////
@@ -58,7 +81,23 @@ void Subscriber::UpdateEventData(const EventData &new_event_data) {
 }
 
 /////////////////////////////////////////////////
-const EventType &Subscriber::GetEventType() const { return m_event_type; }
+const EventType &Subscriber::GetEventMask() const { return m_event_mask; }
+
+/////////////////////////////////////////////////
+bool Subscriber::IsSubscribedTo(const EventType event_type) const {
+  return (static_cast<uint64_t>(m_event_mask) &
+          static_cast<uint64_t>(event_type)) != 0;
+}
+
+/////////////////////////////////////////////////
+EventType Subscriber::GetTriggeredEventType() const {
+  return m_triggered_event_type;
+}
+
+/////////////////////////////////////////////////
+void Subscriber::SetTriggeredEventType(const EventType event_type) {
+  m_triggered_event_type = event_type;
+}
 
 /////////////////////////////////////////////////
 const EventData &Subscriber::GetEventData() const { return m_event_data; }
@@ -68,6 +107,11 @@ const std::optional<const EventData> &Subscriber::GetTriggerData() const {
   return m_trigger_data;
 }
 
+/////////////////////////////////////////////////
+const TriggerMatcher &Subscriber::GetTriggerMatcher() const {
+  return m_trigger_matcher;
+}
+
 /////////////////////////////////////////////////
 void Subscriber::SetEventData(const EventData &event_data) {
   m_event_data = event_data;
@@ -10,12 +10,37 @@
 
 #include "EventPacket.h"
 #include "FailInfo.h"
+#include "TriggerMatcher.h"
+#include <cstdint>
 #include <expected>
 #include <optional>
 #include <utility>
 #include <variant>
 namespace steamrot {
 
+class EventHandler;
+
+/////////////////////////////////////////////////
+/// @class SubscriberHandle
+/// @brief Versioned reference to a Subscriber's slot in an EventHandler.
+///
+/// The generation is bumped every time the slot is released, so a handle kept
+/// after its Subscriber was deregistered can be detected as stale.
+/////////////////////////////////////////////////
+struct SubscriberHandle {
+  /////////////////////////////////////////////////
+  /// @brief Index of the slot in the EventHandler
+  /////////////////////////////////////////////////
+  uint32_t index{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Generation of the slot when the handle was created
+  /////////////////////////////////////////////////
+  uint32_t generation{0};
+
+  bool operator==(const SubscriberHandle &) const = default;
+};
+
 /////////////////////////////////////////////////
 /// @class Subscriber
 /// @brief For registering with the EventHandler
@@ -23,8 +48,14 @@ namespace steamrot {
 /// This is deigned to be faily lightweight and does not handle any
 /// events/actions itself. It is simply toggled
 ///
+/// A Subscriber can listen to several EventTypes at once by OR-ing them into
+/// its event mask, it then records which of them activated it.
+///
+/// The EventHandler does not own its Subscribers, a registered Subscriber
+/// deregisters itself when it is destroyed.
 /////////////////////////////////////////////////
 struct Subscriber {
+  friend class EventHandler;
 
 private:
   /////////////////////////////////////////////////
@@ -33,9 +64,14 @@ private:
   bool m_active{false};
 
   /////////////////////////////////////////////////
-  /// @brief Used to register the subscriber with the EventHandler.
+  /// @brief Every EventType the subscriber is registered for, OR-ed together.
   /////////////////////////////////////////////////
-  const EventType m_event_type;
+  const EventType m_event_mask;
+
+  /////////////////////////////////////////////////
+  /// @brief EventType of the last event that activated the subscriber.
+  /////////////////////////////////////////////////
+  EventType m_triggered_event_type{EventType::EventType_NONE};
 
   /////////////////////////////////////////////////
   /// @brief If set, the subscriber will only be activated if the event data
@@ -43,24 +79,44 @@ private:
   /////////////////////////////////////////////////
   std::optional<const EventData> m_trigger_data{std::nullopt};
 
+  /////////////////////////////////////////////////
+  /// @brief The trigger data compiled for matching, matches anything when
+  /// there is no trigger data.
+  /////////////////////////////////////////////////
+  TriggerMatcher m_trigger_matcher;
+
   /////////////////////////////////////////////////
   /// @brief Used as a key to store the subscriber in the EventHandler.
   /////////////////////////////////////////////////
   EventData m_event_data;
 
+  /////////////////////////////////////////////////
+  /// @brief EventHandler the Subscriber is registered with, if any
+  /////////////////////////////////////////////////
+  EventHandler *m_event_handler{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Slot of the Subscriber in m_event_handler
+  /////////////////////////////////////////////////
+  SubscriberHandle m_handle;
+
 public:
   /////////////////////////////////////////////////
   /// @brief Constructor for the Subscriber class.
+  ///
+  /// @param event_mask Event type, or OR-ed event types, to register for.
   /////////////////////////////////////////////////
-  Subscriber(const EventType event_type);
+  Subscriber(const EventType event_mask);
 
   /////////////////////////////////////////////////
   /// @brief Constructor for the Subscriber class with trigger data.
   ///
-  /// @param event_type Event type to register for.
+  /// @param event_mask Event type, or OR-ed event types, to register for.
   /// @param trigger_data Event data that will trigger the subscriber.
+  /// @param trigger_mode How event data is compared against the trigger data.
   /////////////////////////////////////////////////
-  Subscriber(const EventType event_type, const EventData &trigger_data);
+  Subscriber(const EventType event_mask, const EventData &trigger_data,
+             TriggerMode trigger_mode = TriggerMode::Exact);
 
   /////////////////////////////////////////////////
   /// @brief Delete the default constructor to prevent instantiation without
@@ -68,6 +124,30 @@ public:
   /////////////////////////////////////////////////
   Subscriber() = delete;
 
+  /////////////////////////////////////////////////
+  /// @brief Copy the Subscriber's state, the copy starts unregistered
+  ///
+  /// @param other Subscriber to copy
+  /////////////////////////////////////////////////
+  Subscriber(const Subscriber &other);
+
+  /////////////////////////////////////////////////
+  /// @brief Destructor, deregisters the Subscriber from its EventHandler
+  /////////////////////////////////////////////////
+  ~Subscriber();
+
+  /////////////////////////////////////////////////
+  /// @brief Is the Subscriber registered with an EventHandler
+  /////////////////////////////////////////////////
+  bool IsRegistered() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the handle of the Subscriber's EventHandler slot.
+  ///
+  /// Only meaningful while IsRegistered.
+  /////////////////////////////////////////////////
+  const SubscriberHandle &GetHandle() const;
+
   /////////////////////////////////////////////////
   /// @brief Inspect the subscriber to see if it is active.
   ///
@@ -92,12 +172,32 @@ public:
   std::pair<EventType, EventData> GetRegistrationInfo() const;
 
   /////////////////////////////////////////////////
-  /// @brief Return a reference to the event type the subscriber is registered
-  /// for.
+  /// @brief Return a reference to the event types the subscriber is
+  /// registered for.
   ///
-  /// @return a reference to the event type.
+  /// @return a reference to the OR-ed event types.
   /////////////////////////////////////////////////
-  const EventType &GetEventType() const;
+  const EventType &GetEventMask() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the subscriber is registered for an event type.
+  ///
+  /// @param event_type Event type to check.
+  /////////////////////////////////////////////////
+  bool IsSubscribedTo(const EventType event_type) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the event type of the last event that activated the
+  /// subscriber.
+  /////////////////////////////////////////////////
+  EventType GetTriggeredEventType() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Record the event type that activated the subscriber.
+  ///
+  /// @param event_type Event type to record.
+  /////////////////////////////////////////////////
+  void SetTriggeredEventType(const EventType event_type);
 
   /////////////////////////////////////////////////
   /// @brief Return a reference to the event data for the subscriber.
@@ -111,6 +211,11 @@ public:
   /////////////////////////////////////////////////
   const std::optional<const EventData> &GetTriggerData() const;
 
+  /////////////////////////////////////////////////
+  /// @brief Return the compiled trigger for the subscriber.
+  /////////////////////////////////////////////////
+  const TriggerMatcher &GetTriggerMatcher() const;
+
   /////////////////////////////////////////////////
   /// @brief Copy the event data for the subscriber.
   ///
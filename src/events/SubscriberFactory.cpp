@@ -9,8 +9,8 @@
 #include "SubscriberFactory.h"
 #include "Subscriber.h"
 #include "event_helpers.h"
+#include "log_channel.h"
 #include "subscriber_config_generated.h"
-#include <iostream>
 #include <memory>
 
 namespace steamrot {
@@ -35,9 +35,10 @@ SubscriberFactory::CreateAndRegisterSubscriber(const EventType &event_type) {
 /////////////////////////////////////////////////
 std::expected<std::shared_ptr<Subscriber>, FailInfo>
 SubscriberFactory::CreateAndRegisterSubscriber(const EventType &event_type,
-                                               const EventData &trigger_data) {
+                                               const EventData &trigger_data,
+                                               TriggerMode trigger_mode) {
   std::shared_ptr<Subscriber> subscriber =
-      std::make_shared<Subscriber>(event_type, trigger_data);
+      std::make_shared<Subscriber>(event_type, trigger_data, trigger_mode);
   auto result = m_event_handler.RegisterSubscriber(subscriber);
   if (!result.has_value())
     return std::unexpected(result.error());
@@ -71,8 +72,9 @@ SubscriberFactory::CreateAndRegisterSubscriber(
 
     subscriber = std::make_shared<Subscriber>(event_type, trigger_data);
 
-    std::cout << "Created subscriber with trigger data for event type: "
-              << EnumNameEventType(event_type) << std::endl;
+    STEAMROT_LOG_DEBUG(LogChannel::Events,
+                       "created subscriber with trigger data type={}",
+                       EnumNameEventType(event_type));
     // if no trigger data, create subscriber without it
   } else {
 
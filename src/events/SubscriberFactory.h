@@ -65,9 +65,11 @@ public:
   ///
   /// @param event_type Reference to the EventType for the subscriber
   /// @param trigger_data Reference to the EventData for the subscriber trigger
+  /// @param trigger_mode How event data is compared against the trigger data
   /////////////////////////////////////////////////
   std::expected<std::shared_ptr<Subscriber>, FailInfo>
   CreateAndRegisterSubscriber(const EventType &event_type,
-                              const EventData &trigger_data);
+                              const EventData &trigger_data,
+                              TriggerMode trigger_mode = TriggerMode::Exact);
 };
 } // namespace steamrot
@@ -0,0 +1,130 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the TriggerMatcher class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "TriggerMatcher.h"
+#include <bitset>
+#include <functional>
+#include <type_traits>
+#include <variant>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+TriggerMatcher::TriggerMatcher(const EventData &trigger_data,
+                               TriggerMode trigger_mode) {
+
+  std::visit(
+      [this, trigger_mode](const auto &data) {
+        using DataType = std::decay_t<decltype(data)>;
+
+        if constexpr (std::is_same_v<DataType, std::monostate>) {
+          m_kind = Kind::NoData;
+
+        } else if constexpr (std::is_same_v<DataType, UserInputBitset>) {
+          m_inputs = data;
+          switch (trigger_mode) {
+          case TriggerMode::AnyOf:
+            m_kind = Kind::InputAnyOf;
+            break;
+          case TriggerMode::AllOf:
+            m_kind = Kind::InputAllOf;
+            break;
+          case TriggerMode::Exact:
+            m_kind = Kind::InputExact;
+            break;
+          }
+
+        } else if constexpr (std::is_same_v<DataType, SceneChangePacket>) {
+          m_kind = Kind::SceneChange;
+          m_scene_change = data;
+
+        } else if constexpr (std::is_same_v<DataType, UIElementName>) {
+          m_kind = Kind::Name;
+          m_name = data;
+        }
+      },
+      trigger_data);
+
+  // only exact comparisons can be bucketed
+  if (m_kind != Kind::InputAnyOf && m_kind != Kind::InputAllOf) {
+    m_key = GetTriggerKey(trigger_data);
+  }
+}
+
+/////////////////////////////////////////////////
+bool TriggerMatcher::Matches(const EventData &event_data) const {
+
+  switch (m_kind) {
+  case Kind::Always:
+    return true;
+
+  case Kind::NoData:
+    return std::holds_alternative<std::monostate>(event_data);
+
+  case Kind::InputExact: {
+    const auto *inputs = std::get_if<UserInputBitset>(&event_data);
+    return inputs && *inputs == m_inputs;
+  }
+
+  case Kind::InputAnyOf: {
+    const auto *inputs = std::get_if<UserInputBitset>(&event_data);
+    return inputs && (*inputs & m_inputs).any();
+  }
+
+  case Kind::InputAllOf: {
+    const auto *inputs = std::get_if<UserInputBitset>(&event_data);
+    return inputs && (*inputs & m_inputs) == m_inputs;
+  }
+
+  case Kind::SceneChange: {
+    const auto *scene_change = std::get_if<SceneChangePacket>(&event_data);
+    return scene_change && *scene_change == m_scene_change;
+  }
+
+  case Kind::Name: {
+    // interned, so this is a pointer comparison
+    const auto *name = std::get_if<UIElementName>(&event_data);
+    return name && *name == m_name;
+  }
+  }
+  return false;
+}
+
+/////////////////////////////////////////////////
+const std::optional<uint64_t> &TriggerMatcher::GetKey() const { return m_key; }
+
+/////////////////////////////////////////////////
+uint64_t GetTriggerKey(const EventData &event_data) {
+
+  const uint64_t data_key = std::visit(
+      [](const auto &data) -> uint64_t {
+        using DataType = std::decay_t<decltype(data)>;
+
+        if constexpr (std::is_same_v<DataType, std::monostate>) {
+          return 0;
+
+        } else if constexpr (std::is_same_v<DataType, UserInputBitset>) {
+          return std::hash<std::bitset<kTotalBits>>{}(data);
+
+        } else if constexpr (std::is_same_v<DataType, SceneChangePacket>) {
+          // the scene type narrows it down enough
+          return static_cast<uint64_t>(data.second);
+
+        } else if constexpr (std::is_same_v<DataType, UIElementName>) {
+          // every copy of an interned name shares its text
+          return std::hash<const void *>{}(&data.Get());
+        }
+      },
+      event_data);
+
+  // keep equal keys of different data types apart
+  return data_key ^ (static_cast<uint64_t>(event_data.index()) *
+                     0x9e3779b97f4a7c15ULL);
+}
+
+} // namespace steamrot
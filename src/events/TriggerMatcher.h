@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the TriggerMatcher class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventPacket.h"
+#include <cstdint>
+#include <optional>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief How a Subscriber's trigger data is compared against event data
+/////////////////////////////////////////////////
+enum class TriggerMode : uint8_t {
+  /////////////////////////////////////////////////
+  /// @brief Event data must equal the trigger data
+  /////////////////////////////////////////////////
+  Exact,
+
+  /////////////////////////////////////////////////
+  /// @brief Event input must hold at least one input of the trigger bitset
+  /////////////////////////////////////////////////
+  AnyOf,
+
+  /////////////////////////////////////////////////
+  /// @brief Event input must hold every input of the trigger bitset
+  /////////////////////////////////////////////////
+  AllOf,
+};
+
+/////////////////////////////////////////////////
+/// @class TriggerMatcher
+/// @brief A Subscriber's trigger data, compiled once into the comparison it
+/// needs.
+///
+/// Exact triggers also have a key, equal to GetTriggerKey of any event data
+/// they match, which lets the EventHandler bucket Subscribers so an event only
+/// visits the ones that can match it.
+/////////////////////////////////////////////////
+class TriggerMatcher {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Comparison the matcher was compiled into
+  /////////////////////////////////////////////////
+  enum class Kind : uint8_t {
+    Always,
+    NoData,
+    InputExact,
+    InputAnyOf,
+    InputAllOf,
+    SceneChange,
+    Name,
+  };
+
+  Kind m_kind{Kind::Always};
+
+  /////////////////////////////////////////////////
+  /// @brief Inputs compared against, for the Input kinds
+  /////////////////////////////////////////////////
+  UserInputBitset m_inputs;
+
+  /////////////////////////////////////////////////
+  /// @brief Scene change compared against, for the SceneChange kind
+  /////////////////////////////////////////////////
+  SceneChangePacket m_scene_change;
+
+  /////////////////////////////////////////////////
+  /// @brief Name compared against, for the Name kind
+  /////////////////////////////////////////////////
+  UIElementName m_name;
+
+  /////////////////////////////////////////////////
+  /// @brief Bucket key, set for exact comparisons only
+  /////////////////////////////////////////////////
+  std::optional<uint64_t> m_key{std::nullopt};
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for a matcher without trigger data, it matches any
+  /// event data
+  /////////////////////////////////////////////////
+  TriggerMatcher() = default;
+
+  /////////////////////////////////////////////////
+  /// @brief Compile trigger data into a matcher
+  ///
+  /// @param trigger_data Data the event data is compared against
+  /// @param trigger_mode How to compare, AnyOf and AllOf only apply to
+  /// UserInputBitset trigger data and fall back to Exact otherwise
+  /////////////////////////////////////////////////
+  TriggerMatcher(const EventData &trigger_data,
+                 TriggerMode trigger_mode = TriggerMode::Exact);
+
+  /////////////////////////////////////////////////
+  /// @brief Check if event data satisfies the trigger
+  ///
+  /// @param event_data Data of the event to check
+  /////////////////////////////////////////////////
+  bool Matches(const EventData &event_data) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Return the bucket key, std::nullopt when the matcher has to see
+  /// every event
+  /////////////////////////////////////////////////
+  const std::optional<uint64_t> &GetKey() const;
+};
+
+/////////////////////////////////////////////////
+/// @brief Return a key that is equal for equal event data
+///
+/// Unequal data can share a key, so a match still has to be confirmed.
+///
+/// @param event_data Data to key
+/////////////////////////////////////////////////
+uint64_t GetTriggerKey(const EventData &event_data);
+
+} // namespace steamrot
@@ -38,22 +38,31 @@ struct UserInputBitset : public std::bitset<kTotalBits> {
 
     // process each event
     for (const auto &event : events) {
-      if (const auto *keyPressed = event.getIf<sf::Event::KeyPressed>()) {
-        setKeyPressed(keyPressed->code);
+      setFromEvent(event);
+    }
+  }
+
+  // Set the bit for a single SFML event, returns false if it is not user input
+  bool setFromEvent(const sf::Event &event) {
+    if (const auto *keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+      setKeyPressed(keyPressed->code);
+
+    } else if (const auto *keyReleased =
+                   event.getIf<sf::Event::KeyReleased>()) {
+      setKeyReleased(keyReleased->code);
 
-      } else if (const auto *keyReleased =
-                     event.getIf<sf::Event::KeyReleased>()) {
-        setKeyReleased(keyReleased->code);
+    } else if (const auto *mouseButtonPressed =
+                   event.getIf<sf::Event::MouseButtonPressed>()) {
+      setMousePressed(mouseButtonPressed->button);
 
-      } else if (const auto *mouseButtonPressed =
-                     event.getIf<sf::Event::MouseButtonPressed>()) {
-        setMousePressed(mouseButtonPressed->button);
+    } else if (const auto *mouseButtonReleased =
+                   event.getIf<sf::Event::MouseButtonReleased>()) {
+      setMouseReleased(mouseButtonReleased->button);
 
-      } else if (const auto *mouseButtonReleased =
-                     event.getIf<sf::Event::MouseButtonReleased>()) {
-        setMouseReleased(mouseButtonReleased->button);
-      }
+    } else {
+      return false;
     }
+    return true;
   }
 
   void setKeyPressed(sf::Keyboard::Key key) {
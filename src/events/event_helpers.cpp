@@ -1,57 +1,64 @@
 #include "event_helpers.h"
 #include "events_generated.h"
+#include "input_translation.h"
 #include "uuid.h"
 #include <cstddef>
+#include <optional>
 #include <variant>
 
 namespace steamrot {
 
 /////////////////////////////////////////////////
-static const std::unordered_map<KeyboardInput, sf::Keyboard::Key> &
-GetFlatbuffersToSFMLKeyboardMap() {
-  static const std::unordered_map<KeyboardInput, sf::Keyboard::Key>
-      string_to_key_map = {
-          {KeyboardInput_A, sf::Keyboard::Key::A},
-          {KeyboardInput_B, sf::Keyboard::Key::B},
-          {KeyboardInput_C, sf::Keyboard::Key::C},
-          {KeyboardInput_D, sf::Keyboard::Key::D},
-          {KeyboardInput_E, sf::Keyboard::Key::E},
-          {KeyboardInput_F, sf::Keyboard::Key::F},
-          {KeyboardInput_G, sf::Keyboard::Key::G},
-          {KeyboardInput_H, sf::Keyboard::Key::H},
-          {KeyboardInput_K, sf::Keyboard::Key::K},
-          {KeyboardInput_L, sf::Keyboard::Key::L},
-          {KeyboardInput_M, sf::Keyboard::Key::M},
-          {KeyboardInput_N, sf::Keyboard::Key::N},
-          {KeyboardInput_O, sf::Keyboard::Key::O},
-          {KeyboardInput_P, sf::Keyboard::Key::P},
-          {KeyboardInput_Q, sf::Keyboard::Key::Q},
-          {KeyboardInput_R, sf::Keyboard::Key::R},
-          {KeyboardInput_S, sf::Keyboard::Key::S},
-          {KeyboardInput_T, sf::Keyboard::Key::T},
-          {KeyboardInput_U, sf::Keyboard::Key::U},
-          {KeyboardInput_V, sf::Keyboard::Key::V},
-          {KeyboardInput_W, sf::Keyboard::Key::W},
-          {KeyboardInput_X, sf::Keyboard::Key::X},
-          {KeyboardInput_Y, sf::Keyboard::Key::Y},
-          {KeyboardInput_Z, sf::Keyboard::Key::Z},
-      };
-  return string_to_key_map;
+/// @brief Set the bit for every key in a flatbuffers KeyboardInput vector
+///
+/// @param keys Raw KeyboardInput values, may be null
+/// @param bit_offset Bit of sf::Keyboard::Key 0 in the bitset
+/// @param bitset Bitset to add the keys to
+/// @return False if any value has no SFML key
+/////////////////////////////////////////////////
+static bool SetKeyboardBits(const flatbuffers::Vector<uint8_t> *keys,
+                            size_t bit_offset, UserInputBitset &bitset) {
+  if (!keys)
+    return true;
+
+  bool all_valid{true};
+  const uint8_t *raw_keys = keys->data();
+  for (size_t index = 0; index < keys->size(); index++) {
+    sf::Keyboard::Key key = ToSFMLKey(raw_keys[index]);
+    if (key == sf::Keyboard::Key::Unknown) {
+      all_valid = false;
+      continue;
+    }
+    bitset.set(bit_offset + static_cast<size_t>(key));
+  }
+  return all_valid;
 }
 
 /////////////////////////////////////////////////
-static const std::unordered_map<MouseInput, sf::Mouse::Button> &
-GetFlatbuffersToSFMLMouseMap() {
-  static const std::unordered_map<MouseInput, sf::Mouse::Button>
-      string_to_mouse_map = {
-
-          {MouseInput_LEFT_CLICK, sf::Mouse::Button::Left},
-          {MouseInput_RIGHT_CLICK, sf::Mouse::Button::Right},
-          {MouseInput_MIDDLE_CLICK, sf::Mouse::Button::Middle},
-
-      };
-  return string_to_mouse_map;
-};
+/// @brief Set the bit for every button in a flatbuffers MouseInput vector
+///
+/// @param buttons Raw MouseInput values, may be null
+/// @param bit_offset Bit of sf::Mouse::Button 0 in the bitset
+/// @param bitset Bitset to add the buttons to
+/// @return False if any value has no SFML button
+/////////////////////////////////////////////////
+static bool SetMouseBits(const flatbuffers::Vector<uint8_t> *buttons,
+                         size_t bit_offset, UserInputBitset &bitset) {
+  if (!buttons)
+    return true;
+
+  bool all_valid{true};
+  const uint8_t *raw_buttons = buttons->data();
+  for (size_t index = 0; index < buttons->size(); index++) {
+    std::optional<sf::Mouse::Button> button = ToSFMLButton(raw_buttons[index]);
+    if (!button) {
+      all_valid = false;
+      continue;
+    }
+    bitset.set(bit_offset + static_cast<size_t>(*button));
+  }
+  return all_valid;
+}
 
 /////////////////////////////////////////////////
 std::expected<EventData, FailInfo>
@@ -123,48 +130,22 @@ ConvertFBDataToUserInputBitset(const UserInputBitsetData &data) {
 
   // create EventBitset that represents the keys for this action
   UserInputBitset event_bitset;
-  if (data.keyboard_pressed()) {
-    for (const auto &key_pressed : *data.keyboard_pressed()) {
-      // not sure how to pull the enum straight out so just recasting it
-      KeyboardInput key_pressed_cast = KeyboardInput(key_pressed);
-      size_t bit_position = static_cast<size_t>(
-          GetFlatbuffersToSFMLKeyboardMap().at(key_pressed_cast));
-
-      // add to bitset (not replace)
-      event_bitset.set(bit_position, true);
-    }
-  }
-  if (data.keyboard_released()) {
-    for (const auto &key_released : *data.keyboard_released()) {
-      // not sure how to pull the enum straight out so just recasting it
-      KeyboardInput key_released_cast = KeyboardInput(key_released);
-      size_t bit_position = static_cast<size_t>(
-          GetFlatbuffersToSFMLKeyboardMap().at(key_released_cast));
-      // add to bitset (not replace)
-      event_bitset.set(bit_position + sf::Keyboard::KeyCount, true);
-    }
-  }
-  if (data.mouse_pressed()) {
-    for (const auto &mouse_pressed : *data.mouse_pressed()) {
-      // not sure how to pull the enum straight out so just recasting it
-      MouseInput mouse_pressed_cast = MouseInput(mouse_pressed);
-      size_t bit_position = static_cast<size_t>(
-          GetFlatbuffersToSFMLMouseMap().at(mouse_pressed_cast));
-      // add to bitset (not replace)
-      event_bitset.set(bit_position + sf::Keyboard::KeyCount * 2, true);
-    }
-  }
-  if (data.mouse_released()) {
-    for (const auto &mouse_released : *data.mouse_released()) {
-      // not sure how to pull the enum straight out so just recasting it
-      MouseInput mouse_released_cast = MouseInput(mouse_released);
-      size_t bit_position = static_cast<size_t>(
-          GetFlatbuffersToSFMLMouseMap().at(mouse_released_cast));
-      // add to bitset (not replace)
-      event_bitset.set(bit_position + sf::Keyboard::KeyCount * 2 +
-                           sf::Mouse::ButtonCount,
-                       true);
-    }
+
+  // every vector is converted even if an earlier one failed, the bitset is
+  // thrown away in that case anyway
+  bool all_valid = SetKeyboardBits(data.keyboard_pressed(), 0, event_bitset);
+  all_valid &= SetKeyboardBits(data.keyboard_released(),
+                               sf::Keyboard::KeyCount, event_bitset);
+  all_valid &= SetMouseBits(data.mouse_pressed(), kKeyboardBits, event_bitset);
+  all_valid &=
+      SetMouseBits(data.mouse_released(),
+                   kKeyboardBits + sf::Mouse::ButtonCount, event_bitset);
+
+  if (!all_valid) {
+    return std::unexpected(FailInfo{
+        FailMode::NonExistentEnumValue,
+        "ConvertFBDataToUserInputBitset: UserInputBitsetData contains an "
+        "input with no SFML equivalent."});
   }
 
   return event_bitset;
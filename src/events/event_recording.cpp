@@ -0,0 +1,335 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the event recording file format
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "event_recording.h"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace steamrot {
+
+namespace {
+
+// the data index written for each event relies on this order
+static_assert(std::is_same_v<std::variant_alternative_t<0, EventData>,
+                             std::monostate>);
+static_assert(std::is_same_v<std::variant_alternative_t<1, EventData>,
+                             UserInputBitset>);
+static_assert(std::is_same_v<std::variant_alternative_t<2, EventData>,
+                             SceneChangePacket>);
+static_assert(std::is_same_v<std::variant_alternative_t<3, EventData>,
+                             UIElementName>);
+
+/////////////////////////////////////////////////
+/// @brief Bytes a packed UserInputBitset takes up
+/////////////////////////////////////////////////
+constexpr size_t kPackedInputBytes = (kTotalBits + 7) / 8;
+
+using UUIDBytes = std::array<uint8_t, 16>;
+
+/////////////////////////////////////////////////
+/// @brief Write the raw bytes of a trivially copyable value
+/////////////////////////////////////////////////
+template <typename T> void WriteValue(std::ostream &stream, const T &value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/////////////////////////////////////////////////
+/// @brief Read the raw bytes of a trivially copyable value, false if the
+/// stream ran out
+/////////////////////////////////////////////////
+template <typename T> bool ReadValue(std::istream &stream, T &value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return static_cast<bool>(stream);
+}
+
+/////////////////////////////////////////////////
+void WriteUUID(std::ostream &stream, const uuids::uuid &uuid) {
+  const auto bytes = uuid.as_bytes();
+  stream.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+}
+
+/////////////////////////////////////////////////
+bool ReadUUID(std::istream &stream, uuids::uuid &uuid) {
+  UUIDBytes bytes;
+  if (!ReadValue(stream, bytes)) {
+    return false;
+  }
+  uuid = uuids::uuid{bytes.begin(), bytes.end()};
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// @brief Whether a value read from a file names a single EventType, or none
+/// for a default constructed packet
+/////////////////////////////////////////////////
+bool IsRecordedEventType(uint64_t event_type) {
+  if (event_type == EventType_NONE) {
+    return true;
+  }
+  const auto &event_types = EnumValuesEventType();
+  return std::find(std::begin(event_types), std::end(event_types),
+                   static_cast<EventType>(event_type)) !=
+         std::end(event_types);
+}
+
+/////////////////////////////////////////////////
+/// @brief Number of bytes left to read in a stream
+/////////////////////////////////////////////////
+uint64_t GetRemainingBytes(std::istream &stream) {
+  const std::streampos position = stream.tellg();
+  stream.seekg(0, std::ios::end);
+  const std::streampos end = stream.tellg();
+  stream.seekg(position);
+  return static_cast<uint64_t>(end - position);
+}
+
+/////////////////////////////////////////////////
+void WriteEventData(std::ostream &stream, const EventData &event_data) {
+
+  WriteValue(stream, static_cast<uint8_t>(event_data.index()));
+
+  std::visit(
+      [&stream](const auto &data) {
+        using DataType = std::decay_t<decltype(data)>;
+
+        if constexpr (std::is_same_v<DataType, UserInputBitset>) {
+          // one bit per input rather than the bitset's in memory words
+          std::array<uint8_t, kPackedInputBytes> packed_inputs{};
+          for (size_t bit = 0; bit < kTotalBits; bit++) {
+            if (data.test(bit)) {
+              packed_inputs[bit / 8] |= static_cast<uint8_t>(1u << (bit % 8));
+            }
+          }
+          WriteValue(stream, packed_inputs);
+
+        } else if constexpr (std::is_same_v<DataType, SceneChangePacket>) {
+          WriteValue(stream, static_cast<uint8_t>(data.first.has_value()));
+          WriteUUID(stream, data.first.value_or(uuids::uuid{}));
+          WriteValue(stream, static_cast<int8_t>(data.second));
+
+        } else if constexpr (std::is_same_v<DataType, UIElementName>) {
+          const std::string &name = data.Get();
+          WriteValue(stream, static_cast<uint32_t>(name.size()));
+          stream.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+      },
+      event_data);
+}
+
+/////////////////////////////////////////////////
+bool ReadEventData(std::istream &stream, EventData &event_data) {
+
+  uint8_t data_index{0};
+  if (!ReadValue(stream, data_index)) {
+    return false;
+  }
+
+  switch (data_index) {
+  case 0: {
+    event_data = std::monostate{};
+    return true;
+  }
+
+  case 1: {
+    std::array<uint8_t, kPackedInputBytes> packed_inputs;
+    if (!ReadValue(stream, packed_inputs)) {
+      return false;
+    }
+    UserInputBitset inputs;
+    for (size_t bit = 0; bit < kTotalBits; bit++) {
+      if (packed_inputs[bit / 8] & (1u << (bit % 8))) {
+        inputs.set(bit);
+      }
+    }
+    event_data = inputs;
+    return true;
+  }
+
+  case 2: {
+    uint8_t has_uuid{0};
+    uuids::uuid uuid;
+    int8_t scene_type{0};
+    if (!ReadValue(stream, has_uuid) || !ReadUUID(stream, uuid) ||
+        !ReadValue(stream, scene_type)) {
+      return false;
+    }
+    event_data = SceneChangePacket{
+        has_uuid ? std::optional<uuids::uuid>{uuid} : std::nullopt,
+        static_cast<SceneType>(scene_type)};
+    return true;
+  }
+
+  case 3: {
+    uint32_t name_size{0};
+    if (!ReadValue(stream, name_size)) {
+      return false;
+    }
+    // a corrupt size must not allocate more than the file could hold
+    if (name_size > GetRemainingBytes(stream)) {
+      return false;
+    }
+    std::string name(name_size, '\0');
+    stream.read(name.data(), static_cast<std::streamsize>(name_size));
+    if (!stream) {
+      return false;
+    }
+    event_data = UIElementName{name};
+    return true;
+  }
+
+  default:
+    return false;
+  }
+}
+
+} // namespace
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+WriteEventRecording(const EventRecording &recording,
+                    const std::filesystem::path &recording_path) {
+
+  std::ofstream recording_file(recording_path, std::ios::binary);
+  if (!recording_file.is_open()) {
+    FailInfo fail_info(FailMode::WriteFailure,
+                       "Could not open event recording: " +
+                           recording_path.string());
+    return std::unexpected(fail_info);
+  }
+
+  WriteValue(recording_file, kEventRecordingMagic);
+  WriteValue(recording_file, kEventRecordingVersion);
+  WriteValue(recording_file, static_cast<uint32_t>(kTotalBits));
+  WriteValue(recording_file, static_cast<uint64_t>(recording.end_loop_number));
+  WriteValue(recording_file, static_cast<uint64_t>(recording.events.size()));
+
+  for (const RecordedEvent &recorded_event : recording.events) {
+    const EventPacket &event = recorded_event.event;
+    WriteValue(recording_file,
+               static_cast<uint64_t>(recorded_event.loop_number));
+    WriteValue(recording_file, static_cast<uint64_t>(event.m_event_type));
+    WriteValue(recording_file, event.event_lifetime);
+    WriteUUID(recording_file, event.event_id);
+    WriteUUID(recording_file, event.source_id);
+    WriteEventData(recording_file, event.m_event_data);
+  }
+
+  WriteValue(recording_file,
+             static_cast<uint64_t>(recording.mouse_positions.size()));
+  for (const RecordedMousePosition &mouse_position :
+       recording.mouse_positions) {
+    WriteValue(recording_file,
+               static_cast<uint64_t>(mouse_position.loop_number));
+    WriteValue(recording_file,
+               static_cast<int32_t>(mouse_position.position.x));
+    WriteValue(recording_file,
+               static_cast<int32_t>(mouse_position.position.y));
+  }
+
+  if (!recording_file) {
+    FailInfo fail_info(FailMode::WriteFailure,
+                       "Failed to write event recording: " +
+                           recording_path.string());
+    return std::unexpected(fail_info);
+  }
+  return std::monostate{};
+}
+
+/////////////////////////////////////////////////
+std::expected<EventRecording, FailInfo>
+ReadEventRecording(const std::filesystem::path &recording_path) {
+
+  std::ifstream recording_file(recording_path, std::ios::binary);
+  if (!recording_file.is_open()) {
+    FailInfo fail_info(FailMode::FileNotFound,
+                       "Could not open event recording: " +
+                           recording_path.string());
+    return std::unexpected(fail_info);
+  }
+
+  auto read_failure = [&recording_path](const std::string &reason) {
+    return std::unexpected(FailInfo(FailMode::ReadFailure,
+                                    reason + ": " + recording_path.string()));
+  };
+
+  uint32_t magic{0};
+  uint32_t version{0};
+  uint32_t input_bits{0};
+  uint64_t end_loop_number{0};
+  uint64_t event_count{0};
+  if (!ReadValue(recording_file, magic) || magic != kEventRecordingMagic) {
+    return read_failure("Not an event recording");
+  }
+  if (!ReadValue(recording_file, version) ||
+      version != kEventRecordingVersion) {
+    return read_failure("Unsupported event recording version");
+  }
+  // a different SFML key count would shift every input bit
+  if (!ReadValue(recording_file, input_bits) || input_bits != kTotalBits) {
+    return read_failure("Event recording was made with different inputs");
+  }
+  if (!ReadValue(recording_file, end_loop_number) ||
+      !ReadValue(recording_file, event_count)) {
+    return read_failure("Truncated event recording");
+  }
+
+  EventRecording recording;
+  recording.end_loop_number = static_cast<size_t>(end_loop_number);
+
+  for (uint64_t index = 0; index < event_count; index++) {
+    uint64_t loop_number{0};
+    uint64_t event_type{0};
+    uint8_t event_lifetime{0};
+    if (!ReadValue(recording_file, loop_number) ||
+        !ReadValue(recording_file, event_type) ||
+        !ReadValue(recording_file, event_lifetime)) {
+      return read_failure("Truncated event recording");
+    }
+    if (!IsRecordedEventType(event_type)) {
+      return read_failure("Unknown event type in event recording");
+    }
+
+    RecordedEvent recorded_event{static_cast<size_t>(loop_number),
+                                 EventPacket{event_lifetime}};
+    EventPacket &event = recorded_event.event;
+    event.m_event_type = static_cast<EventType>(event_type);
+    if (!ReadUUID(recording_file, event.event_id) ||
+        !ReadUUID(recording_file, event.source_id) ||
+        !ReadEventData(recording_file, event.m_event_data)) {
+      return read_failure("Truncated or corrupt event recording");
+    }
+    recording.events.push_back(std::move(recorded_event));
+  }
+
+  uint64_t mouse_position_count{0};
+  if (!ReadValue(recording_file, mouse_position_count)) {
+    return read_failure("Truncated event recording");
+  }
+
+  for (uint64_t index = 0; index < mouse_position_count; index++) {
+    uint64_t loop_number{0};
+    int32_t x{0};
+    int32_t y{0};
+    if (!ReadValue(recording_file, loop_number) ||
+        !ReadValue(recording_file, x) || !ReadValue(recording_file, y)) {
+      return read_failure("Truncated event recording");
+    }
+    recording.mouse_positions.push_back(
+        {static_cast<size_t>(loop_number), sf::Vector2i{x, y}});
+  }
+
+  return recording;
+}
+
+} // namespace steamrot
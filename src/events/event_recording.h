@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the event recording file format
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventPacket.h"
+#include "FailInfo.h"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <variant>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Identifies an event recording file, "SREV" read as bytes
+/////////////////////////////////////////////////
+constexpr uint32_t kEventRecordingMagic = 0x56455253;
+
+/////////////////////////////////////////////////
+/// @brief Bumped whenever the layout of a recording changes
+/////////////////////////////////////////////////
+constexpr uint32_t kEventRecordingVersion = 2;
+
+/////////////////////////////////////////////////
+/// @class RecordedEvent
+/// @brief An event and the simulation tick it entered the game on.
+///
+/////////////////////////////////////////////////
+struct RecordedEvent {
+  size_t loop_number{0};
+  EventPacket event;
+};
+
+/////////////////////////////////////////////////
+/// @class RecordedMousePosition
+/// @brief Where the mouse was from a simulation tick on.
+///
+/////////////////////////////////////////////////
+struct RecordedMousePosition {
+  size_t loop_number{0};
+  sf::Vector2i position;
+};
+
+/////////////////////////////////////////////////
+/// @class EventRecording
+/// @brief Every input event of a session, in the order they arrived.
+///
+/////////////////////////////////////////////////
+struct EventRecording {
+  /////////////////////////////////////////////////
+  /// @brief Loop number the session ended on, the first without a tick
+  /////////////////////////////////////////////////
+  size_t end_loop_number{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Recorded events, ordered by loop number
+  /////////////////////////////////////////////////
+  std::vector<RecordedEvent> events;
+
+  /////////////////////////////////////////////////
+  /// @brief Mouse positions, one for each tick the mouse moved on, ordered by
+  /// loop number
+  /////////////////////////////////////////////////
+  std::vector<RecordedMousePosition> mouse_positions;
+};
+
+/////////////////////////////////////////////////
+/// @brief Write a recording as a compact binary file
+///
+/// Values are written in host byte order, so a recording is only meant to be
+/// replayed on the kind of machine it was made on.
+///
+/// @param recording Recording to write
+/// @param recording_path Path of the file to write
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+WriteEventRecording(const EventRecording &recording,
+                    const std::filesystem::path &recording_path);
+
+/////////////////////////////////////////////////
+/// @brief Read a recording written by WriteEventRecording
+///
+/// @param recording_path Path of the file to read
+/////////////////////////////////////////////////
+std::expected<EventRecording, FailInfo>
+ReadEventRecording(const std::filesystem::path &recording_path);
+
+} // namespace steamrot
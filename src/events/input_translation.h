@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Compile-time tables translating flatbuffers input enums to SFML
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "user_input_generated.h"
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Number of values in the flatbuffers KeyboardInput enum
+/////////////////////////////////////////////////
+constexpr size_t kKeyboardInputCount =
+    static_cast<size_t>(KeyboardInput_MAX) + 1;
+
+/////////////////////////////////////////////////
+/// @brief Number of values in the flatbuffers MouseInput enum
+/////////////////////////////////////////////////
+constexpr size_t kMouseInputCount = static_cast<size_t>(MouseInput_MAX) + 1;
+
+/////////////////////////////////////////////////
+/// @brief SFML key for each KeyboardInput, indexed by the enum value
+///
+/// The letters are declared in the same order in user_input.fbs and SFML, so
+/// the table is built by offset and checked below. Only letters can be built
+/// this way, a key added after Z needs its own entry.
+/////////////////////////////////////////////////
+static_assert(KeyboardInput_MIN == KeyboardInput_A &&
+                  KeyboardInput_MAX == KeyboardInput_Z,
+              "KeyboardInput has keys other than letters, give them explicit "
+              "entries in kKeyboardInputToSFML");
+
+constexpr std::array<sf::Keyboard::Key, kKeyboardInputCount>
+    kKeyboardInputToSFML = [] {
+      std::array<sf::Keyboard::Key, kKeyboardInputCount> table{};
+      for (size_t index = 0; index < kKeyboardInputCount; index++) {
+        table[index] = static_cast<sf::Keyboard::Key>(
+            static_cast<int>(sf::Keyboard::Key::A) + static_cast<int>(index));
+      }
+      return table;
+    }();
+
+static_assert(kKeyboardInputToSFML[KeyboardInput_A] == sf::Keyboard::Key::A);
+static_assert(kKeyboardInputToSFML[KeyboardInput_I] == sf::Keyboard::Key::I);
+static_assert(kKeyboardInputToSFML[KeyboardInput_Z] == sf::Keyboard::Key::Z,
+              "KeyboardInput no longer lines up with sf::Keyboard::Key");
+
+/////////////////////////////////////////////////
+/// @brief SFML button for each MouseInput, indexed by the enum value
+///
+/// Scrolling is not a button, so those entries are empty.
+/////////////////////////////////////////////////
+constexpr std::array<std::optional<sf::Mouse::Button>, kMouseInputCount>
+    kMouseInputToSFML = [] {
+      std::array<std::optional<sf::Mouse::Button>, kMouseInputCount> table{};
+      table[MouseInput_LEFT_CLICK] = sf::Mouse::Button::Left;
+      table[MouseInput_RIGHT_CLICK] = sf::Mouse::Button::Right;
+      table[MouseInput_MIDDLE_CLICK] = sf::Mouse::Button::Middle;
+      return table;
+    }();
+
+/////////////////////////////////////////////////
+/// @brief Return the SFML key for a raw KeyboardInput value
+///
+/// @param keyboard_input Value as stored in a flatbuffers vector
+/// @return sf::Keyboard::Key::Unknown if the value is not in the enum
+/////////////////////////////////////////////////
+constexpr sf::Keyboard::Key ToSFMLKey(uint8_t keyboard_input) {
+  if (keyboard_input >= kKeyboardInputCount)
+    return sf::Keyboard::Key::Unknown;
+  return kKeyboardInputToSFML[keyboard_input];
+}
+
+/////////////////////////////////////////////////
+/// @brief Return the SFML button for a raw MouseInput value
+///
+/// @param mouse_input Value as stored in a flatbuffers vector
+/// @return Empty if the value is not in the enum or is not a button
+/////////////////////////////////////////////////
+constexpr std::optional<sf::Mouse::Button> ToSFMLButton(uint8_t mouse_input) {
+  if (mouse_input >= kMouseInputCount)
+    return std::nullopt;
+  return kMouseInputToSFML[mouse_input];
+}
+
+} // namespace steamrot
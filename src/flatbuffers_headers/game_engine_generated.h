@@ -23,16 +23,31 @@ struct GameEngineDataBuilder;
 struct GameEngineData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef GameEngineDataBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_SUBSCRIPTIONS = 4
+    VT_SUBSCRIPTIONS = 4,
+    VT_TICK_RATE = 6,
+    VT_FRAME_RATE_LIMIT = 8,
+    VT_MAX_TICKS_PER_FRAME = 10
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<steamrot::SubscriberData>> *subscriptions() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<steamrot::SubscriberData>> *>(VT_SUBSCRIPTIONS);
   }
+  uint32_t tick_rate() const {
+    return GetField<uint32_t>(VT_TICK_RATE, 60);
+  }
+  uint32_t frame_rate_limit() const {
+    return GetField<uint32_t>(VT_FRAME_RATE_LIMIT, 60);
+  }
+  uint32_t max_ticks_per_frame() const {
+    return GetField<uint32_t>(VT_MAX_TICKS_PER_FRAME, 5);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_SUBSCRIPTIONS) &&
            verifier.VerifyVector(subscriptions()) &&
            verifier.VerifyVectorOfTables(subscriptions()) &&
+           VerifyField<uint32_t>(verifier, VT_TICK_RATE, 4) &&
+           VerifyField<uint32_t>(verifier, VT_FRAME_RATE_LIMIT, 4) &&
+           VerifyField<uint32_t>(verifier, VT_MAX_TICKS_PER_FRAME, 4) &&
            verifier.EndTable();
   }
 };
@@ -44,6 +59,15 @@ struct GameEngineDataBuilder {
   void add_subscriptions(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<steamrot::SubscriberData>>> subscriptions) {
     fbb_.AddOffset(GameEngineData::VT_SUBSCRIPTIONS, subscriptions);
   }
+  void add_tick_rate(uint32_t tick_rate) {
+    fbb_.AddElement<uint32_t>(GameEngineData::VT_TICK_RATE, tick_rate, 60);
+  }
+  void add_frame_rate_limit(uint32_t frame_rate_limit) {
+    fbb_.AddElement<uint32_t>(GameEngineData::VT_FRAME_RATE_LIMIT, frame_rate_limit, 60);
+  }
+  void add_max_ticks_per_frame(uint32_t max_ticks_per_frame) {
+    fbb_.AddElement<uint32_t>(GameEngineData::VT_MAX_TICKS_PER_FRAME, max_ticks_per_frame, 5);
+  }
   explicit GameEngineDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -57,19 +81,31 @@ struct GameEngineDataBuilder {
 
 inline ::flatbuffers::Offset<GameEngineData> CreateGameEngineData(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<steamrot::SubscriberData>>> subscriptions = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<steamrot::SubscriberData>>> subscriptions = 0,
+    uint32_t tick_rate = 60,
+    uint32_t frame_rate_limit = 60,
+    uint32_t max_ticks_per_frame = 5) {
   GameEngineDataBuilder builder_(_fbb);
+  builder_.add_max_ticks_per_frame(max_ticks_per_frame);
+  builder_.add_frame_rate_limit(frame_rate_limit);
+  builder_.add_tick_rate(tick_rate);
   builder_.add_subscriptions(subscriptions);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<GameEngineData> CreateGameEngineDataDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<steamrot::SubscriberData>> *subscriptions = nullptr) {
+    const std::vector<::flatbuffers::Offset<steamrot::SubscriberData>> *subscriptions = nullptr,
+    uint32_t tick_rate = 60,
+    uint32_t frame_rate_limit = 60,
+    uint32_t max_ticks_per_frame = 5) {
   auto subscriptions__ = subscriptions ? _fbb.CreateVector<::flatbuffers::Offset<steamrot::SubscriberData>>(*subscriptions) : 0;
   return steamrot::CreateGameEngineData(
       _fbb,
-      subscriptions__);
+      subscriptions__,
+      tick_rate,
+      frame_rate_limit,
+      max_ticks_per_frame);
 }
 
 inline const steamrot::GameEngineData *GetGameEngineData(const void *buf) {
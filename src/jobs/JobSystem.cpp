@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the JobSystem class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace steamrot {
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief JobSystem the current thread is a worker of, if any
+/////////////////////////////////////////////////
+thread_local const JobSystem *t_owning_job_system{nullptr};
+
+/////////////////////////////////////////////////
+/// @brief Queue index of the current worker thread
+/////////////////////////////////////////////////
+thread_local size_t t_worker_index{0};
+
+/////////////////////////////////////////////////
+/// @brief Number of jobs the current thread is inside, jobs can nest through
+/// Wait
+/////////////////////////////////////////////////
+thread_local size_t t_running_job_depth{0};
+
+/////////////////////////////////////////////////
+/// @brief Run a job, tracking that the current thread is inside it
+/////////////////////////////////////////////////
+void RunJob(Job &job) {
+  ++t_running_job_depth;
+  job();
+  --t_running_job_depth;
+}
+} // namespace
+
+/////////////////////////////////////////////////
+JobSystem::JobSystem(size_t worker_count) {
+
+  // the extra queue at the back is shared by every non worker thread
+  m_queues.reserve(worker_count + 1);
+  for (size_t i = 0; i < worker_count + 1; ++i) {
+    m_queues.push_back(std::make_unique<WorkStealingQueue>());
+  }
+
+  m_workers.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; ++i) {
+    m_workers.emplace_back([this, i](std::stop_token stop_token) {
+      WorkerLoop(stop_token, i);
+    });
+  }
+}
+
+/////////////////////////////////////////////////
+JobSystem::~JobSystem() {
+
+  for (auto &worker : m_workers) {
+    worker.request_stop();
+  }
+
+  // join before the queues and condition variable are destroyed
+  m_workers.clear();
+}
+
+/////////////////////////////////////////////////
+size_t JobSystem::GetLocalQueueIndex() const {
+
+  if (t_owning_job_system == this) {
+    return t_worker_index;
+  }
+
+  return m_queues.size() - 1;
+}
+
+/////////////////////////////////////////////////
+std::optional<Job> JobSystem::FindJob(size_t queue_index) {
+
+  // newest local job first, it is the most likely to be in cache
+  std::optional<Job> job = m_queues[queue_index]->Pop();
+
+  // otherwise steal the oldest job from the other queues
+  for (size_t offset = 1; !job && offset < m_queues.size(); ++offset) {
+    job = m_queues[(queue_index + offset) % m_queues.size()]->Steal();
+  }
+
+  if (job) {
+    m_queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  return job;
+}
+
+/////////////////////////////////////////////////
+void JobSystem::WorkerLoop(std::stop_token stop_token, size_t worker_index) {
+
+  t_owning_job_system = this;
+  t_worker_index = worker_index;
+
+  while (!stop_token.stop_requested()) {
+
+    if (std::optional<Job> job = FindJob(worker_index)) {
+      RunJob(*job);
+      continue;
+    }
+
+    // nothing to do, sleep until a job is queued or a stop is requested
+    std::unique_lock lock(m_wake_mutex);
+    m_wake_condition.wait(lock, stop_token, [this]() {
+      return m_queued_jobs.load(std::memory_order_relaxed) > 0;
+    });
+  }
+}
+
+/////////////////////////////////////////////////
+void JobSystem::Submit(Job job, JobCounter &counter) {
+
+  counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+  {
+    // counted before the push, so a thief that pops the job straight away
+    // never takes the count below zero. Taking the lock stops a worker
+    // missing the wake up between checking the count and going to sleep
+    std::lock_guard lock(m_wake_mutex);
+    m_queued_jobs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  m_queues[GetLocalQueueIndex()]->Push(
+      [job = std::move(job), &counter]() {
+        job();
+        counter.pending.fetch_sub(1, std::memory_order_release);
+      });
+  m_wake_condition.notify_one();
+}
+
+/////////////////////////////////////////////////
+void JobSystem::Wait(JobCounter &counter) {
+
+  const size_t queue_index = GetLocalQueueIndex();
+
+  // help out rather than block, this is what lets a JobSystem without
+  // workers (or a worker waiting on a nested batch) make progress
+  while (counter.pending.load(std::memory_order_acquire) > 0) {
+
+    if (std::optional<Job> job = FindJob(queue_index)) {
+      RunJob(*job);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+size_t JobSystem::GetWorkerCount() const { return m_workers.size(); }
+
+/////////////////////////////////////////////////
+bool JobSystem::IsRunningJob() { return t_running_job_depth > 0; }
+
+/////////////////////////////////////////////////
+size_t JobSystem::GetDefaultWorkerCount() {
+
+  // hardware_concurrency may report 0 when it cannot be determined
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1;
+}
+
+} // namespace steamrot
@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the JobSystem class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "WorkStealingQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class JobCounter
+/// @brief Tracks how many jobs of a batch are still outstanding.
+///
+/// Pass the same counter to every JobSystem::Submit of a batch, then
+/// JobSystem::Wait on it.
+/////////////////////////////////////////////////
+struct JobCounter {
+  std::atomic<size_t> pending{0};
+};
+
+/////////////////////////////////////////////////
+/// @class JobSystem
+/// @brief Thread pool where every worker owns a WorkStealingQueue.
+///
+/// Idle workers steal from the other queues, and a thread calling Wait runs
+/// jobs itself until its batch is done, so a JobSystem with no workers still
+/// completes every job on the calling thread. Jobs must not throw.
+/////////////////////////////////////////////////
+class JobSystem {
+private:
+  /////////////////////////////////////////////////
+  /// @brief One queue per worker, plus a final queue for external threads
+  /////////////////////////////////////////////////
+  std::vector<std::unique_ptr<WorkStealingQueue>> m_queues;
+
+  /////////////////////////////////////////////////
+  /// @brief Worker threads, joined on destruction
+  /////////////////////////////////////////////////
+  std::vector<std::jthread> m_workers;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of jobs sitting in any queue
+  /////////////////////////////////////////////////
+  std::atomic<size_t> m_queued_jobs{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Guards sleeping workers
+  /////////////////////////////////////////////////
+  std::mutex m_wake_mutex;
+
+  /////////////////////////////////////////////////
+  /// @brief Wakes workers when jobs are queued or a stop is requested
+  /////////////////////////////////////////////////
+  std::condition_variable_any m_wake_condition;
+
+  /////////////////////////////////////////////////
+  /// @brief Index of the queue the calling thread owns
+  ///
+  /// Workers own their own queue, any other thread uses the external queue.
+  /////////////////////////////////////////////////
+  size_t GetLocalQueueIndex() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Take a job from the local queue, or steal one from the others
+  ///
+  /// @param queue_index Index of the queue owned by the calling thread
+  /////////////////////////////////////////////////
+  std::optional<Job> FindJob(size_t queue_index);
+
+  /////////////////////////////////////////////////
+  /// @brief Main loop of each worker thread
+  ///
+  /// @param stop_token Token from the owning std::jthread
+  /// @param worker_index Index of the worker (and of its queue)
+  /////////////////////////////////////////////////
+  void WorkerLoop(std::stop_token stop_token, size_t worker_index);
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for JobSystem
+  ///
+  /// @param worker_count Number of worker threads to start
+  /////////////////////////////////////////////////
+  explicit JobSystem(size_t worker_count = GetDefaultWorkerCount());
+
+  /////////////////////////////////////////////////
+  /// @brief Stops and joins all workers, queued jobs are dropped
+  /////////////////////////////////////////////////
+  ~JobSystem();
+
+  JobSystem(const JobSystem &) = delete;
+  JobSystem &operator=(const JobSystem &) = delete;
+
+  /////////////////////////////////////////////////
+  /// @brief Queue a job, incrementing the counter until it has run
+  ///
+  /// @param job Job to run
+  /// @param counter Counter for the batch the job belongs to
+  /////////////////////////////////////////////////
+  void Submit(Job job, JobCounter &counter);
+
+  /////////////////////////////////////////////////
+  /// @brief Run queued jobs on the calling thread until the counter is 0
+  ///
+  /// @param counter Counter for the batch to wait on
+  /////////////////////////////////////////////////
+  void Wait(JobCounter &counter);
+
+  /////////////////////////////////////////////////
+  /// @brief Number of worker threads (excluding threads calling Wait)
+  /////////////////////////////////////////////////
+  size_t GetWorkerCount() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the calling thread is currently running a job, from any
+  /// JobSystem
+  /////////////////////////////////////////////////
+  static bool IsRunningJob();
+
+  /////////////////////////////////////////////////
+  /// @brief One worker per hardware thread, leaving one for the main thread
+  /////////////////////////////////////////////////
+  static size_t GetDefaultWorkerCount();
+};
+
+} // namespace steamrot
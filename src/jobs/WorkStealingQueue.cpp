@@ -0,0 +1,51 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the WorkStealingQueue class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "WorkStealingQueue.h"
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+void WorkStealingQueue::Push(Job job) {
+  std::lock_guard lock(m_mutex);
+  m_jobs.push_back(std::move(job));
+}
+
+/////////////////////////////////////////////////
+std::optional<Job> WorkStealingQueue::Pop() {
+  std::lock_guard lock(m_mutex);
+
+  if (m_jobs.empty()) {
+    return std::nullopt;
+  }
+
+  Job job = std::move(m_jobs.back());
+  m_jobs.pop_back();
+  return job;
+}
+
+/////////////////////////////////////////////////
+std::optional<Job> WorkStealingQueue::Steal() {
+  std::lock_guard lock(m_mutex);
+
+  if (m_jobs.empty()) {
+    return std::nullopt;
+  }
+
+  Job job = std::move(m_jobs.front());
+  m_jobs.pop_front();
+  return job;
+}
+
+/////////////////////////////////////////////////
+bool WorkStealingQueue::IsEmpty() const {
+  std::lock_guard lock(m_mutex);
+  return m_jobs.empty();
+}
+
+} // namespace steamrot
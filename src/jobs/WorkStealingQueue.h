@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the WorkStealingQueue class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Unit of work run by the JobSystem
+/////////////////////////////////////////////////
+using Job = std::function<void()>;
+
+/////////////////////////////////////////////////
+/// @class WorkStealingQueue
+/// @brief Double ended job queue owned by a single worker.
+///
+/// The owning worker pushes and pops at the back (newest job first, which is
+/// still warm in cache) while other workers steal from the front (oldest job,
+/// usually the largest remaining chunk). A short lock per queue keeps it
+/// simple, contention is low as every worker mostly touches its own queue.
+/////////////////////////////////////////////////
+class WorkStealingQueue {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Jobs waiting to run
+  /////////////////////////////////////////////////
+  std::deque<Job> m_jobs;
+
+  /////////////////////////////////////////////////
+  /// @brief Guards m_jobs
+  /////////////////////////////////////////////////
+  mutable std::mutex m_mutex;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Push a job onto the back of the queue (owner side)
+  ///
+  /// @param job Job to push
+  /////////////////////////////////////////////////
+  void Push(Job job);
+
+  /////////////////////////////////////////////////
+  /// @brief Pop the newest job from the back of the queue (owner side)
+  /////////////////////////////////////////////////
+  std::optional<Job> Pop();
+
+  /////////////////////////////////////////////////
+  /// @brief Steal the oldest job from the front of the queue (thief side)
+  /////////////////////////////////////////////////
+  std::optional<Job> Steal();
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the queue currently holds no jobs
+  /////////////////////////////////////////////////
+  bool IsEmpty() const;
+};
+
+} // namespace steamrot
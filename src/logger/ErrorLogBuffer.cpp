@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the ErrorLogBuffer class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ErrorLogBuffer.h"
+#include <algorithm>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+std::string_view ErrorRecord::GetMessage() const {
+  return std::string_view{message.data(), message_size};
+}
+
+/////////////////////////////////////////////////
+void ErrorLogBuffer::Push(log_handler::LogCode code, std::string_view message) {
+
+  const auto time = std::chrono::system_clock::now();
+  const size_t message_size = std::min(message.size(), kErrorMessageCapacity);
+
+  std::lock_guard lock(m_mutex);
+
+  size_t size = m_size.load(std::memory_order_relaxed);
+  size_t slot = (m_head + size) % kErrorLogCapacity;
+  if (size == kErrorLogCapacity) {
+    // overwrite the oldest record
+    slot = m_head;
+    m_head = (m_head + 1) % kErrorLogCapacity;
+    m_dropped_count++;
+  } else {
+    size++;
+  }
+
+  ErrorRecord &record = m_records[slot];
+  record.time = time;
+  record.code = code;
+  record.message_size = message_size;
+  std::copy_n(message.data(), message_size, record.message.data());
+
+  m_size.store(size, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////
+std::vector<ErrorRecord> ErrorLogBuffer::TakeRecords(size_t &dropped_count) {
+
+  std::lock_guard lock(m_mutex);
+
+  const size_t size = m_size.load(std::memory_order_relaxed);
+  std::vector<ErrorRecord> records;
+  records.reserve(size);
+  for (size_t index = 0; index < size; index++) {
+    records.push_back(m_records[(m_head + index) % kErrorLogCapacity]);
+  }
+
+  dropped_count = m_dropped_count;
+  m_dropped_count = 0;
+  m_head = 0;
+  m_size.store(0, std::memory_order_release);
+  return records;
+}
+
+/////////////////////////////////////////////////
+size_t ErrorLogBuffer::GetSize() const {
+  return m_size.load(std::memory_order_acquire);
+}
+
+} // namespace steamrot
@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the ErrorLogBuffer class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "log_handler.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Longest message a record keeps, longer ones are truncated
+/////////////////////////////////////////////////
+constexpr size_t kErrorMessageCapacity = 256;
+
+/////////////////////////////////////////////////
+/// @brief Records the buffer holds before it overwrites the oldest
+/////////////////////////////////////////////////
+constexpr size_t kErrorLogCapacity = 128;
+
+/////////////////////////////////////////////////
+/// @class ErrorRecord
+/// @brief An error as it was raised, stored inline so recording it does not
+/// allocate.
+///
+/////////////////////////////////////////////////
+struct ErrorRecord {
+  std::chrono::system_clock::time_point time;
+  log_handler::LogCode code{log_handler::LogCode::kNoCode};
+  size_t message_size{0};
+  std::array<char, kErrorMessageCapacity> message{};
+
+  /////////////////////////////////////////////////
+  /// @brief Return the (possibly truncated) message
+  /////////////////////////////////////////////////
+  std::string_view GetMessage() const;
+};
+
+/////////////////////////////////////////////////
+/// @class ErrorLogBuffer
+/// @brief Fixed size ring of error records waiting to be written out.
+///
+/// Push copies the message into a preallocated slot under a short lock, so
+/// any thread can record an error in a hot loop. When the ring is full the
+/// oldest record is overwritten and counted as dropped.
+/////////////////////////////////////////////////
+class ErrorLogBuffer {
+private:
+  std::mutex m_mutex;
+
+  std::array<ErrorRecord, kErrorLogCapacity> m_records;
+
+  /////////////////////////////////////////////////
+  /// @brief Index of the oldest record
+  /////////////////////////////////////////////////
+  size_t m_head{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Records currently held, readable without the lock
+  /////////////////////////////////////////////////
+  std::atomic<size_t> m_size{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Records overwritten since the last TakeRecords
+  /////////////////////////////////////////////////
+  size_t m_dropped_count{0};
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Record an error
+  ///
+  /// @param code Code of the error
+  /// @param message Message of the error, truncated to kErrorMessageCapacity
+  /////////////////////////////////////////////////
+  void Push(log_handler::LogCode code, std::string_view message);
+
+  /////////////////////////////////////////////////
+  /// @brief Remove and return every held record, oldest first
+  ///
+  /// @param dropped_count Set to the records overwritten since the last call
+  /////////////////////////////////////////////////
+  std::vector<ErrorRecord> TakeRecords(size_t &dropped_count);
+
+  /////////////////////////////////////////////////
+  /// @brief Return the number of records held
+  /////////////////////////////////////////////////
+  size_t GetSize() const;
+};
+
+} // namespace steamrot
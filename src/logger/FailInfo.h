@@ -28,7 +28,11 @@ enum class FailMode {
   EnumValueNotHandled,
   VariantTypeMismatch,
   NullPointer,
-  InvalidUUID
+  InvalidUUID,
+  StaleHandle,
+  DependencyCycle,
+  WriteFailure,
+  ReadFailure
 };
 
 struct FailInfo {
@@ -3,6 +3,8 @@
 ////////////////////////////////////////////////////////////
 #include "Logger.h"
 #include "directory_paths.h"
+#include "log_handler.h"
+#include "spdlog/async.h"
 #include "spdlog/common.h"
 #include "spdlog/logger.h"
 #include "spdlog/sinks/basic_file_sink.h"
@@ -16,44 +18,65 @@ Logger::Logger(const std::string &logger_name) {
   CreateInfoSink();
   CreateErrorSink();
 
-  // create global logger and register sinks
-  m_logger =
-      std::make_shared<spdlog::logger>(logger_name, begin(sinks), end(sinks));
-  // finally, register globally
-  ;
-  spdlog::register_logger(m_logger);
-
   std::string json_start_pattern = {
       "{\n \"log\": [{\"time\": \"%Y-%m-%dT%H:%M:%S.%f%z\", \"name\": \"%n\", "
       "\"level\": "
       "\"%^%l%$\", \"process\": %P, \"thread\": %t, \"message\": \"%v\"},"};
 
-  // set up logger for json output and formatting
-  m_logger->set_pattern(json_start_pattern);
+  // intialise log files, written straight away so no later entry can be
+  // formatted with the start pattern
+  spdlog::logger opening_logger(logger_name, begin(sinks), end(sinks));
+  opening_logger.set_pattern(json_start_pattern);
+  opening_logger.error("Start.");
 
-  // intialise log files
-  m_logger->error("Start.");
+  // create global logger and register sinks. it is asynchronous so writing
+  // out buffered errors never blocks the game loop on file io
+  m_thread_pool = std::make_shared<spdlog::details::thread_pool>(8192, 1);
+  m_logger = std::make_shared<spdlog::async_logger>(
+      logger_name, begin(sinks), end(sinks), m_thread_pool,
+      spdlog::async_overflow_policy::block);
 
   std::string jsonpattern = {
       "{\"time\": \"%Y-%m-%dT%H:%M:%S.%f%z\", \"name\": \"%n\", \"level\": "
       "\"%^%l%$\", \"process\": %P, \"thread\": %t, \"message\": \"%v\"},"};
 
+  // set up logger for json output and formatting
   m_logger->set_pattern(jsonpattern);
+
+  // finally, register globally
+  spdlog::register_logger(m_logger);
 };
 
+////////////////////////////////////////////////////////////
+Logger::~Logger() { CloseLogger(); }
+
 ////////////////////////////////////////////////////////////
 void Logger::CloseLogger() {
+  if (!m_logger) {
+    return;
+  }
+
+  // write out any errors still buffered
+  steamrot::log_handler::FlushErrorLog();
+
+  // destroying the thread pool waits for everything queued to be written, so
+  // the last entry below really is last
+  const std::string logger_name = m_logger->name();
+  spdlog::drop(logger_name);
+  m_logger.reset();
+  m_thread_pool.reset();
+
   // All we're doing below is setting the same log format, without the "," at
   // the end
   std::string jsonlastlogpattern = {
       "{\"time\": \"%Y-%m-%dT%H:%M:%S.%f%z\", \"name\": \"%n\", \"level\": "
       "\"%^%l%$\", \"process\": %P, \"thread\": %t, \"message\": \"%v\"}]\n}"};
-  spdlog::set_pattern(jsonlastlogpattern);
+  spdlog::logger closing_logger(logger_name, begin(sinks), end(sinks));
+  closing_logger.set_pattern(jsonlastlogpattern);
 
   // below is our last log entry
-  m_logger->error("Finished.");
-
-  spdlog::drop("global_logger");
+  closing_logger.error("Finished.");
+  closing_logger.flush();
 }
 ////////////////////////////////////////////////////////////
 void Logger::CreateInfoSink() {
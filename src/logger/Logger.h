@@ -6,6 +6,7 @@
 ////////////////////////////////////////////////////////////
 // headers
 ////////////////////////////////////////////////////////////
+#include "spdlog/async_logger.h"
 #include "spdlog/logger.h"
 #include <memory>
 
@@ -15,6 +16,8 @@ private:
   // member data
   ////////////////////////////////////////////////////////////
 
+  // the sinks are only written by the thread pool, until CloseLogger
+  std::shared_ptr<spdlog::details::thread_pool> m_thread_pool;
   std::shared_ptr<spdlog::logger> m_logger;
   std::vector<spdlog::sink_ptr> sinks;
 
@@ -35,7 +38,15 @@ public:
   Logger(const std::string &logger_name);
 
   ////////////////////////////////////////////////////////////
-  // |brief close out sinks/loggers
+  // |brief closes the logger if CloseLogger has not been called
+  ////////////////////////////////////////////////////////////
+  ~Logger();
+
+  Logger(const Logger &) = delete;
+  Logger &operator=(const Logger &) = delete;
+
+  ////////////////////////////////////////////////////////////
+  // |brief close out sinks/loggers, writes out anything still queued first
   ////////////////////////////////////////////////////////////
   void CloseLogger();
 };
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the per-subsystem channel loggers
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "log_channel.h"
+#include "spdlog/async.h"
+#include "spdlog/async_logger.h"
+#include "spdlog/sinks/stdout_color_sinks.h"
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace steamrot {
+
+namespace {
+
+/////////////////////////////////////////////////
+/// @brief Messages the background thread can have queued
+/////////////////////////////////////////////////
+constexpr size_t kLogQueueSize = 8192;
+
+/////////////////////////////////////////////////
+/// @class ChannelLoggers
+/// @brief The channel loggers and the thread they log on.
+///
+/// The loggers are declared after the thread pool so they are destroyed
+/// first, and the pool writes out anything still queued as it shuts down.
+/////////////////////////////////////////////////
+struct ChannelLoggers {
+  std::shared_ptr<spdlog::details::thread_pool> thread_pool;
+  std::array<std::shared_ptr<spdlog::async_logger>, kLogChannelCount> loggers;
+
+  ChannelLoggers()
+      : thread_pool(std::make_shared<spdlog::details::thread_pool>(
+            kLogQueueSize, 1)) {
+
+    auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    console_sink->set_pattern("[%H:%M:%S.%e] [%n] [%^%l%$] %v");
+
+    for (size_t index = 0; index < kLogChannelCount; index++) {
+      loggers[index] = std::make_shared<spdlog::async_logger>(
+          std::string{kLogChannelNames[index]}, console_sink, thread_pool,
+          spdlog::async_overflow_policy::overrun_oldest);
+      loggers[index]->set_level(kDefaultChannelLevel);
+    }
+  }
+};
+
+/////////////////////////////////////////////////
+ChannelLoggers &GetChannelLoggers() {
+  static ChannelLoggers channel_loggers;
+  return channel_loggers;
+}
+
+/////////////////////////////////////////////////
+std::optional<spdlog::level::level_enum> ParseLevel(std::string_view name) {
+  static constexpr std::array<
+      std::pair<std::string_view, spdlog::level::level_enum>, 7>
+      level_names{{{"trace", spdlog::level::trace},
+                   {"debug", spdlog::level::debug},
+                   {"info", spdlog::level::info},
+                   {"warn", spdlog::level::warn},
+                   {"error", spdlog::level::err},
+                   {"critical", spdlog::level::critical},
+                   {"off", spdlog::level::off}}};
+
+  for (const auto &[level_name, level] : level_names) {
+    if (level_name == name) {
+      return level;
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////
+spdlog::logger &GetChannelLogger(LogChannel channel) {
+  return *GetChannelLoggers().loggers[static_cast<size_t>(channel)];
+}
+
+/////////////////////////////////////////////////
+void SetChannelLevel(LogChannel channel, spdlog::level::level_enum level) {
+  GetChannelLogger(channel).set_level(level);
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+SetChannelLevels(std::string_view level_spec) {
+
+  // parse every entry before applying any, so a typo changes nothing
+  std::vector<std::pair<std::optional<LogChannel>, spdlog::level::level_enum>>
+      channel_levels;
+
+  while (!level_spec.empty()) {
+    const size_t comma = level_spec.find(',');
+    const std::string_view entry = level_spec.substr(0, comma);
+    level_spec = comma == std::string_view::npos ? std::string_view{}
+                                                 : level_spec.substr(comma + 1);
+
+    const size_t equals = entry.find('=');
+    if (equals == std::string_view::npos) {
+      return std::unexpected(FailInfo(
+          FailMode::ParameterOutOfBounds,
+          "Log level entry is not channel=level: " + std::string{entry}));
+    }
+    const std::string_view channel_name = entry.substr(0, equals);
+    const std::string_view level_name = entry.substr(equals + 1);
+
+    const auto level = ParseLevel(level_name);
+    if (!level) {
+      return std::unexpected(
+          FailInfo(FailMode::NonExistentEnumValue,
+                   "Unknown log level: " + std::string{level_name}));
+    }
+
+    // std::nullopt stands for every channel
+    if (channel_name == "all") {
+      channel_levels.emplace_back(std::nullopt, *level);
+      continue;
+    }
+
+    std::optional<LogChannel> channel;
+    for (size_t index = 0; index < kLogChannelCount; index++) {
+      if (kLogChannelNames[index] == channel_name) {
+        channel = static_cast<LogChannel>(index);
+      }
+    }
+    if (!channel) {
+      return std::unexpected(
+          FailInfo(FailMode::NonExistentEnumValue,
+                   "Unknown log channel: " + std::string{channel_name}));
+    }
+    channel_levels.emplace_back(channel, *level);
+  }
+
+  for (const auto &[channel, level] : channel_levels) {
+    if (channel) {
+      SetChannelLevel(*channel, level);
+      continue;
+    }
+    for (size_t index = 0; index < kLogChannelCount; index++) {
+      SetChannelLevel(static_cast<LogChannel>(index), level);
+    }
+  }
+  return std::monostate{};
+}
+
+/////////////////////////////////////////////////
+void FlushChannelLoggers() {
+  for (const auto &logger : GetChannelLoggers().loggers) {
+    logger->flush();
+  }
+}
+
+} // namespace steamrot
@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the per-subsystem channel loggers and logging macros
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "FailInfo.h"
+#include "spdlog/common.h"
+#include "spdlog/logger.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string_view>
+#include <variant>
+
+/////////////////////////////////////////////////
+/// Logging macros
+///
+/// Messages below STEAMROT_LOG_ACTIVE_LEVEL (the STEAMROT_LOG_LEVEL CMake
+/// cache variable) are compiled out. The rest are checked against their
+/// channel's runtime level before any argument is evaluated. A silenced
+/// message costs a call to GetChannelLogger, whose function-static loggers are
+/// guarded on every call, and an atomic load of the level. An enabled message
+/// is formatted on the calling thread, only applying the sink pattern and
+/// writing to the console is left to the background thread.
+/////////////////////////////////////////////////
+#ifndef STEAMROT_LOG_ACTIVE_LEVEL
+#define STEAMROT_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
+#define STEAMROT_LOG(channel, level, ...)                                      \
+  do {                                                                         \
+    spdlog::logger &steamrot_channel_logger =                                  \
+        ::steamrot::GetChannelLogger(channel);                                 \
+    if (steamrot_channel_logger.should_log(level)) {                           \
+      steamrot_channel_logger.log(level, __VA_ARGS__);                         \
+    }                                                                          \
+  } while (false)
+
+#if STEAMROT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define STEAMROT_LOG_TRACE(channel, ...)                                       \
+  STEAMROT_LOG(channel, spdlog::level::trace, __VA_ARGS__)
+#else
+#define STEAMROT_LOG_TRACE(channel, ...) static_cast<void>(0)
+#endif
+
+#if STEAMROT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define STEAMROT_LOG_DEBUG(channel, ...)                                       \
+  STEAMROT_LOG(channel, spdlog::level::debug, __VA_ARGS__)
+#else
+#define STEAMROT_LOG_DEBUG(channel, ...) static_cast<void>(0)
+#endif
+
+#if STEAMROT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define STEAMROT_LOG_INFO(channel, ...)                                        \
+  STEAMROT_LOG(channel, spdlog::level::info, __VA_ARGS__)
+#else
+#define STEAMROT_LOG_INFO(channel, ...) static_cast<void>(0)
+#endif
+
+#if STEAMROT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+#define STEAMROT_LOG_WARN(channel, ...)                                        \
+  STEAMROT_LOG(channel, spdlog::level::warn, __VA_ARGS__)
+#else
+#define STEAMROT_LOG_WARN(channel, ...) static_cast<void>(0)
+#endif
+
+#if STEAMROT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+#define STEAMROT_LOG_ERROR(channel, ...)                                       \
+  STEAMROT_LOG(channel, spdlog::level::err, __VA_ARGS__)
+#else
+#define STEAMROT_LOG_ERROR(channel, ...) static_cast<void>(0)
+#endif
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Subsystem a message belongs to, each has its own runtime level
+/////////////////////////////////////////////////
+enum class LogChannel : uint8_t {
+  Engine,
+  Events,
+  UI,
+  Display,
+  Entity,
+  Logic,
+};
+
+/////////////////////////////////////////////////
+/// @brief Number of LogChannel values
+/////////////////////////////////////////////////
+constexpr size_t kLogChannelCount = 6;
+static_assert(static_cast<size_t>(LogChannel::Logic) + 1 == kLogChannelCount);
+
+/////////////////////////////////////////////////
+/// @brief Names of the channels, indexed by LogChannel, as they appear in the
+/// output and in level specifications
+/////////////////////////////////////////////////
+constexpr std::array<std::string_view, kLogChannelCount> kLogChannelNames{
+    "engine", "events", "ui", "display", "entity", "logic"};
+
+/////////////////////////////////////////////////
+/// @brief Level every channel starts at, trace and debug stay silent until
+/// asked for
+/////////////////////////////////////////////////
+constexpr spdlog::level::level_enum kDefaultChannelLevel = spdlog::level::info;
+
+/////////////////////////////////////////////////
+/// @brief Return the logger of a channel
+///
+/// The channel loggers are created on first use. They share one console sink
+/// and one background thread, and drop the oldest queued message rather than
+/// block the caller when the queue is full.
+///
+/// @param channel Channel to return the logger of
+/////////////////////////////////////////////////
+spdlog::logger &GetChannelLogger(LogChannel channel);
+
+/////////////////////////////////////////////////
+/// @brief Set the level a channel logs at
+///
+/// @param channel Channel to change
+/// @param level Lowest level the channel lets through
+/////////////////////////////////////////////////
+void SetChannelLevel(LogChannel channel, spdlog::level::level_enum level);
+
+/////////////////////////////////////////////////
+/// @brief Set channel levels from a specification like "events=trace,ui=debug"
+///
+/// "all" sets every channel. Nothing is changed if any entry is invalid.
+///
+/// @param level_spec Comma separated list of channel=level entries
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+SetChannelLevels(std::string_view level_spec);
+
+/////////////////////////////////////////////////
+/// @brief Ask every channel to write out what it has queued
+/////////////////////////////////////////////////
+void FlushChannelLoggers();
+
+} // namespace steamrot
@@ -2,8 +2,9 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "log_handler.h"
+#include "ErrorLogBuffer.h"
 #include "spdlog/spdlog.h"
-#include <iostream>
+#include <stdexcept>
 
 namespace steamrot {
 namespace log_handler {
@@ -15,9 +16,11 @@ void ProcessLog(const spdlog::level::level_enum &log_level,
     ProcessInfoLog(log_code, message);
     break;
   case spdlog::level::err:
-    std::cout << " logging error: " << message << std::endl;
     ProcessErrorLog(log_code, message);
     break;
+  case spdlog::level::critical:
+    ProcessFatalLog(log_code, message);
+    break;
   default:
     break;
   }
@@ -26,28 +29,58 @@ void ProcessLog(const spdlog::level::level_enum &log_level,
 ////////////////////////////////////////////////////////////
 void ProcessInfoLog(const LogCode &log_level, const std::string &message) {
   // log info level messages
-  spdlog::get("global_logger")->info(message);
+  if (auto global_logger = spdlog::get("global_logger")) {
+    global_logger->info(message);
+  }
 };
 
 ////////////////////////////////////////////////////////////
-void ProcessErrorLog(const LogCode &log_level, const std::string &message) {
+void ProcessErrorLog(const LogCode &log_code, std::string_view message) {
 
-  // log error level messages
-  spdlog::get("global_logger")->error(message);
+  // buffer the error, FlushErrorLog writes it out later
+  GetErrorLogBuffer().Push(log_code, message);
+};
 
-  std::string jsonlastlogpattern = {
-      "{\"time\": \"%Y-%m-%dT%H:%M:%S.%f%z\", \"name\": \"%n\", \"level\": "
-      "\"%^%l%$\", \"process\": %P, \"thread\": %t, \"message\": \"%v\"}]\n}"};
-  spdlog::set_pattern(jsonlastlogpattern);
+////////////////////////////////////////////////////////////
+void ProcessFatalLog(const LogCode &log_code, const std::string &message) {
 
-  // add in finish message as deconstruction won't happen properly
-  spdlog::get("global_logger")->error("Finished.");
+  ProcessErrorLog(log_code, message);
+  FlushErrorLog();
 
-  spdlog::drop("global_logger");
-  std::cout << "error being thrown" << std::endl;
   // throw exception to cause call back on stack
   throw std::runtime_error(message);
 };
 
+////////////////////////////////////////////////////////////
+void FlushErrorLog() {
+
+  ErrorLogBuffer &error_log_buffer = GetErrorLogBuffer();
+  if (error_log_buffer.GetSize() == 0) {
+    return;
+  }
+
+  auto global_logger = spdlog::get("global_logger");
+  if (!global_logger) {
+    return;
+  }
+
+  size_t dropped_count{0};
+  for (const ErrorRecord &record : error_log_buffer.TakeRecords(dropped_count)) {
+    // keep the time the error was raised rather than the time of the flush
+    global_logger->log(record.time, spdlog::source_loc{}, spdlog::level::err,
+                       record.GetMessage());
+  }
+  if (dropped_count > 0) {
+    global_logger->error("{} errors dropped, the error log was full.",
+                         dropped_count);
+  }
+};
+
+////////////////////////////////////////////////////////////
+ErrorLogBuffer &GetErrorLogBuffer() {
+  static ErrorLogBuffer error_log_buffer;
+  return error_log_buffer;
+};
+
 } // namespace log_handler
 } // namespace steamrot
@@ -7,11 +7,15 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "spdlog/common.h"
+#include <string>
+#include <string_view>
 
 ////////////////////////////////////////////////////////////
 // namespace
 ////////////////////////////////////////////////////////////
 namespace steamrot {
+class ErrorLogBuffer;
+
 namespace log_handler {
 
 ////////////////////////////////////////////////////////////
@@ -29,7 +33,8 @@ enum class LogCode : int {
 };
 
 ////////////////////////////////////////////////////////////
-// |brief handle incoming messages and create logs
+// |brief handle incoming messages and create logs, critical messages are
+// fatal and go through ProcessFatalLog
 ////////////////////////////////////////////////////////////
 void ProcessLog(const spdlog::level::level_enum &log_level,
                 const LogCode &log_code, const std::string &message);
@@ -40,8 +45,27 @@ void ProcessLog(const spdlog::level::level_enum &log_level,
 void ProcessInfoLog(const LogCode &log_code, const std::string &message);
 
 ////////////////////////////////////////////////////////////
-// |brief process error level logs
+// |brief process error level logs, the error is buffered and written out by
+// the next FlushErrorLog, so it is cheap enough for hot loops and never throws
+////////////////////////////////////////////////////////////
+void ProcessErrorLog(const LogCode &log_code, std::string_view message);
+
+////////////////////////////////////////////////////////////
+// |brief process an unrecoverable error, flushes the error log and throws
+// std::runtime_error so the top level catch can shut the game down
+////////////////////////////////////////////////////////////
+[[noreturn]] void ProcessFatalLog(const LogCode &log_code,
+                                  const std::string &message);
+
+////////////////////////////////////////////////////////////
+// |brief hand buffered errors to the global logger, which writes them out on
+// its own thread. errors stay buffered while there is no global logger
+////////////////////////////////////////////////////////////
+void FlushErrorLog();
+
+////////////////////////////////////////////////////////////
+// |brief return the buffer errors wait in until they are flushed
 ////////////////////////////////////////////////////////////
-void ProcessErrorLog(const LogCode &log_code, const std::string &message);
+ErrorLogBuffer &GetErrorLogBuffer();
 } // namespace log_handler
 } // namespace steamrot
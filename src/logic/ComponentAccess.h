@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the ComponentAccess struct
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ArchetypeHelpers.h"
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class ComponentAccess
+/// @brief Declares what a Logic reads and writes, so Logics that cannot race
+/// each other can be run concurrently.
+///
+/////////////////////////////////////////////////
+struct ComponentAccess {
+  /////////////////////////////////////////////////
+  /// @brief Components the Logic only reads.
+  /////////////////////////////////////////////////
+  ArchetypeID reads;
+
+  /////////////////////////////////////////////////
+  /// @brief Components the Logic writes (writing implies reading).
+  /////////////////////////////////////////////////
+  ArchetypeID writes;
+
+  /////////////////////////////////////////////////
+  /// @brief Logic changes Subscribers on the EventHandler.
+  ///
+  /// Adding events is safe from any thread and needs no declaration.
+  /////////////////////////////////////////////////
+  bool writes_event_bus{false};
+
+  /////////////////////////////////////////////////
+  /// @brief Logic draws to the scene RenderTexture.
+  ///
+  /// SFML drawing is bound to the thread owning the OpenGL context, so these
+  /// Logics always run on the calling thread.
+  /////////////////////////////////////////////////
+  bool uses_scene_texture{false};
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the Logic may be handed to a worker thread.
+  /////////////////////////////////////////////////
+  bool CanRunOnWorker() const { return !uses_scene_texture; }
+
+  /////////////////////////////////////////////////
+  /// @brief Check if running alongside another Logic could race.
+  ///
+  /// @param other Access of the other Logic.
+  /////////////////////////////////////////////////
+  bool ConflictsWith(const ComponentAccess &other) const {
+
+    // a write clashes with any access to the same component
+    if ((writes & (other.reads | other.writes)).any() ||
+        (other.writes & reads).any()) {
+      return true;
+    }
+
+    return (writes_event_bus && other.writes_event_bus) ||
+           (uses_scene_texture && other.uses_scene_texture);
+  }
+};
+
+} // namespace steamrot
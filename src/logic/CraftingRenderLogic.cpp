@@ -4,10 +4,7 @@
 /////////////////////////////////////////////////
 
 #include "CraftingRenderLogic.h"
-#include "ArchetypeHelpers.h"
-#include "ArchetypeManager.h"
 #include "CGrimoireMachina.h"
-#include "emp_helpers.h"
 #include "fragments_generated.h"
 #include "log_handler.h"
 
@@ -15,7 +12,13 @@ namespace steamrot {
 
 /////////////////////////////////////////////////
 CraftingRenderLogic::CraftingRenderLogic(const LogicContext logic_context)
-    : Logic(logic_context) {}
+    : Logic(logic_context),
+      m_grimoire_view(m_logic_context.scene_entities,
+                      m_logic_context.archetype_manager) {
+
+  m_component_access.reads = GenerateArchetypeIDfromTypes<CGrimoireMachina>();
+  m_component_access.uses_scene_texture = true;
+}
 
 /////////////////////////////////////////////////
 void CraftingRenderLogic::ProcessLogic() {
@@ -27,30 +30,25 @@ void CraftingRenderLogic::ProcessLogic() {
 /////////////////////////////////////////////////
 void CraftingRenderLogic::DrawMachinaForm() {
 
-  // get required archetype ID for CGrimoireMachina
-  ArchetypeID archetype_id = GenerateArchetypeIDfromTypes<CGrimoireMachina>();
-  const auto it = m_logic_context.archetypes.find(archetype_id);
+  const size_t grimoire_count = m_grimoire_view.GetEntityCount();
 
-  // If the archetype is not found, return early
-  if (it == m_logic_context.archetypes.end()) {
+  // If there is no CGrimoireMachina, return early
+  if (grimoire_count == 0) {
     return;
   }
 
-  const Archetype archetype = it->second;
-  // Check if the archetype is greater than 1 and log an error if so
-  if (archetype.size() > 1) {
-    log_handler::ProcessLog(
-        spdlog::level::level_enum::err, log_handler::LogCode::kNoCode,
+  // Check if there is more than 1 and log an error if so, the error is only
+  // buffered so this is cheap enough to hit every frame
+  if (grimoire_count > 1) {
+    log_handler::ProcessErrorLog(
+        log_handler::LogCode::kNoCode,
         "CraftingRenderLogic: More than one CGrimoireMachina found in the "
-        "archetype, expected only one.");
+        "scene, expected only one.");
     return;
   }
 
-  // Get the first entity in the archetype and pull out the CGrimoireMachina
-  // component
-  CGrimoireMachina &grimoire_machina =
-      emp_helpers::GetComponent<CGrimoireMachina>(
-          archetype[0], m_logic_context.scene_entities);
+  // Pull out the CGrimoireMachina component of the only matching entity
+  auto [entity_id, grimoire_machina] = *m_grimoire_view.begin();
 
   // Check if the holding form is not null, return early if it is
   if (!grimoire_machina.m_holding_form) {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Logic.h"
+#include "View.h"
 
 namespace steamrot {
 class CraftingRenderLogic : public Logic {
@@ -34,6 +35,11 @@ private:
   /////////////////////////////////////////////////
   void RenderFragment(Fragment &fragment);
 
+  /////////////////////////////////////////////////
+  /// @brief All entities with a CGrimoireMachina component
+  /////////////////////////////////////////////////
+  View<CGrimoireMachina> m_grimoire_view;
+
 public:
   /////////////////////////////////////////////////
   /// @brief Constructor for CraftingRenderLogic taking in a LogicContext
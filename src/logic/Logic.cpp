@@ -7,6 +7,8 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "Logic.h"
+#include "Profiler.h"
+#include <typeinfo>
 
 namespace steamrot {
 
@@ -15,6 +17,23 @@ Logic::Logic(const LogicContext logic_context)
     : m_logic_context(logic_context) {}
 
 /////////////////////////////////////////////////
-void Logic::RunLogic() { ProcessLogic(); }
+void Logic::RunLogic() {
+  // zones are named by the concrete Logic type, demangled when the trace is
+  // written
+  [[maybe_unused]] const std::type_info &logic_type = typeid(*this);
+  STEAMROT_PROFILE_ZONE(logic_type.name());
+
+  ProcessLogic();
+}
+
+/////////////////////////////////////////////////
+const ComponentAccess &Logic::GetComponentAccess() const {
+  return m_component_access;
+}
+
+/////////////////////////////////////////////////
+const std::vector<std::type_index> &Logic::GetRunAfter() const {
+  return m_run_after;
+}
 
 } // namespace steamrot
@@ -11,7 +11,10 @@
 /////////////////////////////////////////////////
 /// Headers
 /////////////////////////////////////////////////
+#include "ComponentAccess.h"
 #include "LogicContext.h"
+#include <typeindex>
+#include <vector>
 namespace steamrot {
 
 using EntityIndicies = std::vector<size_t>;
@@ -33,6 +36,27 @@ protected:
   /////////////////////////////////////////////////
   LogicContext m_logic_context;
 
+  /////////////////////////////////////////////////
+  /// @brief Components and shared resources the Logic touches, set by each
+  /// derived constructor.
+  /////////////////////////////////////////////////
+  ComponentAccess m_component_access;
+
+  /////////////////////////////////////////////////
+  /// @brief Logic types that must have run before this Logic each frame.
+  /////////////////////////////////////////////////
+  std::vector<std::type_index> m_run_after;
+
+  /////////////////////////////////////////////////
+  /// @brief Declare that this Logic must run after any Logic of type T.
+  ///
+  /// Only needed for ordering that ComponentAccess cannot express (e.g. draw
+  /// order), constraints on types not present in the Scene are ignored.
+  ///
+  /// @tparam T Logic type to run after.
+  /////////////////////////////////////////////////
+  template <typename T> void RunAfter() { m_run_after.emplace_back(typeid(T)); }
+
 public:
   /////////////////////////////////////////////////
   /// @brief Constructor for the Logic class.
@@ -54,5 +78,15 @@ public:
   /// to be run
   /////////////////////////////////////////////////
   void RunLogic();
+
+  /////////////////////////////////////////////////
+  /// @brief Returns what the Logic reads and writes.
+  /////////////////////////////////////////////////
+  const ComponentAccess &GetComponentAccess() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the Logic types this Logic must run after.
+  /////////////////////////////////////////////////
+  const std::vector<std::type_index> &GetRunAfter() const;
 };
 } // namespace steamrot
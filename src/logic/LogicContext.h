@@ -15,6 +15,8 @@
 #include "ArchetypeManager.h"
 #include "AssetManager.h"
 #include "EventHandler.h"
+#include "InputState.h"
+#include "JobSystem.h"
 #include "containers.h"
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <unordered_map>
@@ -32,9 +34,11 @@ struct LogicContext {
   EntityMemoryPool &scene_entities;
 
   /////////////////////////////////////////////////
-  /// @brief Reference to the available archetypes in the Scene.
+  /// @brief Reference to the ArchetypeManager for the Scene.
+  ///
+  /// Logic should query entities through a View rather than the raw map.
   /////////////////////////////////////////////////
-  const std::unordered_map<ArchetypeID, Archetype> &archetypes;
+  const ArchetypeManager &archetype_manager;
 
   /////////////////////////////////////////////////
   /// @brief Reference to the RenderTexture for the Scene.
@@ -58,9 +62,23 @@ struct LogicContext {
   /////////////////////////////////////////////////
   EventHandler &event_handler;
 
+  /////////////////////////////////////////////////
+  /// @brief Reference to the JobSystem for the game.
+  ///
+  /// Logic can opt into splitting its entities across workers with
+  /// View::ParallelForEach.
+  /////////////////////////////////////////////////
+  JobSystem &job_system;
+
   /////////////////////////////////////////////////
   /// @brief Reference to mouse position in the game window. (local).
   /////////////////////////////////////////////////
   const sf::Vector2i &mouse_position{0, 0};
+
+  /////////////////////////////////////////////////
+  /// @brief Reference to the keys and mouse buttons down this tick and the
+  /// tick before.
+  /////////////////////////////////////////////////
+  const InputState &input_state;
 };
 } // namespace steamrot
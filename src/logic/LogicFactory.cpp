@@ -17,8 +17,10 @@
 namespace steamrot {
 /////////////////////////////////////////////////
 LogicFactory::LogicFactory(const SceneType scene_type,
-                           const LogicContext &logic_context)
-    : m_scene_type(scene_type), m_logic_context(logic_context) {}
+                           const LogicContext &logic_context,
+                           const DisplayMode display_mode)
+    : m_scene_type(scene_type), m_logic_context(logic_context),
+      m_display_mode(display_mode) {}
 
 /////////////////////////////////////////////////
 std::expected<LogicCollection, FailInfo> LogicFactory::CreateLogicMap() {
@@ -50,11 +52,49 @@ std::expected<LogicCollection, FailInfo> LogicFactory::CreateLogicMap() {
   return logic_collection;
 }
 
+/////////////////////////////////////////////////
+std::expected<SceneLogicSchedules, FailInfo>
+LogicFactory::CreateLogicSchedules() {
+
+  auto logic_map_result = CreateLogicMap();
+  if (!logic_map_result.has_value()) {
+    return std::unexpected(logic_map_result.error());
+  }
+  LogicCollection &logic_map = logic_map_result.value();
+
+  // flatten the simulation logic in declared order
+  LogicVector update_logics;
+  for (LogicType logic_type : {LogicType::Action, LogicType::Collision}) {
+    for (auto &logic : logic_map[logic_type]) {
+      update_logics.push_back(std::move(logic));
+    }
+  }
+
+  auto update_schedule_result = LogicSchedule::Build(std::move(update_logics));
+  if (!update_schedule_result.has_value()) {
+    return std::unexpected(update_schedule_result.error());
+  }
+
+  auto render_schedule_result =
+      LogicSchedule::Build(std::move(logic_map[LogicType::Render]));
+  if (!render_schedule_result.has_value()) {
+    return std::unexpected(render_schedule_result.error());
+  }
+
+  return SceneLogicSchedules{std::move(update_schedule_result.value()),
+                             std::move(render_schedule_result.value())};
+}
+
 /////////////////////////////////////////////////
 std::expected<LogicVector, FailInfo> LogicFactory::CreateRenderLogics() {
 
   LogicVector render_logics;
 
+  // nothing is drawn in headless mode
+  if (m_display_mode == DisplayMode::Headless) {
+    return render_logics;
+  }
+
   switch (m_scene_type) {
   case SceneType::SceneType_TITLE: {
     render_logics.push_back(std::make_unique<UIRenderLogic>(m_logic_context));
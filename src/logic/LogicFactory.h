@@ -11,21 +11,45 @@
 /////////////////////////////////////////////////
 /// Headers
 /////////////////////////////////////////////////
+#include "GameContext.h"
 #include "Logic.h"
+#include "LogicSchedule.h"
 #include "scene_change_packet_generated.h"
 #include <expected>
 #include <memory>
 #include <unordered_map>
 namespace steamrot {
 
+/////////////////////////////////////////////////
+/// @brief Groups Logic by what it does. Action and Collision Logic runs on
+/// each simulation tick, in that declared order, Render Logic runs once per
+/// rendered frame.
+/////////////////////////////////////////////////
 enum class LogicType {
   Collision,
   Render,
   Action,
   Movement,
 };
-using LogicVector = std::vector<std::unique_ptr<Logic>>;
 using LogicCollection = std::unordered_map<LogicType, LogicVector>;
+
+/////////////////////////////////////////////////
+/// @class SceneLogicSchedules
+/// @brief The LogicSchedules a Scene runs, split by the rate they run at.
+///
+/////////////////////////////////////////////////
+struct SceneLogicSchedules {
+  /////////////////////////////////////////////////
+  /// @brief Logic run once per simulation tick.
+  /////////////////////////////////////////////////
+  LogicSchedule update_schedule;
+
+  /////////////////////////////////////////////////
+  /// @brief Logic run once per rendered frame.
+  /////////////////////////////////////////////////
+  LogicSchedule render_schedule;
+};
+
 /////////////////////////////////////////////////
 /// @class LogicFactory
 /// @brief Provides Logic objects for Scenes to store and use.
@@ -44,6 +68,11 @@ private:
   /////////////////////////////////////////////////
   LogicContext m_logic_context;
 
+  /////////////////////////////////////////////////
+  /// @brief DisplayMode of the game, no Render Logic is created when Headless.
+  /////////////////////////////////////////////////
+  const DisplayMode m_display_mode;
+
   /////////////////////////////////////////////////
   /// @brief Create a vector of logic objects specifically for collision
   ///
@@ -66,13 +95,24 @@ public:
   ///
   /// @param logic_context LogicContext object containing references to the
   /// scene
+  /// @param display_mode DisplayMode of the game
   /////////////////////////////////////////////////
-  LogicFactory(const SceneType scene_type, const LogicContext &logic_context);
+  LogicFactory(const SceneType scene_type, const LogicContext &logic_context,
+               const DisplayMode display_mode = DisplayMode::Windowed);
 
   /////////////////////////////////////////////////
   /// @brief Create and return a map of logic objects.
   ///
   /////////////////////////////////////////////////
   std::expected<LogicCollection, FailInfo> CreateLogicMap();
+
+  /////////////////////////////////////////////////
+  /// @brief Create the Logic and build it into LogicSchedules.
+  ///
+  /// Action and Collision Logic make up the update schedule, declared in that
+  /// order, which settles the order of any Logics that conflict and have no
+  /// RunAfter constraint. Render Logic makes up the render schedule.
+  /////////////////////////////////////////////////
+  std::expected<SceneLogicSchedules, FailInfo> CreateLogicSchedules();
 };
 } // namespace steamrot
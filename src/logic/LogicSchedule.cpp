@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the LogicSchedule class.
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "LogicSchedule.h"
+#include <algorithm>
+#include <typeindex>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+std::expected<LogicSchedule, FailInfo>
+LogicSchedule::Build(LogicVector logics) {
+
+  const size_t logic_count = logics.size();
+
+  // resolve RunAfter constraints into the indexes of the Logic they name
+  std::vector<std::vector<size_t>> run_after_indexes(logic_count);
+  for (size_t later = 0; later < logic_count; ++later) {
+    for (const std::type_index &run_after : logics[later]->GetRunAfter()) {
+      for (size_t earlier = 0; earlier < logic_count; ++earlier) {
+        const Logic &earlier_logic = *logics[earlier];
+        if (earlier != later && std::type_index(typeid(earlier_logic)) ==
+                                    run_after) {
+          run_after_indexes[later].push_back(earlier);
+        }
+      }
+    }
+  }
+
+  // topological sort over the constraints, always taking the earliest
+  // declared Logic that is ready so declaration order breaks every tie
+  std::vector<size_t> order;
+  std::vector<bool> placed(logic_count, false);
+  order.reserve(logic_count);
+
+  while (order.size() < logic_count) {
+    bool progress = false;
+
+    for (size_t index = 0; index < logic_count; ++index) {
+      if (placed[index]) {
+        continue;
+      }
+
+      const bool ready = std::ranges::all_of(
+          run_after_indexes[index],
+          [&placed](size_t earlier) { return placed[earlier]; });
+
+      if (ready) {
+        placed[index] = true;
+        order.push_back(index);
+        progress = true;
+        break;
+      }
+    }
+
+    if (!progress) {
+      return std::unexpected(
+          FailInfo{FailMode::DependencyCycle,
+                   "Logic RunAfter constraints form a cycle"});
+    }
+  }
+
+  // each Logic goes one stage after the latest Logic it depends on, either
+  // through a constraint or because their ComponentAccess conflicts
+  std::vector<size_t> stage_of(logic_count, 0);
+  size_t stage_count = 0;
+
+  for (size_t position = 0; position < logic_count; ++position) {
+    const size_t later = order[position];
+    const ComponentAccess &later_access = logics[later]->GetComponentAccess();
+    size_t stage = 0;
+
+    for (size_t previous = 0; previous < position; ++previous) {
+      const size_t earlier = order[previous];
+
+      const bool depends =
+          std::ranges::find(run_after_indexes[later], earlier) !=
+              run_after_indexes[later].end() ||
+          later_access.ConflictsWith(logics[earlier]->GetComponentAccess());
+
+      if (depends) {
+        stage = std::max(stage, stage_of[earlier] + 1);
+      }
+    }
+
+    stage_of[later] = stage;
+    stage_count = std::max(stage_count, stage + 1);
+  }
+
+  // flatten into one vector grouped by stage
+  LogicSchedule schedule;
+  schedule.m_execution_order.reserve(logic_count);
+  schedule.m_stage_ends.reserve(stage_count);
+
+  for (size_t stage = 0; stage < stage_count; ++stage) {
+    for (size_t index : order) {
+      if (stage_of[index] == stage) {
+        schedule.m_execution_order.push_back(logics[index].get());
+      }
+    }
+    schedule.m_stage_ends.push_back(schedule.m_execution_order.size());
+  }
+
+  schedule.m_logics = std::move(logics);
+  return schedule;
+}
+
+/////////////////////////////////////////////////
+void LogicSchedule::Run(JobSystem &job_system) {
+
+  size_t stage_start = 0;
+
+  for (size_t stage_end : m_stage_ends) {
+
+    // a lone Logic is not worth a job
+    if (stage_end - stage_start == 1) {
+      m_execution_order[stage_start]->RunLogic();
+      stage_start = stage_end;
+      continue;
+    }
+
+    JobCounter counter;
+    for (size_t i = stage_start; i < stage_end; ++i) {
+      Logic *logic = m_execution_order[i];
+      if (logic->GetComponentAccess().CanRunOnWorker()) {
+        job_system.Submit([logic]() { logic->RunLogic(); }, counter);
+      }
+    }
+
+    // drawing Logics run here while the workers get on with the rest
+    for (size_t i = stage_start; i < stage_end; ++i) {
+      Logic *logic = m_execution_order[i];
+      if (!logic->GetComponentAccess().CanRunOnWorker()) {
+        logic->RunLogic();
+      }
+    }
+
+    job_system.Wait(counter);
+    stage_start = stage_end;
+  }
+}
+
+/////////////////////////////////////////////////
+bool LogicSchedule::IsEmpty() const { return m_logics.empty(); }
+
+/////////////////////////////////////////////////
+size_t LogicSchedule::GetStageCount() const { return m_stage_ends.size(); }
+
+/////////////////////////////////////////////////
+std::span<Logic *const> LogicSchedule::GetStage(size_t stage_index) const {
+
+  const size_t stage_start =
+      stage_index == 0 ? 0 : m_stage_ends[stage_index - 1];
+
+  return std::span<Logic *const>(m_execution_order.data() + stage_start,
+                                 m_stage_ends[stage_index] - stage_start);
+}
+
+/////////////////////////////////////////////////
+const std::vector<Logic *> &LogicSchedule::GetExecutionOrder() const {
+  return m_execution_order;
+}
+
+} // namespace steamrot
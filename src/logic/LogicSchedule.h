@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the LogicSchedule class.
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "FailInfo.h"
+#include "JobSystem.h"
+#include "Logic.h"
+#include <expected>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace steamrot {
+
+using LogicVector = std::vector<std::unique_ptr<Logic>>;
+
+/////////////////////////////////////////////////
+/// @class LogicSchedule
+/// @brief Owns a Scene's Logic and runs it in a precomputed order.
+///
+/// The dependency graph is built once from each Logic's ComponentAccess and
+/// RunAfter constraints and flattened into stages. Logics in the same stage
+/// cannot race, so each stage runs concurrently on the JobSystem (Logics that
+/// draw stay on the calling thread) and the frame only walks a vector.
+/////////////////////////////////////////////////
+class LogicSchedule {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Owned Logic, in the order it was declared.
+  /////////////////////////////////////////////////
+  LogicVector m_logics;
+
+  /////////////////////////////////////////////////
+  /// @brief Logic grouped by stage, stages in execution order.
+  /////////////////////////////////////////////////
+  std::vector<Logic *> m_execution_order;
+
+  /////////////////////////////////////////////////
+  /// @brief End offset of each stage in m_execution_order.
+  /////////////////////////////////////////////////
+  std::vector<size_t> m_stage_ends;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Default constructor, creates an empty schedule.
+  /////////////////////////////////////////////////
+  LogicSchedule() = default;
+
+  /////////////////////////////////////////////////
+  /// @brief Build a schedule from a vector of Logic.
+  ///
+  /// RunAfter constraints are applied first, and declaration order settles
+  /// everything else, so any two Logics whose ComponentAccess conflicts keep
+  /// their declared order unless a constraint says otherwise.
+  ///
+  /// @param logics Logic to schedule, in declared order.
+  /// @return The schedule, or DependencyCycle if the RunAfter constraints
+  /// form a cycle.
+  /////////////////////////////////////////////////
+  static std::expected<LogicSchedule, FailInfo> Build(LogicVector logics);
+
+  /////////////////////////////////////////////////
+  /// @brief Run every stage in order, waiting for each before the next.
+  ///
+  /// @param job_system JobSystem to run concurrent stages on.
+  /////////////////////////////////////////////////
+  void Run(JobSystem &job_system);
+
+  /////////////////////////////////////////////////
+  /// @brief Check if the schedule has no Logic.
+  /////////////////////////////////////////////////
+  bool IsEmpty() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the number of stages.
+  /////////////////////////////////////////////////
+  size_t GetStageCount() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the Logic in a stage.
+  ///
+  /// @param stage_index Index of the stage.
+  /////////////////////////////////////////////////
+  std::span<Logic *const> GetStage(size_t stage_index) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Returns every Logic in execution order.
+  /////////////////////////////////////////////////
+  const std::vector<Logic *> &GetExecutionOrder() const;
+};
+
+} // namespace steamrot
@@ -3,48 +3,39 @@
 /// @brief Implementation of the UIEventLogic class.
 /////////////////////////////////////////////////
 #include "UIActionLogic.h"
-#include "ArchetypeHelpers.h"
-#include "ArchetypeManager.h"
 #include "CGrimoireMachina.h"
 #include "CUserInterface.h"
 #include "DropDownItemElement.h"
 #include "DropDownListElement.h"
 #include "Logic.h"
-#include "emp_helpers.h"
+#include "log_channel.h"
 #include "ui_helpers.h"
 #include <SFML/Window/Mouse.hpp>
-#include <iostream>
 
 using namespace magic_enum::bitwise_operators;
 namespace steamrot {
 /////////////////////////////////////////////////
 UIActionLogic::UIActionLogic(const LogicContext logic_context)
-    : Logic(logic_context) {}
+    : Logic(logic_context), m_ui_view(m_logic_context.scene_entities,
+                                      m_logic_context.archetype_manager) {
+
+  // drop downs are populated from the CGrimoireMachina, and buttons add their
+  // response events to the event bus and turn off their Subscribers
+  m_component_access.reads = GenerateArchetypeIDfromTypes<CGrimoireMachina>();
+  m_component_access.writes = GenerateArchetypeIDfromTypes<CUserInterface>();
+  m_component_access.writes_event_bus = true;
+}
 
 /////////////////////////////////////////////////
 void UIActionLogic::ProcessLogic() {
 
-  ArchetypeID archetype_id = GenerateArchetypeIDfromTypes<CUserInterface>();
-
-  const auto it = m_logic_context.archetypes.find(archetype_id);
-  // if it is not in the archetyps map, then skip
-  if (it != m_logic_context.archetypes.end()) {
-
-    // get the archetype from the map
-    const Archetype &archetype = it->second;
-
-    // cycle through all the entity indexs in the archetype
-    for (size_t entity_id : archetype) {
+  // cycle through every entity with a CUserInterface component
+  for (auto [entity_id, ui_component] : m_ui_view) {
 
-      // get the CUserInterface component
-      CUserInterface &ui_component = emp_helpers::GetComponent<CUserInterface>(
-          entity_id, m_logic_context.scene_entities);
-
-      // Perform any aciton logic here, processing nested elements recursively
-      ProcessNestedUIActionsAndEvents(*ui_component.m_root_element,
-                                      m_logic_context.event_handler,
-                                      m_logic_context);
-    }
+    // Perform any aciton logic here, processing nested elements recursively
+    ProcessNestedUIActionsAndEvents(*ui_component.m_root_element,
+                                    m_logic_context.event_handler,
+                                    m_logic_context);
   }
 }
 
@@ -117,17 +108,16 @@ void ProcessButtonElementActions(ButtonElement &button_element,
 
   // for now, all buttons need a mouse over to be clicked, so this will be the
   // top level flow control
-  std::cout << "Processing Button Element Actions" << std::endl;
   if (button_element.is_mouse_over) {
 
-    std::cout << "Button is mouse over, checking for click" << std::endl;
     // check if button has an event packet. for now, all event packets are sent
     // to the global event bus
-    if (button_element.response_event.has_value())
-
-      std::cout << "Button has response event, adding to event bus"
-                << std::endl;
-    event_handler.AddEvent(button_element.response_event.value());
+    if (button_element.response_event.has_value()) {
+      STEAMROT_LOG_TRACE(
+          LogChannel::UI, "button response event type={}",
+          EnumNameEventType(button_element.response_event->m_event_type));
+      event_handler.AddEvent(button_element.response_event.value());
+    }
   }
 }
 
@@ -146,68 +136,54 @@ void ProcessDropDownListElementActions(
   switch (dropdown_list_element.data_populate_function) {
   case DataPopulateFunction::DataPopulateFunction_PopulateWithFragmentData: {
     // Find CGrimoireMachina in the scene
-    ArchetypeID grimoire_archetype_id =
-        GenerateArchetypeIDfromTypes<CGrimoireMachina>();
-
-    const auto it = logic_context.archetypes.find(grimoire_archetype_id);
-    if (it != logic_context.archetypes.end()) {
-      const Archetype &archetype = it->second;
-
-      // Get the first entity with CGrimoireMachina (should only be one)
-      if (!archetype.empty()) {
-        size_t entity_id = *archetype.begin();
-        const CGrimoireMachina &grimoire_machina =
-            emp_helpers::GetComponent<CGrimoireMachina>(
-                entity_id, logic_context.scene_entities);
-
-        // Get all fragment names
-        std::vector<std::string> fragment_names =
-            ui_helpers::GetAllFragmentNames(grimoire_machina);
-
-        // Clear existing child elements
-        dropdown_list_element.child_elements.clear();
-
-        // Create DropDownItemElements for each fragment
-        for (const std::string &fragment_name : fragment_names) {
-          auto item = std::make_unique<DropDownItemElement>();
-          item->label = fragment_name;
-          item->value = fragment_name;
-          dropdown_list_element.child_elements.push_back(std::move(item));
-        }
+    View<CGrimoireMachina> grimoire_view(logic_context.scene_entities,
+                                         logic_context.archetype_manager);
+
+    // Get the first entity with CGrimoireMachina (should only be one)
+    const auto it = grimoire_view.begin();
+    if (it != grimoire_view.end()) {
+      const auto [entity_id, grimoire_machina] = *it;
+
+      // Get all fragment names
+      std::vector<std::string> fragment_names =
+          ui_helpers::GetAllFragmentNames(grimoire_machina);
+
+      // Clear existing child elements
+      dropdown_list_element.ClearChildElements();
+
+      // Create DropDownItemElements for each fragment
+      for (const std::string &fragment_name : fragment_names) {
+        auto item = std::make_unique<DropDownItemElement>();
+        item->label = fragment_name;
+        item->value = fragment_name;
+        dropdown_list_element.AddChildElement(std::move(item));
       }
     }
     break;
   }
   case DataPopulateFunction::DataPopulateFunction_PopulateWithJointData: {
     // Find CGrimoireMachina in the scene
-    ArchetypeID grimoire_archetype_id =
-        GenerateArchetypeIDfromTypes<CGrimoireMachina>();
-
-    const auto it = logic_context.archetypes.find(grimoire_archetype_id);
-    if (it != logic_context.archetypes.end()) {
-      const Archetype &archetype = it->second;
-
-      // Get the first entity with CGrimoireMachina (should only be one)
-      if (!archetype.empty()) {
-        size_t entity_id = *archetype.begin();
-        const CGrimoireMachina &grimoire_machina =
-            emp_helpers::GetComponent<CGrimoireMachina>(
-                entity_id, logic_context.scene_entities);
-
-        // Get all joint names
-        std::vector<std::string> joint_names =
-            ui_helpers::GetAllJointNames(grimoire_machina);
-
-        // Clear existing child elements
-        dropdown_list_element.child_elements.clear();
-
-        // Create DropDownItemElements for each joint
-        for (const std::string &joint_name : joint_names) {
-          auto item = std::make_unique<DropDownItemElement>();
-          item->label = joint_name;
-          item->value = joint_name;
-          dropdown_list_element.child_elements.push_back(std::move(item));
-        }
+    View<CGrimoireMachina> grimoire_view(logic_context.scene_entities,
+                                         logic_context.archetype_manager);
+
+    // Get the first entity with CGrimoireMachina (should only be one)
+    const auto it = grimoire_view.begin();
+    if (it != grimoire_view.end()) {
+      const auto [entity_id, grimoire_machina] = *it;
+
+      // Get all joint names
+      std::vector<std::string> joint_names =
+          ui_helpers::GetAllJointNames(grimoire_machina);
+
+      // Clear existing child elements
+      dropdown_list_element.ClearChildElements();
+
+      // Create DropDownItemElements for each joint
+      for (const std::string &joint_name : joint_names) {
+        auto item = std::make_unique<DropDownItemElement>();
+        item->label = joint_name;
+        item->value = joint_name;
+        dropdown_list_element.AddChildElement(std::move(item));
       }
     }
     break;
@@ -216,9 +192,9 @@ void ProcessDropDownListElementActions(
     // Already handled above
     break;
   default:
-    std::cout << "Warning: Unhandled DataPopulateFunction value: "
-              << static_cast<int>(dropdown_list_element.data_populate_function)
-              << std::endl;
+    STEAMROT_LOG_WARN(
+        LogChannel::UI, "unhandled data populate function value={}",
+        static_cast<int>(dropdown_list_element.data_populate_function));
     break;
   }
 }
@@ -7,6 +7,7 @@
 #include "DropDownListElement.h"
 #include "EventHandler.h"
 #include "Logic.h"
+#include "View.h"
 
 namespace steamrot {
 
@@ -19,6 +20,11 @@ private:
   /////////////////////////////////////////////////
   void ProcessLogic() override;
 
+  /////////////////////////////////////////////////
+  /// @brief All entities with a CUserInterface component
+  /////////////////////////////////////////////////
+  View<CUserInterface> m_ui_view;
+
 public:
   /////////////////////////////////////////////////
   /// @brief COnstructor for UIEventLogic.
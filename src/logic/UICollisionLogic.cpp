@@ -1,42 +1,41 @@
 #include "UICollisionLogic.h"
-#include "ArchetypeHelpers.h"
 #include "CUserInterface.h"
 #include "collision.h"
-#include "emp_helpers.h"
+#include "ui_layout.h"
 #include <SFML/Window/Mouse.hpp>
 
 namespace steamrot {
 /////////////////////////////////////////////////
 UICollisionLogic::UICollisionLogic(const LogicContext logic_context)
-    : Logic(logic_context) {}
+    : Logic(logic_context), m_ui_view(m_logic_context.scene_entities,
+                                      m_logic_context.archetype_manager) {
+
+  m_component_access.writes = GenerateArchetypeIDfromTypes<CUserInterface>();
+}
 
 /////////////////////////////////////////////////
 void UICollisionLogic::ProcessLogic() {
 
-  // generate required archetype id
-  ArchetypeID archetype_id = GenerateArchetypeIDfromTypes<CUserInterface>();
-
-  // check if archetype exists
-  auto const it = m_logic_context.archetypes.find(archetype_id);
-
-  // if archetype does not exist, we return
-  if (it == m_logic_context.archetypes.end()) {
-    return;
+  // hit testing needs the children where they will be drawn
+  const UIStyle &style = m_logic_context.asset_manager.GetDefaultUIStyle();
+  m_root_elements.clear();
+  for (auto [entity_id, ui_component] : m_ui_view) {
+    ui_layout::LayOutUIElements(*ui_component.m_root_element, style);
+    m_root_elements.push_back(ui_component.m_root_element.get());
   }
 
-  // get the archetype
-  Archetype archetype = it->second;
-
-  // cycle through all the entity indexs in the archetype
-  for (size_t entity_id : archetype) {
-
-    // get the CUserInterface component
-    CUserInterface &ui_component = emp_helpers::GetComponent<CUserInterface>(
-        entity_id, m_logic_context.scene_entities);
+  if (m_ui_index.Update(m_root_elements)) {
+    // the hovered element may have been destroyed, so start again from every
+    // element that still exists
+    for (UIElement *element : m_ui_index.GetElements()) {
+      element->is_mouse_over = false;
+    }
+    m_hovered_element = nullptr;
+  }
 
-    collision::CheckMouseOverNestedUIElement(m_logic_context.mouse_position,
-                                             *ui_component.m_root_element);
-  };
+  // one element across every tree is hovered, the topmost one
+  m_hovered_element = collision::UpdateMouseOverFromIndex(
+      m_logic_context.mouse_position, m_ui_index, m_hovered_element);
 }
 
 } // namespace steamrot
@@ -4,6 +4,9 @@
 /////////////////////////////////////////////////
 
 #include "Logic.h"
+#include "UISpatialIndex.h"
+#include "View.h"
+#include <vector>
 
 namespace steamrot {
 class UICollisionLogic : public Logic {
@@ -14,6 +17,26 @@ private:
   /////////////////////////////////////////////////
   void ProcessLogic() override;
 
+  /////////////////////////////////////////////////
+  /// @brief All entities with a CUserInterface component
+  /////////////////////////////////////////////////
+  View<CUserInterface> m_ui_view;
+
+  /////////////////////////////////////////////////
+  /// @brief Grid over every UI tree in the scene, rebuilt after layout
+  /////////////////////////////////////////////////
+  UISpatialIndex m_ui_index;
+
+  /////////////////////////////////////////////////
+  /// @brief Root of each UI tree in draw order, reused between frames
+  /////////////////////////////////////////////////
+  std::vector<UIElement *> m_root_elements;
+
+  /////////////////////////////////////////////////
+  /// @brief Element with is_mouse_over set, null if there is none
+  /////////////////////////////////////////////////
+  UIElement *m_hovered_element{nullptr};
+
 public:
   /////////////////////////////////////////////////
   /// @brief Constructor for UICollisionLogic taking in a LogicContext
@@ -2,16 +2,27 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "UIRenderLogic.h"
+#include "CraftingRenderLogic.h"
 #include "Logic.h"
 #include "draw_ui_elements.h"
 #include "emp_helpers.h"
+#include "ui_layout.h"
 #include <SFML/Graphics.hpp>
 
 namespace steamrot {
 
 /////////////////////////////////////////////////////////////
 UIRenderLogic::UIRenderLogic(const LogicContext logic_context)
-    : Logic(logic_context) {}
+    : Logic(logic_context), m_ui_view(m_logic_context.scene_entities,
+                                      m_logic_context.archetype_manager) {
+
+  // the UI is laid out before drawing if anything changed since the last tick
+  m_component_access.writes = GenerateArchetypeIDfromTypes<CUserInterface>();
+  m_component_access.uses_scene_texture = true;
+
+  // the UI is drawn over anything else in the scene
+  RunAfter<CraftingRenderLogic>();
+}
 
 ////////////////////////////////////////////////////
 void UIRenderLogic::ProcessLogic() {
@@ -25,26 +36,16 @@ void UIRenderLogic::ProcessLogic() {
 
 void UIRenderLogic::DrawUIElements() {
 
-  ArchetypeID archetype_id = GenerateArchetypeIDfromTypes<CUserInterface>();
-
-  const auto it = m_logic_context.archetypes.find(archetype_id);
-  // if it is not in the archetypes map, then return
-  if (it == m_logic_context.archetypes.end()) {
-    return;
-  }
-
-  Archetype archetype = it->second;
-
-  // cycle through all the entity indexs in the archetype
-  for (size_t entity_id : archetype) {
+  // cycle through every entity with a CUserInterface component
+  const UIStyle &style = m_logic_context.asset_manager.GetDefaultUIStyle();
+  for (auto [entity_id, ui_component] : m_ui_view) {
 
-    // get the CUserInterface component
-    CUserInterface &ui_component = emp_helpers::GetComponent<CUserInterface>(
-        entity_id, m_logic_context.scene_entities);
+    ui_layout::LayOutUIElements(*ui_component.m_root_element, style);
 
-    draw_ui_elements::DrawNestedUIElements(
-        m_logic_context.scene_texture, *ui_component.m_root_element,
-        m_logic_context.asset_manager.GetDefaultUIStyle());
+    // an unchanged tree is composited from its cache as a single quad
+    ui_component.m_ui_batch.Update(*ui_component.m_root_element, style);
+    ui_component.m_ui_render_cache.Draw(m_logic_context.scene_texture,
+                                        ui_component.m_ui_batch);
   }
 }
 
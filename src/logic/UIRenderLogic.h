@@ -13,6 +13,7 @@
 // headers
 ////////////////////////////////////////////////////////////
 #include "Logic.h"
+#include "View.h"
 
 namespace steamrot {
 
@@ -28,6 +29,11 @@ private:
   /////////////////////////////////////////////////
   void DrawUIElements();
 
+  /////////////////////////////////////////////////
+  /// @brief All entities with a CUserInterface component
+  /////////////////////////////////////////////////
+  View<CUserInterface> m_ui_view;
+
 public:
   /////////////////////////////////////////////////
   /// @brief Constructor for UIRenderLogic
@@ -4,34 +4,25 @@
 /////////////////////////////////////////////////
 
 #include "UIStateLogic.h"
-#include "ArchetypeHelpers.h"
 #include "CUIState.h"
-#include "emp_helpers.h"
 
 namespace steamrot {
 /////////////////////////////////////////////////
 UIStateLogic::UIStateLogic(const LogicContext logic_context)
-    : Logic(logic_context) {}
+    : Logic(logic_context),
+      m_ui_state_view(m_logic_context.scene_entities,
+                      m_logic_context.archetype_manager) {
+
+  // subscribers are set inactive once their state has been applied
+  m_component_access.writes = GenerateArchetypeIDfromTypes<CUIState>();
+  m_component_access.writes_event_bus = true;
+}
 
 /////////////////////////////////////////////////
 void UIStateLogic::ProcessLogic() {
 
-  // Generate archetype ID for CUIState components
-  ArchetypeID archetype_id = GenerateArchetypeIDfromTypes<CUIState>();
-
-  const auto it = m_logic_context.archetypes.find(archetype_id);
-  
-  // If archetype doesn't exist, skip processing
-  if (it == m_logic_context.archetypes.end()) {
-    return;
-  }
-
-  const Archetype &archetype = it->second;
-
   // Process each entity with CUIState component
-  for (size_t entity_id : archetype) {
-    CUIState &ui_state = emp_helpers::GetComponent<CUIState>(
-        entity_id, m_logic_context.scene_entities);
+  for (auto [entity_id, ui_state] : m_ui_state_view) {
 
     // Check all subscribers for each state
     for (auto &[state_key, subscribers] : ui_state.m_state_subscribers) {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Logic.h"
+#include "View.h"
 
 namespace steamrot {
 
@@ -17,6 +18,11 @@ private:
   /////////////////////////////////////////////////
   void ProcessLogic() override;
 
+  /////////////////////////////////////////////////
+  /// @brief All entities with a CUIState component
+  /////////////////////////////////////////////////
+  View<CUIState> m_ui_state_view;
+
 public:
   /////////////////////////////////////////////////
   /// @brief Constructor for UIStateLogic.
@@ -57,5 +57,26 @@ void CheckMouseOverNestedUIElement(const sf::Vector2i &mouse_position,
     CheckMouseOverUIElement(mouse_position, element);
   }
 }
+
+/////////////////////////////////////////////////
+UIElement *UpdateMouseOverFromIndex(const sf::Vector2i &mouse_position,
+                                    const UISpatialIndex &index,
+                                    UIElement *hovered_element) {
+  UIElement *topmost_element =
+      index.FindTopmostElementAt(sf::Vector2f(mouse_position));
+
+  // the mouse is still over the same element
+  if (topmost_element == hovered_element) {
+    return hovered_element;
+  }
+
+  if (hovered_element) {
+    hovered_element->is_mouse_over = false;
+  }
+  if (topmost_element) {
+    topmost_element->is_mouse_over = true;
+  }
+  return topmost_element;
+}
 } // namespace collision
 } // namespace steamrot
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "UIElement.h"
+#include "UISpatialIndex.h"
 #include <SFML/Graphics/Rect.hpp>
 namespace steamrot {
 namespace collision {
@@ -45,5 +46,19 @@ void CheckMouseOverUIElement(const sf::Vector2i &mouse_position,
 void CheckMouseOverNestedUIElement(const sf::Vector2i &mouse_position,
                                    UIElement &element);
 
+/////////////////////////////////////////////////
+/// @brief Moves is_mouse_over to the topmost visible element under the mouse
+///
+/// Only the previously and newly hovered elements are written, so every other
+/// element in the index must already have is_mouse_over false.
+/// @param mouse_position The current global mouse position
+/// @param index Spatial index over the laid out UI trees
+/// @param hovered_element Element returned by the last call, null if none
+/// @return The element now hovered, null if none
+/////////////////////////////////////////////////
+UIElement *UpdateMouseOverFromIndex(const sf::Vector2i &mouse_position,
+                                    const UISpatialIndex &index,
+                                    UIElement *hovered_element);
+
 } // namespace collision
 } // namespace steamrot
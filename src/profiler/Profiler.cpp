@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the Profiler class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+namespace steamrot {
+
+std::mutex Profiler::m_buffers_mutex;
+std::vector<std::unique_ptr<ZoneRingBuffer>> Profiler::m_buffers;
+std::unordered_map<std::string_view, ZoneStats> Profiler::m_frame_stats;
+std::vector<TraceEvent> Profiler::m_trace_events;
+bool Profiler::m_capturing{false};
+size_t Profiler::m_lost_zone_count{0};
+std::vector<ProfileZone> Profiler::m_drained_zones;
+
+namespace {
+
+/////////////////////////////////////////////////
+/// @brief Time every zone is measured from
+/////////////////////////////////////////////////
+const std::chrono::steady_clock::time_point kProfilerEpoch =
+    std::chrono::steady_clock::now();
+
+/////////////////////////////////////////////////
+/// @brief Returns a readable zone name, demangling type names where possible
+/////////////////////////////////////////////////
+std::string ReadableZoneName(const char *name) {
+#ifdef __GNUG__
+  int status{0};
+  char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && demangled) {
+    std::string readable_name{demangled};
+    std::free(demangled);
+    return readable_name;
+  }
+#endif
+  return std::string{name};
+}
+
+/////////////////////////////////////////////////
+/// @brief Escapes a string for use inside a JSON string literal
+/////////////////////////////////////////////////
+std::string EscapeJsonString(const std::string &text) {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (const char character : text) {
+    if (character == '"' || character == '\\') {
+      escaped.push_back('\\');
+    }
+    escaped.push_back(character);
+  }
+  return escaped;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////
+uint64_t Profiler::Now() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - kProfilerEpoch)
+          .count());
+}
+
+/////////////////////////////////////////////////
+ZoneRingBuffer &Profiler::GetThreadBuffer() {
+  thread_local ZoneRingBuffer *thread_buffer{nullptr};
+
+  if (!thread_buffer) {
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+    m_buffers.push_back(std::make_unique<ZoneRingBuffer>(m_buffers.size()));
+    thread_buffer = m_buffers.back().get();
+  }
+  return *thread_buffer;
+}
+
+/////////////////////////////////////////////////
+void Profiler::EndFrame() {
+  m_frame_stats.clear();
+
+  std::lock_guard<std::mutex> lock(m_buffers_mutex);
+  for (const auto &buffer : m_buffers) {
+    m_drained_zones.clear();
+    m_lost_zone_count += buffer->Drain(m_drained_zones);
+
+    for (const ProfileZone &zone : m_drained_zones) {
+      ZoneStats &stats = m_frame_stats[zone.name];
+      stats.call_count++;
+      stats.total_ns += zone.duration_ns;
+      stats.max_ns = std::max(stats.max_ns, zone.duration_ns);
+
+      if (m_capturing) {
+        m_trace_events.push_back({zone, buffer->GetThreadID()});
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+const std::unordered_map<std::string_view, ZoneStats> &
+Profiler::GetFrameStats() {
+  return m_frame_stats;
+}
+
+/////////////////////////////////////////////////
+void Profiler::BeginCapture() { m_capturing = true; }
+
+/////////////////////////////////////////////////
+void Profiler::EndCapture() { m_capturing = false; }
+
+/////////////////////////////////////////////////
+const std::vector<TraceEvent> &Profiler::GetTraceEvents() {
+  return m_trace_events;
+}
+
+/////////////////////////////////////////////////
+size_t Profiler::GetLostZoneCount() { return m_lost_zone_count; }
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+Profiler::WriteChromeTrace(const std::filesystem::path &trace_path) {
+
+  std::ofstream trace_file(trace_path);
+  if (!trace_file.is_open()) {
+    FailInfo fail_info(FailMode::WriteFailure,
+                       "Could not open trace file: " + trace_path.string());
+    return std::unexpected(fail_info);
+  }
+
+  // the trace_event format wants microseconds, kept to nanosecond precision
+  trace_file << std::fixed << std::setprecision(3);
+  trace_file << "{\"traceEvents\":[";
+  bool first_event = true;
+  for (const TraceEvent &event : m_trace_events) {
+    if (!first_event) {
+      trace_file << ",";
+    }
+    first_event = false;
+
+    trace_file << "{\"name\":\""
+               << EscapeJsonString(ReadableZoneName(event.zone.name))
+               << "\",\"ph\":\"X\",\"ts\":"
+               << static_cast<double>(event.zone.start_ns) / 1000.0
+               << ",\"dur\":"
+               << static_cast<double>(event.zone.duration_ns) / 1000.0
+               << ",\"pid\":0,\"tid\":" << event.thread_id << "}";
+  }
+  trace_file << "]}\n";
+
+  if (!trace_file) {
+    FailInfo fail_info(FailMode::WriteFailure,
+                       "Failed to write trace file: " + trace_path.string());
+    return std::unexpected(fail_info);
+  }
+  return std::monostate{};
+}
+
+/////////////////////////////////////////////////
+void Profiler::Reset() {
+  std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+  // drop anything pending so the next frame starts clean
+  for (const auto &buffer : m_buffers) {
+    m_drained_zones.clear();
+    buffer->Drain(m_drained_zones);
+  }
+  m_drained_zones.clear();
+  m_frame_stats.clear();
+  m_trace_events.clear();
+  m_capturing = false;
+  m_lost_zone_count = 0;
+}
+
+} // namespace steamrot
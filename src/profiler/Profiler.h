@@ -0,0 +1,223 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the Profiler class and profiling macros
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "FailInfo.h"
+#include "ZoneRingBuffer.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+/////////////////////////////////////////////////
+/// Profiling macros
+///
+/// Zones are only compiled in when STEAMROT_PROFILING is defined (the
+/// STEAMROT_ENABLE_PROFILING CMake option), otherwise the macros expand to
+/// nothing and cost nothing.
+/////////////////////////////////////////////////
+#define STEAMROT_PROFILE_CONCAT_INNER(a, b) a##b
+#define STEAMROT_PROFILE_CONCAT(a, b) STEAMROT_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef STEAMROT_PROFILING
+#define STEAMROT_PROFILE_ZONE(name)                                            \
+  ::steamrot::ScopedZone STEAMROT_PROFILE_CONCAT(steamrot_profile_zone_,      \
+                                                 __LINE__) {                   \
+    name                                                                       \
+  }
+#define STEAMROT_PROFILE_END_FRAME() ::steamrot::Profiler::EndFrame()
+#else
+#define STEAMROT_PROFILE_ZONE(name) static_cast<void>(0)
+#define STEAMROT_PROFILE_END_FRAME() static_cast<void>(0)
+#endif
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class ZoneStats
+/// @brief Aggregate timings of one zone name over a frame.
+///
+/////////////////////////////////////////////////
+struct ZoneStats {
+  size_t call_count{0};
+  uint64_t total_ns{0};
+  uint64_t max_ns{0};
+};
+
+/////////////////////////////////////////////////
+/// @class TraceEvent
+/// @brief A collected zone kept for the Chrome trace.
+///
+/////////////////////////////////////////////////
+struct TraceEvent {
+  ProfileZone zone;
+  size_t thread_id{0};
+};
+
+/////////////////////////////////////////////////
+/// @class Profiler
+/// @brief Collects timed zones from every thread into per frame aggregates
+/// and, while capturing, a Chrome trace.
+///
+/// Each thread records into its own ZoneRingBuffer, registered the first time
+/// it opens a zone. EndFrame drains every buffer on the main thread once the
+/// frame's jobs are done. Like PathProvider the state is static, so zones can
+/// be opened anywhere without threading a Profiler through the game.
+/////////////////////////////////////////////////
+class Profiler {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Guards registration of thread buffers
+  /////////////////////////////////////////////////
+  static std::mutex m_buffers_mutex;
+
+  /////////////////////////////////////////////////
+  /// @brief Every thread's buffer, kept alive after the thread exits so its
+  /// last zones are still collected
+  /////////////////////////////////////////////////
+  static std::vector<std::unique_ptr<ZoneRingBuffer>> m_buffers;
+
+  /////////////////////////////////////////////////
+  /// @brief Aggregates for the last collected frame
+  /////////////////////////////////////////////////
+  static std::unordered_map<std::string_view, ZoneStats> m_frame_stats;
+
+  /////////////////////////////////////////////////
+  /// @brief Zones collected while capturing
+  /////////////////////////////////////////////////
+  static std::vector<TraceEvent> m_trace_events;
+
+  /////////////////////////////////////////////////
+  /// @brief Keep collected zones for the trace
+  /////////////////////////////////////////////////
+  static bool m_capturing;
+
+  /////////////////////////////////////////////////
+  /// @brief Zones lost to full ring buffers since the last Reset
+  /////////////////////////////////////////////////
+  static size_t m_lost_zone_count;
+
+  /////////////////////////////////////////////////
+  /// @brief Scratch space EndFrame drains into, reused between frames
+  /////////////////////////////////////////////////
+  static std::vector<ProfileZone> m_drained_zones;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Returns nanoseconds since the Profiler epoch
+  /////////////////////////////////////////////////
+  static uint64_t Now();
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the calling thread's ZoneRingBuffer, creating it on first
+  /// use
+  /////////////////////////////////////////////////
+  static ZoneRingBuffer &GetThreadBuffer();
+
+  /////////////////////////////////////////////////
+  /// @brief Collect every zone recorded since the last call
+  ///
+  /// Replaces the frame aggregates and, while capturing, appends to the trace.
+  /// Call from the main thread while no jobs are running.
+  /////////////////////////////////////////////////
+  static void EndFrame();
+
+  /////////////////////////////////////////////////
+  /// @brief Returns aggregates per zone name for the last collected frame
+  /////////////////////////////////////////////////
+  static const std::unordered_map<std::string_view, ZoneStats> &
+  GetFrameStats();
+
+  /////////////////////////////////////////////////
+  /// @brief Start keeping collected zones for the Chrome trace
+  /////////////////////////////////////////////////
+  static void BeginCapture();
+
+  /////////////////////////////////////////////////
+  /// @brief Stop keeping collected zones, the trace is kept until Reset
+  /////////////////////////////////////////////////
+  static void EndCapture();
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the zones kept for the trace
+  /////////////////////////////////////////////////
+  static const std::vector<TraceEvent> &GetTraceEvents();
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the number of zones lost to full ring buffers
+  /////////////////////////////////////////////////
+  static size_t GetLostZoneCount();
+
+  /////////////////////////////////////////////////
+  /// @brief Write the captured zones as a Chrome trace_event JSON file
+  ///
+  /// The file opens in chrome://tracing or Perfetto.
+  ///
+  /// @param trace_path Path of the file to write
+  /////////////////////////////////////////////////
+  static std::expected<std::monostate, FailInfo>
+  WriteChromeTrace(const std::filesystem::path &trace_path);
+
+  /////////////////////////////////////////////////
+  /// @brief Discard all collected and pending zones and stop capturing
+  /////////////////////////////////////////////////
+  static void Reset();
+};
+
+/////////////////////////////////////////////////
+/// @class ScopedZone
+/// @brief Times its own lifetime and records it as a zone on the calling
+/// thread.
+///
+/// Prefer STEAMROT_PROFILE_ZONE, which compiles away when profiling is off.
+/////////////////////////////////////////////////
+class ScopedZone {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Name of the zone
+  /////////////////////////////////////////////////
+  const char *m_name;
+
+  /////////////////////////////////////////////////
+  /// @brief Time the zone was opened
+  /////////////////////////////////////////////////
+  uint64_t m_start_ns;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Open a zone
+  ///
+  /// @param name Name of the zone, must outlive the Profiler
+  /////////////////////////////////////////////////
+  explicit ScopedZone(const char *name)
+      : m_name(name), m_start_ns(Profiler::Now()) {}
+
+  /////////////////////////////////////////////////
+  /// @brief Close the zone and record it
+  /////////////////////////////////////////////////
+  ~ScopedZone() {
+    Profiler::GetThreadBuffer().Push(
+        ProfileZone{m_name, m_start_ns, Profiler::Now() - m_start_ns});
+  }
+
+  ScopedZone(const ScopedZone &) = delete;
+  ScopedZone &operator=(const ScopedZone &) = delete;
+};
+
+} // namespace steamrot
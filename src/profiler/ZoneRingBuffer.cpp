@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the ZoneRingBuffer class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ZoneRingBuffer.h"
+#include <algorithm>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+ZoneRingBuffer::ZoneRingBuffer(size_t thread_id, size_t capacity)
+    : m_zones(std::max<size_t>(capacity, 1)), m_thread_id(thread_id) {}
+
+/////////////////////////////////////////////////
+void ZoneRingBuffer::Push(const ProfileZone &zone) {
+  const size_t write_count = m_write_count.load(std::memory_order_relaxed);
+  m_zones[write_count % m_zones.size()] = zone;
+
+  // publish the zone to Drain
+  m_write_count.store(write_count + 1, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////
+size_t ZoneRingBuffer::Drain(std::vector<ProfileZone> &zones) {
+  const size_t write_count = m_write_count.load(std::memory_order_acquire);
+
+  // skip anything that has already been overwritten
+  size_t lost_count{0};
+  if (write_count - m_read_count > m_zones.size()) {
+    lost_count = write_count - m_read_count - m_zones.size();
+    m_read_count += lost_count;
+  }
+
+  for (; m_read_count < write_count; ++m_read_count) {
+    zones.push_back(m_zones[m_read_count % m_zones.size()]);
+  }
+
+  return lost_count;
+}
+
+/////////////////////////////////////////////////
+size_t ZoneRingBuffer::GetThreadID() const { return m_thread_id; }
+
+} // namespace steamrot
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the ZoneRingBuffer class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Default number of zones each thread can hold between collections
+/////////////////////////////////////////////////
+constexpr size_t kZoneRingBufferCapacity = 16384;
+
+/////////////////////////////////////////////////
+/// @class ProfileZone
+/// @brief One timed run of a named zone.
+///
+/////////////////////////////////////////////////
+struct ProfileZone {
+  /////////////////////////////////////////////////
+  /// @brief Name of the zone, must outlive the Profiler (a string literal or
+  /// a type name)
+  /////////////////////////////////////////////////
+  const char *name{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Start of the zone in nanoseconds since the Profiler epoch
+  /////////////////////////////////////////////////
+  uint64_t start_ns{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Length of the zone in nanoseconds
+  /////////////////////////////////////////////////
+  uint64_t duration_ns{0};
+};
+
+/////////////////////////////////////////////////
+/// @class ZoneRingBuffer
+/// @brief Fixed size ring of ProfileZones written by a single thread.
+///
+/// Push never allocates or locks. Zones are collected with Drain from another
+/// thread at a point where the owner is not pushing (the end of a frame), if
+/// the owner has lapped the reader since the last Drain the oldest zones are
+/// lost rather than blocking the owner.
+/////////////////////////////////////////////////
+class ZoneRingBuffer {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Zone storage, sized once on construction
+  /////////////////////////////////////////////////
+  std::vector<ProfileZone> m_zones;
+
+  /////////////////////////////////////////////////
+  /// @brief Total number of zones ever pushed
+  /////////////////////////////////////////////////
+  std::atomic<size_t> m_write_count{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Total number of zones drained or skipped
+  /////////////////////////////////////////////////
+  size_t m_read_count{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Small sequential id of the owning thread
+  /////////////////////////////////////////////////
+  const size_t m_thread_id;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Constructor for the ZoneRingBuffer class
+  ///
+  /// @param thread_id Id of the owning thread, used in trace output
+  /// @param capacity Number of zones held before the oldest are overwritten
+  /////////////////////////////////////////////////
+  explicit ZoneRingBuffer(size_t thread_id,
+                          size_t capacity = kZoneRingBufferCapacity);
+
+  /////////////////////////////////////////////////
+  /// @brief Record a zone (owner side)
+  ///
+  /// @param zone Zone to record
+  /////////////////////////////////////////////////
+  void Push(const ProfileZone &zone);
+
+  /////////////////////////////////////////////////
+  /// @brief Append every zone pushed since the last Drain to zones
+  ///
+  /// @param zones Vector to append to
+  /// @return Number of zones lost because the owner lapped the reader
+  /////////////////////////////////////////////////
+  size_t Drain(std::vector<ProfileZone> &zones);
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the id of the owning thread
+  /////////////////////////////////////////////////
+  size_t GetThreadID() const;
+};
+
+} // namespace steamrot
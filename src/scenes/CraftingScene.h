@@ -33,26 +33,5 @@ private:
   /// @param game_context GameContext containing game-wide data for the scene
   /////////////////////////////////////////////////
   CraftingScene(const uuids::uuid &id, const GameContext &game_context);
-
-public:
-  /////////////////////////////////////////////////
-  /// @brief Systems for dealing with events and actions in the CraftingScene
-  /////////////////////////////////////////////////
-  void sAction() override;
-
-  /////////////////////////////////////////////////
-  /// @brief Systems for dealing with movement in the CraftingScene
-  /////////////////////////////////////////////////
-  void sMovement() override;
-
-  /////////////////////////////////////////////////
-  /// @brief Systems for dealing with collision in the CraftingScene
-  /////////////////////////////////////////////////
-  void sCollision() override;
-
-  /////////////////////////////////////////////////
-  /// @brief Systems for dealing with rendering in the CraftingScene
-  /////////////////////////////////////////////////
-  void sRender() override;
 };
 } // namespace steamrot
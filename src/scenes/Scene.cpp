@@ -10,6 +10,7 @@
 #include "EntityManager.h"
 #include "LogicFactory.h"
 #include "scene_change_packet_generated.h"
+#include <stdexcept>
 
 namespace steamrot {
 
@@ -18,7 +19,14 @@ Scene::Scene(const SceneType scene_type, const uuids::uuid &id,
              const GameContext &game_context)
     : m_scene_info{id, scene_type},
       m_entity_manager(game_context.event_handler),
-      m_game_context(game_context) {}
+      m_game_context(game_context) {
+
+  // only windowed scenes have anything to render to
+  if (game_context.display_mode == DisplayMode::Windowed &&
+      !m_render_texture.resize(kWindowSize)) {
+    throw std::runtime_error("Failed to create Scene RenderTexture");
+  }
+}
 
 ////////////////////////////////////////////////////////////
 bool Scene::GetActive() const { return m_active; }
@@ -50,17 +58,29 @@ Scene::ConfigureFromDefault(const DataType &data_type) {
 }
 
 /////////////////////////////////////////////////
-const LogicCollection &Scene::GetLogicMap() const { return m_logic_map; }
+void Scene::sUpdate() {
+  m_logic_schedules.update_schedule.Run(m_game_context.job_system);
+}
 
 /////////////////////////////////////////////////
-void Scene::SetLogicMap(
-    std::unordered_map<LogicType, std::vector<std::unique_ptr<Logic>>>
-        logic_map) {
-  // only set the logic map if it is empty
-  if (m_logic_map.empty()) {
-    m_logic_map = std::move(logic_map);
+void Scene::sRender() {
+  m_logic_schedules.render_schedule.Run(m_game_context.job_system);
+}
+
+/////////////////////////////////////////////////
+const SceneLogicSchedules &Scene::GetLogicSchedules() const {
+  return m_logic_schedules;
+}
+
+/////////////////////////////////////////////////
+void Scene::SetLogicSchedules(SceneLogicSchedules logic_schedules) {
+  // only set the logic schedules if they are empty
+  if (m_logic_schedules.update_schedule.IsEmpty() &&
+      m_logic_schedules.render_schedule.IsEmpty()) {
+    m_logic_schedules = std::move(logic_schedules);
   }
 }
+
 /////////////////////////////////////////////////
 const SceneInfo &Scene::GetSceneInfo() const { return m_scene_info; }
 
@@ -69,12 +89,14 @@ LogicContext Scene::GetLogicContext() {
 
   LogicContext logic_context{
       m_entity_manager.GetEntityMemoryPool(),
-      m_entity_manager.GetArchetypeManager().GetArchetypes(),
+      m_entity_manager.GetArchetypeManager(),
       m_render_texture,
       m_game_context.game_window,
       m_game_context.asset_manager,
       m_game_context.event_handler,
-      m_game_context.mouse_position};
+      m_game_context.job_system,
+      m_game_context.mouse_position,
+      m_game_context.input_state};
 
   return logic_context;
 }
@@ -16,6 +16,7 @@
 #include "GameContext.h"
 #include "Logic.h"
 #include "LogicFactory.h"
+#include "LogicSchedule.h"
 #include "global_constants.h"
 #include "scene_change_packet_generated.h"
 #include <SFML/Graphics.hpp>
@@ -66,15 +67,17 @@ protected:
   const GameContext &m_game_context;
 
   /////////////////////////////////////////////////
-  /// @brief Map of all logic objects needed by the Scene.
+  /// @brief All Logic needed by the Scene, split into update and render
+  /// schedules.
   /////////////////////////////////////////////////
-  std::unordered_map<LogicType, std::vector<std::unique_ptr<Logic>>>
-      m_logic_map;
+  SceneLogicSchedules m_logic_schedules;
 
   /////////////////////////////////////////////////
   /// @brief RenderTexture for the Scene instance.
+  ///
+  /// Left empty in Headless mode, so no OpenGL context is created.
   /////////////////////////////////////////////////
-  sf::RenderTexture m_render_texture{kWindowSize};
+  sf::RenderTexture m_render_texture;
 
   /////////////////////////////////////////////////
   /// @brief Is the Scene active? Should update logic and render texture
@@ -109,26 +112,20 @@ public:
   std::expected<std::monostate, FailInfo>
   ConfigureFromDefault(const DataType &data_type = DataType::Flatbuffers);
 
-  ////////////////////////////////////////////////////////////
-  /// \brief function container for all movement related logic
-  ///
-  ////////////////////////////////////////////////////////////
-  virtual void sMovement() = 0;
-
-  /////////////////////////////////////////////////
-  /// @brief Function container for all collision related logic.
-  /////////////////////////////////////////////////
-  virtual void sCollision() = 0;
-
   /////////////////////////////////////////////////
-  /// @brief Virtual container function for running all action related logic.
+  /// @brief Run the Scene's simulation Logic for one tick.
+  ///
+  /// Runs the update LogicSchedule, override to do any per tick work around it.
   /////////////////////////////////////////////////
-  virtual void sAction() = 0;
+  virtual void sUpdate();
 
   /////////////////////////////////////////////////
-  /// @brief Virtual container function for running all rendering related logic.
+  /// @brief Run the Scene's Render Logic for one frame.
+  ///
+  /// Runs the render LogicSchedule, override to do any per frame work around
+  /// it.
   /////////////////////////////////////////////////
-  virtual void sRender() = 0;
+  virtual void sRender();
 
   /////////////////////////////////////////////////
   /// @brief Returns a reference to the RenderTexture of the Scene.
@@ -136,21 +133,18 @@ public:
   sf::RenderTexture &GetRenderTexture();
 
   /////////////////////////////////////////////////
-  /// @brief Returns a const reference to the LogicMap of the Scene.
-  ///
-  /// @return The LogicMap of the Scene.
+  /// @brief Returns a const reference to the LogicSchedules of the Scene.
   /////////////////////////////////////////////////
-  const LogicCollection &GetLogicMap() const;
+  const SceneLogicSchedules &GetLogicSchedules() const;
 
   /////////////////////////////////////////////////
-  /// @brief Sets LogicMap for the scene (only if the map is empty)
+  /// @brief Sets LogicSchedules for the scene (only if both are empty)
   ///
-  /// @param logic_map Logic map to set for the scene, passed by value and
-  /// moved.
+  /// @param logic_schedules LogicSchedules to set for the scene, passed by
+  /// value and moved.
   /////////////////////////////////////////////////
-  void
-  SetLogicMap(std::unordered_map<LogicType, std::vector<std::unique_ptr<Logic>>>
-                  logic_map);
+  void SetLogicSchedules(SceneLogicSchedules logic_schedules);
+
   /////////////////////////////////////////////////
   /// @brief Returns the active state of the Scene.
   ///
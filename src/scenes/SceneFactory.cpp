@@ -78,14 +78,15 @@ SceneFactory::CreateDefaultScene(const SceneType &scene_type,
     return std::unexpected(archetype_result.error());
   }
 
-  // configure LogicMap
-  LogicFactory logic_factory(scene_type, scene_ptr->GetLogicContext());
-  auto create_map_result = logic_factory.CreateLogicMap();
-  if (!create_map_result) {
-    return std::unexpected(create_map_result.error());
+  // configure LogicSchedules
+  LogicFactory logic_factory(scene_type, scene_ptr->GetLogicContext(),
+                             game_context.display_mode);
+  auto create_schedules_result = logic_factory.CreateLogicSchedules();
+  if (!create_schedules_result) {
+    return std::unexpected(create_schedules_result.error());
   }
-  // pass the created logic map to the scene
-  scene_ptr->SetLogicMap(std::move(create_map_result.value()));
+  // pass the created logic schedules to the scene
+  scene_ptr->SetLogicSchedules(std::move(create_schedules_result.value()));
   return scene_ptr;
 }
 
@@ -9,6 +9,7 @@
 #include "SceneManager.h"
 #include "EventPacket.h"
 #include "FailInfo.h"
+#include "Profiler.h"
 #include "Scene.h"
 #include "SceneFactory.h"
 #include "Subscriber.h"
@@ -170,20 +171,27 @@ SceneManager::ProvideAvailableSceneInfo() const {
 
 /////////////////////////////////////////////////
 void SceneManager::UpdateScenes() {
+  STEAMROT_PROFILE_ZONE("SceneManager::UpdateScenes");
+
   // Loop through all the scenes and update them
   // updating does not mean rendering, it means updating the state of the
   // scene
   for (auto &pair : m_scenes) {
     auto &scene = pair.second;
 
-    scene->sAction();
-    // scene->sMovement();
-    scene->sCollision();
-    scene->sRender();
+    scene->sUpdate();
 
     // add further systems here
   }
 }
+
+/////////////////////////////////////////////////
+void SceneManager::RenderScenes() {
+  for (auto &pair : m_scenes) {
+    pair.second->sRender();
+  }
+}
+
 /////////////////////////////////////////////////
 const std::unordered_map<EventType, std::shared_ptr<Subscriber>> &
 SceneManager::GetSubscriptions() const {
@@ -200,7 +208,7 @@ SceneManager::RegisterSubscriber(std::shared_ptr<Subscriber> subscriber) {
   }
 
   // attempt to add the subscriber to the map, fail if duplicate
-  auto result = m_subscriptions.emplace(subscriber->GetEventType(), subscriber);
+  auto result = m_subscriptions.emplace(subscriber->GetEventMask(), subscriber);
   if (!result.second) {
     FailInfo fail_info(
         FailMode::NotAddedToMap,
@@ -254,7 +262,7 @@ SceneManager::LoadStandAloneScene(const SceneType &scene_type) {
 /////////////////////////////////////////////////
 std::expected<std::monostate, FailInfo> SceneManager::ProcessSubscriptions() {
 
-  for (const auto &[event_type, subscriber] : m_subscriptions) {
+  for (const auto &[event_mask, subscriber] : m_subscriptions) {
 
     // only process active subscribers
     if (subscriber->IsActive()) {
@@ -262,7 +270,7 @@ std::expected<std::monostate, FailInfo> SceneManager::ProcessSubscriptions() {
       // get the event data
       const EventData &event_data = subscriber->GetEventData();
 
-      switch (event_type) {
+      switch (subscriber->GetTriggeredEventType()) {
       case EventType::EventType_EVENT_CHANGE_SCENE: {
 
         // make sure the data type is correct
@@ -47,7 +47,7 @@ private:
   std::unordered_map<uuids::uuid, std::unique_ptr<Scene>> m_scenes;
 
   /////////////////////////////////////////////////
-  /// @brief Map of all event subscriptions, stored by event type.
+  /// @brief Map of all event subscriptions, stored by event mask.
   /////////////////////////////////////////////////
   std::unordered_map<EventType, std::shared_ptr<Subscriber>> m_subscriptions;
 
@@ -109,6 +109,14 @@ public:
   /////////////////////////////////////////////////
   void UpdateScenes();
 
+  /////////////////////////////////////////////////
+  /// @brief Renders all scenes to their RenderTextures by calling their
+  /// render systems.
+  ///
+  /// Called once per rendered frame, which may cover several or no updates.
+  /////////////////////////////////////////////////
+  void RenderScenes();
+
   /////////////////////////////////////////////////
   /// @brief Container function for all other functions required for each update
   /// cycle
@@ -36,23 +36,8 @@ private:
   TitleScene(const uuids::uuid &id, const GameContext &game_context);
 
   /////////////////////////////////////////////////
-  /// @brief Call rendering Logic for TitleScene
+  /// @brief Clear the RenderTexture and run the TitleScene Render Logic
   /////////////////////////////////////////////////
   void sRender() override;
-
-  /////////////////////////////////////////////////
-  /// @brief Call movement Logic for TitleScene
-  /////////////////////////////////////////////////
-  void sMovement() override;
-
-  /////////////////////////////////////////////////
-  /// @brief Call collision Logic for TitleScene
-  /////////////////////////////////////////////////
-  void sCollision() override;
-
-  /////////////////////////////////////////////////
-  /// @brief Call action Logic for TitleScene
-  /////////////////////////////////////////////////
-  void sAction() override;
 };
 } // namespace steamrot
@@ -7,28 +7,33 @@
 // Headers
 ////////////////////////////////////////////////////////////
 
+#include "input_translation.h"
 #include "user_input_generated.h"
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
-#include <unordered_map>
+#include <cstdint>
+#include <optional>
 
 namespace steamrot {
 
 class ActionManager {
-private:
+public:
   ////////////////////////////////////////////////////////////
-  // |brief: returns map of string letters to sf::Keyboard enum
+  // |brief: returns the sf::Keyboard enum for a flatbuffers KeyboardInput
   ////////////////////////////////////////////////////////////
-  static const std::unordered_map<KeyboardInput, sf::Keyboard::Key> &
-  getFlatbuffersToSFMLKeyboardMap();
+  static constexpr sf::Keyboard::Key
+  getSFMLKey(KeyboardInput keyboard_input) {
+    return ToSFMLKey(static_cast<uint8_t>(keyboard_input));
+  }
 
   ////////////////////////////////////////////////////////////
-  // |brief: returns map of string letters to sf::Mouse enum
+  // |brief: returns the sf::Mouse enum for a flatbuffers MouseInput, if any
   ////////////////////////////////////////////////////////////
-  static const std::unordered_map<MouseInput, sf::Mouse::Button> &
-  getStringToMouseMap();
+  static constexpr std::optional<sf::Mouse::Button>
+  getSFMLButton(MouseInput mouse_input) {
+    return ToSFMLButton(static_cast<uint8_t>(mouse_input));
+  }
 
-public:
   /**
    * @brief Constructor using flatbuffers ActionsData object
    *
@@ -6,13 +6,20 @@
 #include "FailInfo.h"
 #include "FlatbuffersDataLoader.h"
 #include "GameContext.h"
+#include "Profiler.h"
 #include "SubscriberFactory.h"
+#include "event_recording.h"
 #include "events_generated.h"
+#include "log_handler.h"
 #include <SFML/Graphics.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <expected>
 #include <iostream>
+#include <thread>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -20,12 +27,18 @@ namespace steamrot {
 
 ///////////////////////////////////////////////////////////
 
-GameEngine::GameEngine(EnvironmentType env_type)
-    : m_window({sf::VideoMode({800, 600}), "SteamRot"}),
+GameEngine::GameEngine(EnvironmentType env_type, DisplayMode display_mode)
+    : m_display_mode(display_mode),
       m_game_context(m_window, m_event_handler, m_loop_number, m_asset_manager,
-                     env_type),
+                     m_job_system, env_type, display_mode),
       m_scene_manager(m_game_context),
-      m_display_manager(m_window, m_scene_manager) {}
+      m_display_manager(m_window, m_scene_manager) {
+
+  // a headless game never opens a window
+  if (m_display_mode == DisplayMode::Windowed) {
+    m_window.create(sf::VideoMode({800, 600}), "SteamRot");
+  }
+}
 
 /////////////////////////////////////////////////
 std::expected<std::monostate, FailInfo> GameEngine::ConfigureGameEngineFromData(
@@ -35,6 +48,19 @@ std::expected<std::monostate, FailInfo> GameEngine::ConfigureGameEngineFromData(
                        "GameEngineData is a null pointer");
     return std::unexpected(fail_info);
   }
+
+  // configure the loop timing
+  if (game_engine_data->tick_rate() == 0) {
+    FailInfo fail_info(FailMode::ParameterOutOfBounds,
+                       "GameEngineData tick_rate must be greater than 0");
+    return std::unexpected(fail_info);
+  }
+  m_tick_duration = std::chrono::nanoseconds{std::chrono::seconds(1)} /
+                    game_engine_data->tick_rate();
+  m_frame_rate_limit = game_engine_data->frame_rate_limit();
+  m_max_ticks_per_frame =
+      std::max<size_t>(game_engine_data->max_ticks_per_frame(), 1);
+
   // configure Subscribers from data
   auto configure_result =
       ConfigureSubscribersFromData(game_engine_data->subscriptions());
@@ -58,8 +84,6 @@ void GameEngine::RunGame(size_t number_of_loops, bool simulation) {
 
 /////////////////////////////////////////////////
 void GameEngine::StartUp() {
-  // limit window framerate
-  m_window.setFramerateLimit(60);
 
   // configure the GameEngine from data
   FlatbuffersDataLoader data_loader;
@@ -68,23 +92,28 @@ void GameEngine::StartUp() {
     if (!load_data_result) {
       std::cerr << "Failed to load game engine data: "
                 << load_data_result.error().message << "\n";
-      m_window.close();
+      StopGame();
     }
   auto configure_result = ConfigureGameEngineFromData(load_data_result.value());
   if (!configure_result)
     if (!configure_result) {
       std::cerr << "Failed to configure game engine: "
                 << configure_result.error().message << "\n";
-      m_window.close();
+      StopGame();
     }
 
+  // limit window framerate, simulation ticks are not tied to it
+  if (m_display_mode == DisplayMode::Windowed) {
+    m_window.setFramerateLimit(m_frame_rate_limit);
+  }
+
   // load default assets
   auto load_assets_result = m_asset_manager.LoadDefaultAssets();
   if (!load_assets_result)
     if (!load_assets_result) {
       std::cerr << "Failed to load default assets: "
                 << load_assets_result.error().message << "\n";
-      m_window.close();
+      StopGame();
     }
 
   // Configure the SceneManager from data
@@ -94,7 +123,7 @@ void GameEngine::StartUp() {
     if (!configure_sm_result) {
       std::cerr << "Failed to configure scene manager: "
                 << configure_sm_result.error().message << "\n";
-      m_window.close();
+      StopGame();
     }
   // load the title scene
   auto load_scene_result = m_scene_manager.LoadTitleScene();
@@ -102,65 +131,226 @@ void GameEngine::StartUp() {
     if (!load_scene_result) {
       std::cerr << "Failed to load title scene: "
                 << load_scene_result.error().message << "\n";
-      m_window.close();
+      StopGame();
     }
 }
 
+/////////////////////////////////////////////////
 void GameEngine::RunGameLoop(size_t number_of_loops, bool simulation) {
 
-  // Run the program as long as the window is open
-  while (m_window.isOpen()) {
+  using Clock = std::chrono::steady_clock;
+
+  // nothing waits on real time in simulation mode
+  if (simulation && m_display_mode == DisplayMode::Windowed) {
+    m_window.setFramerateLimit(0);
+  }
+
+  Clock::time_point previous_time = Clock::now();
+  std::chrono::nanoseconds accumulated_time{0};
+  bool simulation_finished = false;
+
+  // Run the program until the game is stopped
+  while (m_running && !simulation_finished) {
+
+    // collect the previous frame's zones before opening this frame's
+    STEAMROT_PROFILE_END_FRAME();
+    STEAMROT_PROFILE_ZONE("GameEngine::Frame");
+
+    // bank the real time since the last frame
+    const Clock::time_point current_time = Clock::now();
+    accumulated_time += current_time - previous_time;
+    previous_time = current_time;
+
+    if (simulation) {
+      accumulated_time = m_tick_duration;
+    }
+
+    ProcessInput();
+
+    // spend the banked time in fixed ticks
+    size_t ticks_this_frame = 0;
+    while (accumulated_time >= m_tick_duration && m_running) {
+
+      // Handle all system updates
+      UpdateSystems();
+      accumulated_time -= m_tick_duration;
+
+      // statement to handle simulation mode
+      if (simulation && (number_of_loops == m_loop_number)) {
+        simulation_finished = true;
+        break;
+      }
+
+      // Increment the loop counter
+      m_loop_number++;
+
+      // a replayed session ends where the recording did
+      if (m_event_replay && m_event_replay->IsFinished(m_loop_number)) {
+        StopGame();
+        break;
+      }
+
+      // drop the whole ticks we cannot catch up on
+      if (++ticks_this_frame == m_max_ticks_per_frame) {
+        accumulated_time %= m_tick_duration;
+        break;
+      }
+    }
 
-    // Handle all system updates
-    UpdateSystems();
+    // hand the errors logged this frame to the logger's thread
+    log_handler::FlushErrorLog();
 
-    // statement to handle simulation mode
-    if (simulation && (number_of_loops == m_loop_number))
+    if (simulation_finished || !m_running) {
       break;
+    }
 
-    // Increment the loop counter
-    m_loop_number++;
+    // without a frame limiter to pace the loop, sleep until the next tick
+    if (m_display_mode == DisplayMode::Headless) {
+      if (!simulation) {
+        std::this_thread::sleep_for(m_tick_duration - accumulated_time);
+      }
+      continue;
+    }
+
+    RenderFrame();
   }
+
+  // collect the zones of the final frame
+  STEAMROT_PROFILE_END_FRAME();
 }
 
 ////////////////////////////////////////////////////////////
-void GameEngine::UpdateSystems() {
+void GameEngine::ProcessInput() {
+  // there is no window to take input from
+  if (m_display_mode == DisplayMode::Headless) {
+    return;
+  }
+
+  // a window closed from elsewhere still ends the game
+  if (!m_window.isOpen()) {
+    StopGame();
+    return;
+  }
+
   // Update GameContext
   UpdateGameContext(m_game_context);
 
-  // Preload Events, namely any external events that need adding to the waiting
-  // room
-  m_event_handler.PreloadEvents(m_window);
-  // Process Waiting Room Event Bus into Global Event Bus
-  m_event_handler.ProcessWaitingRoomEventBus();
-  // Update Subscribers from Global Event Bus
-  m_event_handler.UpateSubscribersFromGlobalEventBus();
+  // take in the window's input, it is published on the next tick's snapshot
+  STEAMROT_PROFILE_ZONE("HandleSFMLEvents");
+  if (HandleSFMLEvents(m_window, m_game_context.input_state)) {
+    StopGame();
+  }
+}
+
+////////////////////////////////////////////////////////////
+void GameEngine::UpdateSystems() {
+  STEAMROT_PROFILE_ZONE("GameEngine::UpdateSystems");
+
+  // recorded input stands in for the window's
+  if (m_event_replay) {
+    m_event_handler.PreloadEvents(*m_event_replay, m_loop_number,
+                                  m_game_context.input_state,
+                                  m_game_context.mouse_position);
+  }
+
+  {
+    STEAMROT_PROFILE_ZONE("EventHandler::PreloadEvents");
+    // every Logic this tick sees the same input, changes are also published
+    m_game_context.input_state.Snapshot();
+    m_event_handler.PreloadEvents(m_game_context.input_state,
+                                  m_game_context.mouse_position);
+  }
+
+  {
+    STEAMROT_PROFILE_ZONE("EventHandler::ProcessWaitingRoomEventBus");
+    // Process Waiting Room Event Bus into Global Event Bus
+    m_event_handler.ProcessWaitingRoomEventBus();
+  }
+
+  {
+    STEAMROT_PROFILE_ZONE("EventHandler::UpateSubscribersFromGlobalEventBus");
+    // Update Subscribers from Global Event Bus
+    m_event_handler.UpateSubscribersFromGlobalEventBus();
+  }
 
   // Handle subscriptions for the GameEngine
   auto process_subscriptions_result = ProcessSubscriptions();
   if (!process_subscriptions_result.has_value()) {
     std::cerr << "Failed to process subscriptions: "
               << process_subscriptions_result.error().message << "\n";
-    m_window.close();
+    StopGame();
   }
-  // Update EventHandler
 
   // Update Scenes
   m_scene_manager.UpdateSceneManager();
 
-  // Call Render Cycle
-  auto call_render_cycle_result = m_display_manager.CallRenderCycle();
-
   // Tick the Global Event Bus
   m_event_handler.TickGlobalEventBus();
 }
 
+/////////////////////////////////////////////////
+void GameEngine::RenderFrame() {
+  STEAMROT_PROFILE_ZONE("GameEngine::RenderFrame");
+
+  {
+    STEAMROT_PROFILE_ZONE("SceneManager::RenderScenes");
+    // Render each Scene's texture
+    m_scene_manager.RenderScenes();
+  }
+
+  // Call Render Cycle
+  STEAMROT_PROFILE_ZONE("DisplayManager::CallRenderCycle");
+  auto call_render_cycle_result = m_display_manager.CallRenderCycle();
+}
+
 ////////////////////////////////////////////////////////////
 size_t GameEngine::GetLoopNumber() const { return m_loop_number; }
 
+/////////////////////////////////////////////////
+std::chrono::nanoseconds GameEngine::GetTickDuration() const {
+  return m_tick_duration;
+}
+
 ////////////////////////////////////////////////////////////
 void GameEngine::ShutDown() {}
 
+/////////////////////////////////////////////////
+void GameEngine::StopGame() {
+  m_running = false;
+  m_window.close();
+}
+
+/////////////////////////////////////////////////
+bool GameEngine::IsRunning() const { return m_running; }
+
+/////////////////////////////////////////////////
+void GameEngine::StartEventRecording() {
+  m_event_recorder.emplace(m_loop_number);
+  m_event_handler.SetEventRecorder(&m_event_recorder.value());
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+GameEngine::SaveEventRecording(const std::filesystem::path &recording_path) {
+  if (!m_event_recorder) {
+    FailInfo fail_info(FailMode::NullPointer,
+                       "Event recording was never started");
+    return std::unexpected(fail_info);
+  }
+  return m_event_recorder->WriteToFile(recording_path);
+}
+
+/////////////////////////////////////////////////
+std::expected<std::monostate, FailInfo>
+GameEngine::LoadEventReplay(const std::filesystem::path &recording_path) {
+  auto read_result = ReadEventRecording(recording_path);
+  if (!read_result.has_value()) {
+    return std::unexpected(read_result.error());
+  }
+  m_event_replay.emplace(std::move(read_result.value()));
+  return std::monostate{};
+}
+
 /////////////////////////////////////////////////
 std::expected<std::monostate, FailInfo>
 GameEngine::RegisterSubscriber(std::shared_ptr<Subscriber> subscriber) {
@@ -225,11 +415,11 @@ std::expected<std::monostate, FailInfo> GameEngine::ProcessSubscriptions() {
       // get the event data
       const EventData &event_data = subscriber->GetEventData();
 
-      // switch on the EventType
-      switch (subscriber->GetEventType()) {
+      // switch on the EventType that activated the subscriber
+      switch (subscriber->GetTriggeredEventType()) {
       case EventType::EventType_EVENT_QUIT_GAME: {
         // close the window to quit the game
-        m_window.close();
+        StopGame();
         break;
       }
       default:
@@ -246,6 +436,9 @@ std::expected<std::monostate, FailInfo> GameEngine::ProcessSubscriptions() {
 /////////////////////////////////////////////////
 const sf::RenderWindow &GameEngine::GetWindow() const { return m_window; }
 
+/////////////////////////////////////////////////
+sf::RenderWindow &GameEngine::GetWindow() { return m_window; }
+
 /////////////////////////////////////////////////
 void GameEngine::UpdateGameContext(GameContext &game_context) {
   // update mouse position
@@ -9,12 +9,18 @@
 #include "AssetManager.h"
 #include "DisplayManager.h"
 #include "EventHandler.h"
+#include "EventRecorder.h"
+#include "EventReplay.h"
+#include "JobSystem.h"
 #include "SceneManager.h"
 #include "Subscriber.h"
 #include "game_engine_generated.h"
 #include <SFML/Graphics.hpp>
+#include <chrono>
 #include <expected>
+#include <filesystem>
 #include <memory>
+#include <optional>
 #include <variant>
 #include <vector>
 
@@ -34,14 +40,45 @@ private:
   /////////////////////////////////////////////////
   /// @brief Variable to keep track of the current loop number.
   ///
-  /// Increments by 1 at the start of each loop, the game will be maxed out at
-  /// 60FPS so on a 32 bit system this will last 2.27 years. and on a 64 bit
+  /// Increments by 1 at the end of each simulation tick, at 60 ticks per
+  /// second on a 32 bit system this will last 2.27 years. and on a 64 bit
   /// system this will last 9.75 trillion years. Probably long enough.
   /////////////////////////////////////////////////
   size_t m_loop_number = 1;
 
   /////////////////////////////////////////////////
-  /// @brief Member: RenderWindow for the game engine
+  /// @brief Length of one simulation tick, set from the tick rate in
+  /// GameEngineData.
+  /////////////////////////////////////////////////
+  std::chrono::nanoseconds m_tick_duration{
+      std::chrono::nanoseconds{std::chrono::seconds(1)} / 60};
+
+  /////////////////////////////////////////////////
+  /// @brief Frame rate limit for the window, 0 leaves rendering unlimited.
+  /////////////////////////////////////////////////
+  unsigned int m_frame_rate_limit{60};
+
+  /////////////////////////////////////////////////
+  /// @brief Most simulation ticks run in one frame.
+  ///
+  /// If a frame takes longer than this many ticks the simulation slows down
+  /// instead of spending ever longer catching up.
+  /////////////////////////////////////////////////
+  size_t m_max_ticks_per_frame{5};
+
+  /////////////////////////////////////////////////
+  /// @brief Is the game loop still running, cleared when the game quits.
+  /////////////////////////////////////////////////
+  bool m_running{true};
+
+  /////////////////////////////////////////////////
+  /// @brief Whether the engine opens a window and renders.
+  /////////////////////////////////////////////////
+  const DisplayMode m_display_mode;
+
+  /////////////////////////////////////////////////
+  /// @brief Member: RenderWindow for the game engine, never created in
+  /// Headless mode
   /////////////////////////////////////////////////
   sf::RenderWindow m_window;
 
@@ -56,6 +93,12 @@ private:
   /////////////////////////////////////////////////
   AssetManager m_asset_manager;
 
+  /////////////////////////////////////////////////
+  /// @brief JobSystem for running logic across worker threads, this should be
+  /// the only instance
+  /////////////////////////////////////////////////
+  JobSystem m_job_system;
+
   /////////////////////////////////////////////////
   /// @brief GameContext for the game
   /////////////////////////////////////////////////
@@ -73,10 +116,31 @@ private:
   DisplayManager m_display_manager;
 
   /////////////////////////////////////////////////
-  /// @brief Wrapper function to update any relevant systems
+  /// @brief Records the session's input, when recording
+  /////////////////////////////////////////////////
+  std::optional<EventRecorder> m_event_recorder;
+
+  /////////////////////////////////////////////////
+  /// @brief Recorded input fed in each tick, when replaying
+  /////////////////////////////////////////////////
+  std::optional<EventReplay> m_event_replay;
+
+  /////////////////////////////////////////////////
+  /// @brief Collect user input for the frame
+  /////////////////////////////////////////////////
+  void ProcessInput();
+
+  /////////////////////////////////////////////////
+  /// @brief Wrapper function to update any relevant systems for one simulation
+  /// tick
   /////////////////////////////////////////////////
   void UpdateSystems();
 
+  /////////////////////////////////////////////////
+  /// @brief Render the Scenes and display them in the window
+  /////////////////////////////////////////////////
+  void RenderFrame();
+
   /////////////////////////////////////////////////
   /// @brief Start up the game engine and load any resources
   /////////////////////////////////////////////////
@@ -84,6 +148,14 @@ private:
 
   /////////////////////////////////////////////////
   /// @brief Run the game loop until exit condition is met
+  ///
+  /// Real time is accumulated each frame and spent in fixed simulation ticks,
+  /// rendering happens once per frame at whatever rate the window allows. In
+  /// simulation mode every frame runs exactly one tick with no frame rate
+  /// limit, so ticks run as fast as the CPU allows.
+  ///
+  /// @param number_of_loops Number of ticks to run in simulation mode.
+  /// @param simulation Run for number_of_loops ticks, ignoring real time.
   /////////////////////////////////////////////////
   void RunGameLoop(size_t number_of_loops = 0, bool simulation = false);
 
@@ -93,6 +165,11 @@ private:
   ////////////////////////////////////////////////////////////
   void ShutDown();
 
+  /////////////////////////////////////////////////
+  /// @brief Stop the game loop and close the window
+  /////////////////////////////////////////////////
+  void StopGame();
+
   /////////////////////////////////////////////////
   /// @brief All subscribers registered to the GameEngine
   /////////////////////////////////////////////////
@@ -103,8 +180,11 @@ public:
   /// @brief Constructor for the GameEngine class
   ///
   /// @param env_type Environment type with which to initialize the engine
+  /// @param display_mode Headless skips the window, render textures and Render
+  /// Logic entirely
   /////////////////////////////////////////////////
-  GameEngine(const EnvironmentType env_type = EnvironmentType::None);
+  GameEngine(const EnvironmentType env_type = EnvironmentType::None,
+             const DisplayMode display_mode = DisplayMode::Windowed);
 
   /////////////////////////////////////////////////
   /// @brief Container function to configure the GameEngine from flatbuffers
@@ -127,6 +207,40 @@ public:
   ////////////////////////////////////////////////////////////
   size_t GetLoopNumber() const;
 
+  /////////////////////////////////////////////////
+  /// @brief Check if the game loop is still running
+  /////////////////////////////////////////////////
+  bool IsRunning() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Record every input event from now on, tagged with its loop number
+  /////////////////////////////////////////////////
+  void StartEventRecording();
+
+  /////////////////////////////////////////////////
+  /// @brief Write the input recorded since StartEventRecording
+  ///
+  /// @param recording_path Path of the file to write
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  SaveEventRecording(const std::filesystem::path &recording_path);
+
+  /////////////////////////////////////////////////
+  /// @brief Replay a recorded session's input, tick by tick
+  ///
+  /// The game stops on the loop number the recorded session ended on. Run it
+  /// headless in simulation mode to get the same workload on every run.
+  ///
+  /// @param recording_path Path of a file written by SaveEventRecording
+  /////////////////////////////////////////////////
+  std::expected<std::monostate, FailInfo>
+  LoadEventReplay(const std::filesystem::path &recording_path);
+
+  /////////////////////////////////////////////////
+  /// @brief Returns the length of one simulation tick
+  /////////////////////////////////////////////////
+  std::chrono::nanoseconds GetTickDuration() const;
+
   /////////////////////////////////////////////////
   /// @brief Add the Subscriber to the subscriptions vector.
   /////////////////////////////////////////////////
@@ -157,6 +271,11 @@ public:
   /////////////////////////////////////////////////
   const sf::RenderWindow &GetWindow() const;
 
+  /////////////////////////////////////////////////
+  /// @brief Returns a reference to the RenderWindow
+  /////////////////////////////////////////////////
+  sf::RenderWindow &GetWindow();
+
   /////////////////////////////////////////////////
   /// @brief Return a refence to the GameContext that lives on the GameEngine
   ///
@@ -30,28 +30,47 @@ struct ButtonElement : public UIElement {
   std::string label{"unlabelled"};
 
   /////////////////////////////////////////////////
-  /// @brief Draws the ButtonElement on a RenderTexture
+  /// @brief Glyph quads of the label, rebuilt when the label or layout changes
+  /////////////////////////////////////////////////
+  mutable CachedText cached_label;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of vertices WriteBatchVertices writes
+  /////////////////////////////////////////////////
+  size_t GetBatchVertexCount() const override {
+    return draw_ui_elements::kBorderAndBackgroundVertexCount;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Writes the border and background of the ButtonElement
   ///
-  /// @param texture Reference to the RenderTexture to draw on
+  /// @param vertices First of GetBatchVertexCount vertices to write
   /// @param style UIStyle providing values for drawing
   /////////////////////////////////////////////////
-  void DrawUIElement(sf::RenderTexture &texture,
-                     const UIStyle &style) const override {
+  void WriteBatchVertices(sf::Vertex *vertices,
+                          const UIStyle &style) const override {
+    draw_ui_elements::WriteBorderAndBackground(vertices, *this,
+                                               style.button_style);
+  }
 
-    // Draw the border and background
-    draw_ui_elements::DrawBorderAndBackground(texture, *this,
-                                              style.button_style);
+  /////////////////////////////////////////////////
+  /// @brief Updates the glyph quads of the label and returns them
+  ///
+  /// @param style UIStyle providing the font and text color
+  /////////////////////////////////////////////////
+  const CachedText *GetCachedLabel(const UIStyle &style) const override {
 
-    // Draw the button text
+    // the label is centred in a box offset by the border and margin
     sf::Vector2f text_position{
         position.x + style.button_style.border_thickness +
             style.button_style.inner_margin.x,
         position.y + style.button_style.border_thickness +
             style.button_style.inner_margin.y};
 
-    draw_ui_elements::DrawText(
-        texture, label, text_position, size, style.button_style.font,
-        style.button_style.font_size, style.button_style.text_color);
+    cached_label.Update(label, style.button_style.font.get(),
+                        style.button_style.font_size, {text_position, size},
+                        style.button_style.text_color);
+    return &cached_label;
   }
 };
 } // namespace steamrot
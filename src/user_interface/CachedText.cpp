@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the CachedText class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "CachedText.h"
+#include <SFML/Graphics/Glyph.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <algorithm>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Append the two triangles of a glyph quad
+///
+/// @param vertices Vertices to append to
+/// @param pen Position of the glyph origin on the baseline
+/// @param glyph Glyph to add
+/// @param color Fill color of the glyph
+/////////////////////////////////////////////////
+static void AppendGlyphQuad(std::vector<sf::Vertex> &vertices,
+                            const sf::Vector2f &pen, const sf::Glyph &glyph,
+                            const sf::Color &color) {
+  // glyph rects carry a pixel of padding, the same as sf::Text uses
+  constexpr float padding = 1.f;
+
+  const float left = pen.x + glyph.bounds.position.x - padding;
+  const float top = pen.y + glyph.bounds.position.y - padding;
+  const float right =
+      pen.x + glyph.bounds.position.x + glyph.bounds.size.x + padding;
+  const float bottom =
+      pen.y + glyph.bounds.position.y + glyph.bounds.size.y + padding;
+
+  const float u1 = static_cast<float>(glyph.textureRect.position.x) - padding;
+  const float v1 = static_cast<float>(glyph.textureRect.position.y) - padding;
+  const float u2 = static_cast<float>(glyph.textureRect.position.x +
+                                      glyph.textureRect.size.x) +
+                   padding;
+  const float v2 = static_cast<float>(glyph.textureRect.position.y +
+                                      glyph.textureRect.size.y) +
+                   padding;
+
+  vertices.push_back({{left, top}, color, {u1, v1}});
+  vertices.push_back({{right, top}, color, {u2, v1}});
+  vertices.push_back({{left, bottom}, color, {u1, v2}});
+  vertices.push_back({{left, bottom}, color, {u1, v2}});
+  vertices.push_back({{right, top}, color, {u2, v1}});
+  vertices.push_back({{right, bottom}, color, {u2, v2}});
+}
+
+/////////////////////////////////////////////////
+void CachedText::Rebuild() {
+  m_vertices.clear();
+  m_quad_bounds = {};
+
+  // shared between instances, so a label allocated where a destroyed one was
+  // never reports that label's version
+  static uint64_t next_version{0};
+  m_version = ++next_version;
+
+  if (!m_font || m_text.empty()) {
+    return;
+  }
+
+  const float character_size = static_cast<float>(m_character_size);
+  const float whitespace_width =
+      m_font->getGlyph(U' ', m_character_size, false).advance;
+
+  // pen starts on the baseline of the first line, as in sf::Text
+  sf::Vector2f pen{0.f, character_size};
+  float min_x = character_size;
+  float min_y = character_size;
+  float max_x = 0.f;
+  float max_y = 0.f;
+  char32_t previous_character = 0;
+
+  for (const char text_character : m_text) {
+    const char32_t character =
+        static_cast<char32_t>(static_cast<unsigned char>(text_character));
+
+    pen.x +=
+        m_font->getKerning(previous_character, character, m_character_size);
+    previous_character = character;
+
+    // whitespace has no quad but still counts towards the bounds
+    if (character == U' ' || character == U'\t') {
+      min_x = std::min(min_x, pen.x);
+      min_y = std::min(min_y, pen.y);
+      pen.x += character == U' ' ? whitespace_width : whitespace_width * 4;
+      max_x = std::max(max_x, pen.x);
+      max_y = std::max(max_y, pen.y);
+      continue;
+    }
+
+    const sf::Glyph &glyph =
+        m_font->getGlyph(character, m_character_size, false);
+    AppendGlyphQuad(m_vertices, pen, glyph, m_color);
+
+    min_x = std::min(min_x, pen.x + glyph.bounds.position.x);
+    max_x = std::max(max_x,
+                     pen.x + glyph.bounds.position.x + glyph.bounds.size.x);
+    min_y = std::min(min_y, pen.y + glyph.bounds.position.y);
+    max_y = std::max(max_y,
+                     pen.y + glyph.bounds.position.y + glyph.bounds.size.y);
+
+    pen.x += glyph.advance;
+  }
+
+  // move the centre of the laid out text onto the centre of the bounds
+  const sf::FloatRect text_bounds{{min_x, min_y},
+                                  {max_x - min_x, max_y - min_y}};
+  const sf::Vector2f offset = m_bounds.getCenter() - text_bounds.getCenter();
+  for (sf::Vertex &vertex : m_vertices) {
+    vertex.position += offset;
+  }
+
+  if (m_vertices.empty()) {
+    return;
+  }
+  sf::Vector2f top_left = m_vertices.front().position;
+  sf::Vector2f bottom_right = top_left;
+  for (const sf::Vertex &vertex : m_vertices) {
+    top_left.x = std::min(top_left.x, vertex.position.x);
+    top_left.y = std::min(top_left.y, vertex.position.y);
+    bottom_right.x = std::max(bottom_right.x, vertex.position.x);
+    bottom_right.y = std::max(bottom_right.y, vertex.position.y);
+  }
+  m_quad_bounds = {top_left, bottom_right - top_left};
+}
+
+/////////////////////////////////////////////////
+bool CachedText::Update(std::string_view text, const sf::Font *font,
+                        unsigned int character_size,
+                        const sf::FloatRect &bounds, const sf::Color &color) {
+  if (m_version > 0 && text == m_text && font == m_font &&
+      character_size == m_character_size && bounds == m_bounds &&
+      color == m_color) {
+    return false;
+  }
+
+  m_text.assign(text);
+  m_font = font;
+  m_character_size = character_size;
+  m_bounds = bounds;
+  m_color = color;
+  Rebuild();
+  return true;
+}
+
+/////////////////////////////////////////////////
+const std::vector<sf::Vertex> &CachedText::GetVertices() const {
+  return m_vertices;
+}
+
+/////////////////////////////////////////////////
+const sf::Texture *CachedText::GetTexture() const {
+  if (!m_font) {
+    return nullptr;
+  }
+  return &m_font->getTexture(m_character_size);
+}
+
+/////////////////////////////////////////////////
+const sf::FloatRect &CachedText::GetQuadBounds() const { return m_quad_bounds; }
+
+/////////////////////////////////////////////////
+uint64_t CachedText::GetVersion() const { return m_version; }
+
+/////////////////////////////////////////////////
+void CachedText::Draw(sf::RenderTarget &target) const {
+  if (m_vertices.empty()) {
+    return;
+  }
+  sf::RenderStates states;
+  states.texture = GetTexture();
+  target.draw(m_vertices.data(), m_vertices.size(),
+              sf::PrimitiveType::Triangles, states);
+}
+
+} // namespace steamrot
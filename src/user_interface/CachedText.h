@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the CachedText class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class CachedText
+/// @brief A single line label laid out once into textured glyph quads.
+///
+/// The quads are centred in the given bounds the same way draw_ui_elements
+/// centres an sf::Text, and are only rebuilt when the text, font, character
+/// size, bounds or color change. Texture coordinates point into the font's
+/// glyph page for the character size, so labels sharing a font and size can
+/// be drawn together.
+/////////////////////////////////////////////////
+class CachedText {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Text the quads were built from
+  /////////////////////////////////////////////////
+  std::string m_text;
+
+  /////////////////////////////////////////////////
+  /// @brief Font the quads were built from, null if there is none
+  /////////////////////////////////////////////////
+  const sf::Font *m_font{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Character size the quads were built at
+  /////////////////////////////////////////////////
+  unsigned int m_character_size{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Bounds the text is centred in
+  /////////////////////////////////////////////////
+  sf::FloatRect m_bounds;
+
+  /////////////////////////////////////////////////
+  /// @brief Fill color of the text
+  /////////////////////////////////////////////////
+  sf::Color m_color;
+
+  /////////////////////////////////////////////////
+  /// @brief Six vertices per visible glyph, in window coordinates
+  /////////////////////////////////////////////////
+  std::vector<sf::Vertex> m_vertices;
+
+  /////////////////////////////////////////////////
+  /// @brief Area covered by the glyph quads, which can overflow m_bounds
+  /////////////////////////////////////////////////
+  sf::FloatRect m_quad_bounds;
+
+  /////////////////////////////////////////////////
+  /// @brief Identifies the current quads, 0 until they are first built
+  /////////////////////////////////////////////////
+  uint64_t m_version{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Lay the glyphs out again from the stored text and font
+  /////////////////////////////////////////////////
+  void Rebuild();
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Rebuild the quads if anything they depend on changed
+  ///
+  /// @param text Label to show
+  /// @param font Font to draw with, nothing is drawn if null
+  /// @param character_size Character size in pixels
+  /// @param bounds Rectangle to centre the text in
+  /// @param color Fill color of the text
+  /// @return True if the quads were rebuilt
+  /////////////////////////////////////////////////
+  bool Update(std::string_view text, const sf::Font *font,
+              unsigned int character_size, const sf::FloatRect &bounds,
+              const sf::Color &color);
+
+  /////////////////////////////////////////////////
+  /// @brief Glyph quads as triangles, six vertices per glyph
+  /////////////////////////////////////////////////
+  const std::vector<sf::Vertex> &GetVertices() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Glyph page the texture coordinates refer to, null without a font
+  /////////////////////////////////////////////////
+  const sf::Texture *GetTexture() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Area covered by the glyph quads, empty if there are none
+  /////////////////////////////////////////////////
+  const sf::FloatRect &GetQuadBounds() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Identifier of the current quads, different after every rebuild
+  /////////////////////////////////////////////////
+  uint64_t GetVersion() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Draw the text on its own
+  ///
+  /// @param target Target to draw to
+  /////////////////////////////////////////////////
+  void Draw(sf::RenderTarget &target) const;
+};
+} // namespace steamrot
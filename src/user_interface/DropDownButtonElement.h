@@ -13,6 +13,7 @@
 /////////////////////////////////////////////////
 #include "UIElement.h"
 #include "draw_ui_elements.h"
+#include <array>
 
 namespace steamrot {
 struct DropDownButtonElement : public UIElement {
@@ -22,16 +23,24 @@ struct DropDownButtonElement : public UIElement {
   bool is_expanded{false};
 
   /////////////////////////////////////////////////
-  /// @brief Draws the DropDownButtonElement on a RenderTexture
+  /// @brief Number of vertices WriteBatchVertices writes, the box and the
+  /// triangle
+  /////////////////////////////////////////////////
+  size_t GetBatchVertexCount() const override {
+    return draw_ui_elements::kBorderAndBackgroundVertexCount + 3;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Writes the border, background and dropdown indicator triangle
   ///
-  /// @param texture Reference to the RenderTexture to draw on
+  /// @param vertices First of GetBatchVertexCount vertices to write
   /// @param style UIStyle providing values for drawing
   /////////////////////////////////////////////////
-  void DrawUIElement(sf::RenderTexture &texture,
-                     const UIStyle &style) const override {
+  void WriteBatchVertices(sf::Vertex *vertices,
+                          const UIStyle &style) const override {
 
-    draw_ui_elements::DrawBorderAndBackground(texture, *this,
-                                              style.drop_down_button_style);
+    draw_ui_elements::WriteBorderAndBackground(vertices, *this,
+                                               style.drop_down_button_style);
 
     // calculate the radius of the triangle using the size, border thickness,
     // and inner margin of the button
@@ -40,23 +49,29 @@ struct DropDownButtonElement : public UIElement {
          2 * style.drop_down_button_style.inner_margin.x) /
         2.0f;
 
-    // create a triangle shape for the dropdown indicator
-    sf::CircleShape triangle{triangle_radius, 3};
-    triangle.setFillColor(style.drop_down_button_style.triangle_color);
+    // corners of an upward equilateral triangle inscribed in that radius,
+    // relative to the centre of its bounds
+    const float half_width = triangle_radius * 0.8660254f;
+    const float half_height = triangle_radius * 0.75f;
+    std::array<sf::Vector2f, 3> corners{sf::Vector2f{0.f, -half_height},
+                                        sf::Vector2f{half_width, half_height},
+                                        sf::Vector2f{-half_width, half_height}};
 
-    // set the origin to the center of the triangle
-    triangle.setOrigin(triangle.getLocalBounds().getCenter());
-    if (!is_expanded) {
-      // rotate the triangle 180 degrees to point downwards if the dropdown is
-      // not expanded
-      triangle.setRotation(sf::degrees(180.0f));
+    // position the triangle in the centre of the button, pointing downwards
+    // if the dropdown is not expanded
+    sf::Vector2f centre = sf::FloatRect{position, size}.getCenter();
+    sf::Vertex *triangle =
+        vertices + draw_ui_elements::kBorderAndBackgroundVertexCount;
+    for (size_t i = 0; i < corners.size(); i++) {
+      sf::Vector2f corner = is_expanded ? corners[i] : -corners[i];
+      triangle[i] = sf::Vertex{centre + corner,
+                               style.drop_down_button_style.triangle_color};
     }
-    // position the triangle in the centre of the button
-    sf::FloatRect button_bounds{position, size};
-    triangle.setPosition(button_bounds.getCenter());
-
-    // draw the triangle on the texture
-    texture.draw(triangle);
   }
+
+  /////////////////////////////////////////////////
+  /// @brief The triangle points the other way when expanded
+  /////////////////////////////////////////////////
+  uint8_t GetDrawVariant() const override { return is_expanded; }
 };
 } // namespace steamrot
@@ -24,17 +24,22 @@ struct DropDownContainerElement : public UIElement {
   bool is_expanded{false};
 
   /////////////////////////////////////////////////
-  /// @brief Draws the DropDownContainerElement on a RenderTexture
+  /// @brief Number of vertices WriteBatchVertices writes
+  /////////////////////////////////////////////////
+  size_t GetBatchVertexCount() const override {
+    return draw_ui_elements::kBorderAndBackgroundVertexCount;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Writes the border and background of the DropDownContainerElement
   ///
-  /// @param texture Reference to the RenderTexture to draw on
+  /// @param vertices First of GetBatchVertexCount vertices to write
   /// @param style UIStyle providing values for drawing
   /////////////////////////////////////////////////
-  void DrawUIElement(sf::RenderTexture &texture,
-                     const UIStyle &style) const override {
-
-    // Draw the border and background for the container
-    draw_ui_elements::DrawBorderAndBackground(texture, *this,
-                                              style.drop_down_container_style);
+  void WriteBatchVertices(sf::Vertex *vertices,
+                          const UIStyle &style) const override {
+    draw_ui_elements::WriteBorderAndBackground(vertices, *this,
+                                               style.drop_down_container_style);
   }
 };
 
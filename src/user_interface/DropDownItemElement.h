@@ -28,15 +28,39 @@ struct DropDownItemElement : public UIElement {
   std::string value{"value..."};
 
   /////////////////////////////////////////////////
-  /// @brief Draws the DropDownItemElement on a RenderTexture
+  /// @brief Glyph quads of the label, rebuilt when the label or layout changes
+  /////////////////////////////////////////////////
+  mutable CachedText cached_label;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of vertices WriteBatchVertices writes
+  /////////////////////////////////////////////////
+  size_t GetBatchVertexCount() const override {
+    return draw_ui_elements::kBorderAndBackgroundVertexCount;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Writes the border and background of the DropDownItemElement
   ///
-  /// @param texture Reference to the RenderTexture to draw on
+  /// @param vertices First of GetBatchVertexCount vertices to write
   /// @param style UIStyle providing values for drawing
   /////////////////////////////////////////////////
-  void DrawUIElement(sf::RenderTexture &texture,
-                     const UIStyle &style) const override {
-    draw_ui_elements::DrawBorderAndBackground(texture, *this,
-                                              style.drop_down_item_style);
+  void WriteBatchVertices(sf::Vertex *vertices,
+                          const UIStyle &style) const override {
+    draw_ui_elements::WriteBorderAndBackground(vertices, *this,
+                                               style.drop_down_item_style);
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Updates the glyph quads of the label and returns them
+  ///
+  /// @param style UIStyle providing the font and text color
+  /////////////////////////////////////////////////
+  const CachedText *GetCachedLabel(const UIStyle &style) const override {
+    cached_label.Update(label, style.drop_down_item_style.font.get(),
+                        style.drop_down_item_style.font_size, {position, size},
+                        style.drop_down_item_style.text_color);
+    return &cached_label;
   }
 };
 
@@ -39,15 +39,36 @@ struct DropDownListElement : public UIElement {
       DataPopulateFunction::DataPopulateFunction_None};
 
   /////////////////////////////////////////////////
-  /// @brief Draws the DropDownListElement on a RenderTexture
+  /// @brief Glyph quads of the shown label, rebuilt when it changes
+  /////////////////////////////////////////////////
+  mutable CachedText cached_label;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of vertices WriteBatchVertices writes
+  /////////////////////////////////////////////////
+  size_t GetBatchVertexCount() const override {
+    return draw_ui_elements::kBorderAndBackgroundVertexCount;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Writes the border and background of the DropDownListElement
   ///
-  /// @param texture Reference to the RenderTexture to draw on
+  /// @param vertices First of GetBatchVertexCount vertices to write
   /// @param style UIStyle providing values for drawing
   /////////////////////////////////////////////////
-  void DrawUIElement(sf::RenderTexture &texture,
-                     const UIStyle &style) const override {
-    draw_ui_elements::DrawBorderAndBackground(texture, *this,
-                                              style.drop_down_list_style);
+  void WriteBatchVertices(sf::Vertex *vertices,
+                          const UIStyle &style) const override {
+    draw_ui_elements::WriteBorderAndBackground(vertices, *this,
+                                               style.drop_down_list_style);
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Updates the glyph quads of the label for the current expanded
+  /// state and returns them
+  ///
+  /// @param style UIStyle providing the font and text color
+  /////////////////////////////////////////////////
+  const CachedText *GetCachedLabel(const UIStyle &style) const override {
 
     // calculate the position for the text
     sf::Vector2f text_position{
@@ -57,13 +78,13 @@ struct DropDownListElement : public UIElement {
             style.drop_down_list_style.inner_margin.y};
 
     // set the label based on whether the dropdown is expanded
-    std::string label = is_expanded ? expanded_label : unexpanded_label;
+    const std::string &label = is_expanded ? expanded_label : unexpanded_label;
 
-    draw_ui_elements::DrawText(texture, label, text_position, size,
-                               style.drop_down_list_style.font,
-                               style.drop_down_list_style.font_size,
-                               style.drop_down_list_style.text_color);
-    ;
+    cached_label.Update(label, style.drop_down_list_style.font.get(),
+                        style.drop_down_list_style.font_size,
+                        {text_position, size},
+                        style.drop_down_list_style.text_color);
+    return &cached_label;
   }
 };
 } // namespace steamrot
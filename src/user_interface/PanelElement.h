@@ -19,15 +19,22 @@ namespace steamrot {
 struct PanelElement : public UIElement {
 
   /////////////////////////////////////////////////
-  /// @brief Draws the PanelElement on a RenderTexture
+  /// @brief Number of vertices WriteBatchVertices writes
+  /////////////////////////////////////////////////
+  size_t GetBatchVertexCount() const override {
+    return draw_ui_elements::kBorderAndBackgroundVertexCount;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Writes the border and background of the PanelElement
   ///
-  /// @param texture Reference to the RenderTexture to draw on
+  /// @param vertices First of GetBatchVertexCount vertices to write
   /// @param style UIStyle providing values for drawing
   /////////////////////////////////////////////////
-  void DrawUIElement(sf::RenderTexture &texture,
-                     const UIStyle &style) const override {
-    draw_ui_elements::DrawBorderAndBackground(texture, *this,
-                                              style.panel_style);
+  void WriteBatchVertices(sf::Vertex *vertices,
+                          const UIStyle &style) const override {
+    draw_ui_elements::WriteBorderAndBackground(vertices, *this,
+                                               style.panel_style);
   }
 };
 
@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the UIBatch class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIBatch.h"
+#include <SFML/Graphics/RenderStates.hpp>
+#include <algorithm>
+#include <iterator>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Smallest rectangle containing both rectangles, ignoring empty ones
+/////////////////////////////////////////////////
+static sf::FloatRect Enclose(const sf::FloatRect &first,
+                             const sf::FloatRect &second) {
+  if (first.size.x <= 0.f || first.size.y <= 0.f) {
+    return second;
+  }
+  if (second.size.x <= 0.f || second.size.y <= 0.f) {
+    return first;
+  }
+  const sf::Vector2f top_left{std::min(first.position.x, second.position.x),
+                              std::min(first.position.y, second.position.y)};
+  const sf::Vector2f bottom_right{
+      std::max(first.position.x + first.size.x,
+               second.position.x + second.size.x),
+      std::max(first.position.y + first.size.y,
+               second.position.y + second.size.y)};
+  return {top_left, bottom_right - top_left};
+}
+
+/////////////////////////////////////////////////
+bool UIBatch::MatchesRecords() const {
+  if (m_visited.size() != m_records.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < m_visited.size(); i++) {
+    const UIElement &element = *m_visited[i].element;
+    const ElementRecord &record = m_records[i];
+
+    // an address can be reused by a new element, so check the type as well
+    if (record.element != &element ||
+        *record.element_type != typeid(element) ||
+        record.depth != m_visited[i].depth ||
+        record.vertex_count != element.GetBatchVertexCount()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+void UIBatch::RebuildRecords() {
+  m_records.clear();
+  m_layers.clear();
+
+  size_t vertex_count{0};
+  for (const VisitedElement &visited : m_visited) {
+    ElementRecord record;
+    record.element = visited.element;
+    record.element_type = &typeid(*visited.element);
+    record.depth = visited.depth;
+    record.first_vertex = vertex_count;
+    record.vertex_count = visited.element->GetBatchVertexCount();
+    m_records.push_back(record);
+
+    // depths are visited in order, each starts a layer
+    if (visited.depth == m_layers.size()) {
+      m_layers.push_back({vertex_count, 0});
+    }
+    m_layers.back().vertex_count += record.vertex_count;
+
+    vertex_count += record.vertex_count;
+  }
+  m_vertices.resize(vertex_count);
+}
+
+/////////////////////////////////////////////////
+void UIBatch::WriteElement(ElementRecord &record, bool visible,
+                           const UIStyle &style) {
+  const UIElement &element = *record.element;
+  sf::Vertex *vertices = &m_vertices[record.first_vertex];
+
+  if (visible) {
+    element.WriteBatchVertices(vertices, style);
+  } else {
+    // zero area triangles draw nothing
+    std::fill(vertices, vertices + record.vertex_count, sf::Vertex{});
+  }
+
+  record.position = element.position;
+  record.size = element.size;
+  record.is_mouse_over = element.is_mouse_over;
+  record.visible = visible;
+  record.draw_variant = element.GetDrawVariant();
+  m_rewritten_count++;
+}
+
+/////////////////////////////////////////////////
+void UIBatch::UpdateLabels(const UIStyle &style) {
+  m_visited_labels.clear();
+  for (const VisitedElement &visited : m_visited) {
+    if (!visited.visible) {
+      continue;
+    }
+    const CachedText *label = visited.element->GetCachedLabel(style);
+    if (!label || label->GetVertices().empty()) {
+      continue;
+    }
+    m_visited_labels.push_back({label, visited.depth, label->GetVersion()});
+  }
+
+  // no label was rebuilt, shown or hidden
+  if (m_visited_labels == m_labels) {
+    return;
+  }
+  m_labels = m_visited_labels;
+  m_labels_changed = true;
+  m_label_bounds = {};
+
+  // vertex arrays keep their capacity, so regathering does not allocate
+  for (TextPage &page : m_text_pages) {
+    page.vertices.clear();
+  }
+  for (const LabelRecord &record : m_labels) {
+    const sf::Texture *texture = record.label->GetTexture();
+    auto page = std::find_if(m_text_pages.begin(), m_text_pages.end(),
+                             [texture, &record](const TextPage &page) {
+                               return page.texture == texture &&
+                                      page.depth == record.depth;
+                             });
+    if (page == m_text_pages.end()) {
+      m_text_pages.push_back(TextPage{texture, record.depth});
+      page = std::prev(m_text_pages.end());
+    }
+    for (const sf::Vertex &vertex : record.label->GetVertices()) {
+      page->vertices.append(vertex);
+    }
+    m_label_bounds = Enclose(m_label_bounds, record.label->GetQuadBounds());
+  }
+}
+
+/////////////////////////////////////////////////
+void UIBatch::Update(const UIElement &root_element, const UIStyle &style) {
+  m_rewritten_count = 0;
+  m_labels_changed = false;
+
+  m_visited.clear();
+  VisitUIElementsByDepth(root_element, m_visited);
+
+  // a different tree shape or style means every run has to be written
+  bool rewrite_all = m_style != &style;
+  if (!MatchesRecords()) {
+    RebuildRecords();
+    rewrite_all = true;
+  }
+  m_style = &style;
+
+  for (size_t i = 0; i < m_records.size(); i++) {
+    ElementRecord &record = m_records[i];
+    const UIElement &element = *record.element;
+    const bool visible = m_visited[i].visible;
+
+    if (rewrite_all || record.visible != visible ||
+        record.position != element.position || record.size != element.size ||
+        record.is_mouse_over != element.is_mouse_over ||
+        record.draw_variant != element.GetDrawVariant()) {
+      WriteElement(record, visible, style);
+    }
+  }
+
+  UpdateLabels(style);
+
+  m_bounds = m_label_bounds;
+  for (const ElementRecord &record : m_records) {
+    if (record.visible) {
+      m_bounds = Enclose(m_bounds, {record.position, record.size});
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void UIBatch::Draw(sf::RenderTarget &target, sf::RenderStates states) const {
+  for (size_t depth = 0; depth < m_layers.size(); depth++) {
+    const DepthLayer &layer = m_layers[depth];
+
+    if (layer.vertex_count > 0) {
+      states.texture = nullptr;
+      target.draw(&m_vertices[layer.first_vertex], layer.vertex_count,
+                  sf::PrimitiveType::Triangles, states);
+    }
+
+    // labels go over the shapes of their own depth and under the next one
+    for (const TextPage &page : m_text_pages) {
+      if (page.depth != depth || page.vertices.getVertexCount() == 0) {
+        continue;
+      }
+      states.texture = page.texture;
+      target.draw(page.vertices, states);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+bool UIBatch::HasChanged() const {
+  return m_rewritten_count > 0 || m_labels_changed;
+}
+
+/////////////////////////////////////////////////
+const sf::FloatRect &UIBatch::GetBounds() const { return m_bounds; }
+
+/////////////////////////////////////////////////
+size_t UIBatch::GetVertexCount() const { return m_vertices.getVertexCount(); }
+
+/////////////////////////////////////////////////
+size_t UIBatch::GetRewrittenCount() const { return m_rewritten_count; }
+
+/////////////////////////////////////////////////
+size_t UIBatch::GetTextPageCount() const {
+  return std::count_if(m_text_pages.begin(), m_text_pages.end(),
+                       [](const TextPage &page) {
+                         return page.vertices.getVertexCount() > 0;
+                       });
+}
+
+} // namespace steamrot
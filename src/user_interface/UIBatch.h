@@ -0,0 +1,227 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the UIBatch class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIElement.h"
+#include "UIStyle.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <typeinfo>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class UIBatch
+/// @brief A whole UIElement tree in one vertex array per texture.
+///
+/// Every element owns a fixed run of untextured vertices. Update only rewrites
+/// the runs of elements whose drawn state changed. Elements hidden by a
+/// parent's children_active keep their run, collapsed so nothing is drawn.
+///
+/// The tree is drawn one depth at a time, so children still paint over their
+/// parents: the shapes of a depth in a single call, then its labels with one
+/// vertex array per font glyph page. Those arrays are only gathered again when
+/// a label is rebuilt or the set of visible labels changes.
+/////////////////////////////////////////////////
+class UIBatch {
+private:
+  /////////////////////////////////////////////////
+  /// @brief An element's run of vertices and the state it was written from
+  /////////////////////////////////////////////////
+  struct ElementRecord {
+    const UIElement *element{nullptr};
+    const std::type_info *element_type{nullptr};
+    size_t depth{0};
+    size_t first_vertex{0};
+    size_t vertex_count{0};
+    sf::Vector2f position;
+    sf::Vector2f size;
+    bool is_mouse_over{false};
+    bool visible{false};
+    uint8_t draw_variant{0};
+  };
+
+  /////////////////////////////////////////////////
+  /// @brief An element in draw order, its depth and whether it is visible
+  /////////////////////////////////////////////////
+  using VisitedElement = DrawOrderedUIElement<const UIElement>;
+
+  /////////////////////////////////////////////////
+  /// @brief A visible label, the depth it is drawn at and the version of it
+  /// that was gathered
+  /////////////////////////////////////////////////
+  struct LabelRecord {
+    const CachedText *label;
+    size_t depth;
+    uint64_t version;
+
+    bool operator==(const LabelRecord &other) const = default;
+  };
+
+  /////////////////////////////////////////////////
+  /// @brief Glyph quads of every label of a depth drawn from one texture
+  /////////////////////////////////////////////////
+  struct TextPage {
+    const sf::Texture *texture;
+    size_t depth;
+    sf::VertexArray vertices{sf::PrimitiveType::Triangles};
+  };
+
+  /////////////////////////////////////////////////
+  /// @brief Vertices of every element at one depth of the tree
+  /////////////////////////////////////////////////
+  struct DepthLayer {
+    size_t first_vertex{0};
+    size_t vertex_count{0};
+  };
+
+  /////////////////////////////////////////////////
+  /// @brief Vertices of every element in the tree, drawn as triangles
+  /////////////////////////////////////////////////
+  sf::VertexArray m_vertices{sf::PrimitiveType::Triangles};
+
+  /////////////////////////////////////////////////
+  /// @brief One record per element, in draw order
+  /////////////////////////////////////////////////
+  std::vector<ElementRecord> m_records;
+
+  /////////////////////////////////////////////////
+  /// @brief Vertex range of each depth, indexed by depth
+  /////////////////////////////////////////////////
+  std::vector<DepthLayer> m_layers;
+
+  /////////////////////////////////////////////////
+  /// @brief Elements visited by the last Update, reused between frames
+  /////////////////////////////////////////////////
+  std::vector<VisitedElement> m_visited;
+
+  /////////////////////////////////////////////////
+  /// @brief Labels gathered into m_text_pages, in draw order
+  /////////////////////////////////////////////////
+  std::vector<LabelRecord> m_labels;
+
+  /////////////////////////////////////////////////
+  /// @brief Labels visible in the last Update, reused between frames
+  /////////////////////////////////////////////////
+  std::vector<LabelRecord> m_visited_labels;
+
+  /////////////////////////////////////////////////
+  /// @brief Label vertices grouped by glyph page
+  /////////////////////////////////////////////////
+  std::vector<TextPage> m_text_pages;
+
+  /////////////////////////////////////////////////
+  /// @brief Style the vertices were written with
+  /////////////////////////////////////////////////
+  const UIStyle *m_style{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Number of element runs rewritten by the last Update
+  /////////////////////////////////////////////////
+  size_t m_rewritten_count{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Whether the last Update regathered the labels
+  /////////////////////////////////////////////////
+  bool m_labels_changed{false};
+
+  /////////////////////////////////////////////////
+  /// @brief Area covered by the gathered labels
+  /////////////////////////////////////////////////
+  sf::FloatRect m_label_bounds;
+
+  /////////////////////////////////////////////////
+  /// @brief Area covered by everything the batch draws
+  /////////////////////////////////////////////////
+  sf::FloatRect m_bounds;
+
+  /////////////////////////////////////////////////
+  /// @brief Update the labels of visible elements and regather them if any
+  /// changed
+  ///
+  /// @param style Style providing fonts and text colors
+  /////////////////////////////////////////////////
+  void UpdateLabels(const UIStyle &style);
+
+  /////////////////////////////////////////////////
+  /// @brief Whether m_visited holds the same elements as m_records
+  /////////////////////////////////////////////////
+  bool MatchesRecords() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Lay out a run of vertices for each visited element and a range
+  /// for each depth
+  /////////////////////////////////////////////////
+  void RebuildRecords();
+
+  /////////////////////////////////////////////////
+  /// @brief Rewrite the vertices of one element from its current state
+  ///
+  /// @param record Record of the element to write
+  /// @param visible Whether the element is drawn
+  /// @param style Style to write with
+  /////////////////////////////////////////////////
+  void WriteElement(ElementRecord &record, bool visible, const UIStyle &style);
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Bring the vertices in line with a laid out UIElement tree
+  ///
+  /// @param root_element Root of the tree to batch
+  /// @param style Style to write the vertices with
+  /////////////////////////////////////////////////
+  void Update(const UIElement &root_element, const UIStyle &style);
+
+  /////////////////////////////////////////////////
+  /// @brief Draw the batched tree, for each depth one call for the shapes and
+  /// one per glyph page
+  ///
+  /// @param target Target to draw to
+  /// @param states States to draw with, the texture is set for glyph pages
+  /////////////////////////////////////////////////
+  void Draw(sf::RenderTarget &target,
+            sf::RenderStates states = sf::RenderStates::Default) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Whether the last Update changed anything that is drawn
+  /////////////////////////////////////////////////
+  bool HasChanged() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Area covered by the visible elements and their labels
+  /////////////////////////////////////////////////
+  const sf::FloatRect &GetBounds() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of vertices in the batch
+  /////////////////////////////////////////////////
+  size_t GetVertexCount() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of elements whose vertices the last Update rewrote
+  /////////////////////////////////////////////////
+  size_t GetRewrittenCount() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of glyph pages with labels on them across all depths, one
+  /// draw call each
+  /////////////////////////////////////////////////
+  size_t GetTextPageCount() const;
+};
+} // namespace steamrot
@@ -4,4 +4,60 @@
 /////////////////////////////////////////////////
 #include "UIElement.h"
 
-namespace steamrot {}
+namespace steamrot {
+
+/////////////////////////////////////////////////
+void UIElement::DrawUIElement(sf::RenderTexture &texture,
+                              const UIStyle &style) const {
+  std::vector<sf::Vertex> vertices(GetBatchVertexCount());
+  WriteBatchVertices(vertices.data(), style);
+  texture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+
+  if (const CachedText *label = GetCachedLabel(style)) {
+    label->Draw(texture);
+  }
+}
+
+/////////////////////////////////////////////////
+void UIElement::MarkLayoutDirty() {
+  layout_dirty = true;
+
+  // stop at the first ancestor that already knows, everything above it does
+  for (UIElement *ancestor = parent;
+       ancestor && !ancestor->descendant_layout_dirty;
+       ancestor = ancestor->parent) {
+    ancestor->descendant_layout_dirty = true;
+  }
+}
+
+/////////////////////////////////////////////////
+void UIElement::SetPosition(const sf::Vector2f &new_position) {
+  if (position == new_position)
+    return;
+  position = new_position;
+  MarkLayoutDirty();
+}
+
+/////////////////////////////////////////////////
+void UIElement::SetSize(const sf::Vector2f &new_size) {
+  if (size == new_size)
+    return;
+  size = new_size;
+  MarkLayoutDirty();
+}
+
+/////////////////////////////////////////////////
+UIElement &UIElement::AddChildElement(std::unique_ptr<UIElement> child) {
+  child->parent = this;
+  child_elements.push_back(std::move(child));
+  MarkLayoutDirty();
+  return *child_elements.back();
+}
+
+/////////////////////////////////////////////////
+void UIElement::ClearChildElements() {
+  child_elements.clear();
+  MarkLayoutDirty();
+}
+
+} // namespace steamrot
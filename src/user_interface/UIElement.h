@@ -7,6 +7,7 @@
 /////////////////////////////////////////////////
 /// Preprocessor Directives
 /////////////////////////////////////////////////
+#include "CachedText.h"
 #include "EventPacket.h"
 #include "Subscriber.h"
 #include "UIStyle.h"
@@ -18,7 +19,10 @@
 /////////////////////////////////////////////////
 #include "user_interface_generated.h"
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace steamrot {
@@ -62,9 +66,42 @@ struct UIElement {
 
   /////////////////////////////////////////////////
   /// @brief Container for all child elements. Can be empty
+  ///
+  /// Add and remove children with AddChildElement and ClearChildElements once
+  /// the element has been laid out, so the change is picked up.
   /////////////////////////////////////////////////
   std::vector<std::unique_ptr<UIElement>> child_elements;
 
+  /////////////////////////////////////////////////
+  /// @brief Element that owns this one, null for a root element
+  ///
+  /// Refreshed by the layout pass, only used to propagate dirty flags up.
+  /////////////////////////////////////////////////
+  UIElement *parent{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief The children of this element need sizing and positioning again
+  /////////////////////////////////////////////////
+  bool layout_dirty{true};
+
+  /////////////////////////////////////////////////
+  /// @brief Some element below this one has layout_dirty set
+  /////////////////////////////////////////////////
+  bool descendant_layout_dirty{true};
+
+  /////////////////////////////////////////////////
+  /// @brief Style a root element was last laid out with
+  /////////////////////////////////////////////////
+  const UIStyle *layout_style{nullptr};
+
+  /////////////////////////////////////////////////
+  /// @brief Set on a root element each time the layout pass changes its tree
+  ///
+  /// Unique across trees, so anything derived from the laid out tree can tell
+  /// whether it is stale by comparing this alone.
+  /////////////////////////////////////////////////
+  uint64_t layout_generation{0};
+
   /////////////////////////////////////////////////
   /// @brief Spacing and sizing strategy for the children elements defaulting to
   /// Even
@@ -77,9 +114,119 @@ struct UIElement {
   /////////////////////////////////////////////////
   LayoutType layout{LayoutType::LayoutType_Vertical};
 
+  /////////////////////////////////////////////////
+  /// @brief Draw the element on its own, its batch vertices then its label
+  ///
+  /// A UIBatch draws whole trees in one call, this is for a single element.
+  ///
+  /// @param texture Reference to the RenderTexture to draw on
+  /// @param style UIStyle providing values for drawing
+  /////////////////////////////////////////////////
   virtual void DrawUIElement(sf::RenderTexture &texture,
-                             const UIStyle &style) const = 0;
+                             const UIStyle &style) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of vertices WriteBatchVertices writes
+  /////////////////////////////////////////////////
+  virtual size_t GetBatchVertexCount() const = 0;
+
+  /////////////////////////////////////////////////
+  /// @brief Write the untextured shapes of the element as triangles
+  ///
+  /// @param vertices First of GetBatchVertexCount vertices to write
+  /// @param style UIStyle providing values for drawing
+  /////////////////////////////////////////////////
+  virtual void WriteBatchVertices(sf::Vertex *vertices,
+                                  const UIStyle &style) const = 0;
+
+  /////////////////////////////////////////////////
+  /// @brief Bring the element's label up to date and return it
+  ///
+  /// @param style UIStyle providing the font and text color
+  /// @return Null if the element has no label
+  /////////////////////////////////////////////////
+  virtual const CachedText *GetCachedLabel(const UIStyle &style) const {
+    return nullptr;
+  }
+
+  /////////////////////////////////////////////////
+  /// @brief Element specific state that changes the batch vertices
+  /////////////////////////////////////////////////
+  virtual uint8_t GetDrawVariant() const { return 0; }
+
+  /////////////////////////////////////////////////
+  /// @brief Flag the children of this element for layout and tell every
+  /// ancestor there is layout to do below it
+  /////////////////////////////////////////////////
+  void MarkLayoutDirty();
+
+  /////////////////////////////////////////////////
+  /// @brief Move the element, marking it dirty if the position changed
+  ///
+  /// @param new_position Position of the UI element in the window
+  /////////////////////////////////////////////////
+  void SetPosition(const sf::Vector2f &new_position);
+
+  /////////////////////////////////////////////////
+  /// @brief Resize the element, marking it dirty if the size changed
+  ///
+  /// @param new_size Size of the UI element
+  /////////////////////////////////////////////////
+  void SetSize(const sf::Vector2f &new_size);
+
+  /////////////////////////////////////////////////
+  /// @brief Take ownership of a child element and mark this element dirty
+  ///
+  /// @param child Element to add after the existing children
+  /// @return Reference to the added child
+  /////////////////////////////////////////////////
+  UIElement &AddChildElement(std::unique_ptr<UIElement> child);
+
+  /////////////////////////////////////////////////
+  /// @brief Remove every child element and mark this element dirty
+  /////////////////////////////////////////////////
+  void ClearChildElements();
 
   virtual ~UIElement() = default;
 };
+
+/////////////////////////////////////////////////
+/// @brief An element in draw order, its depth below its root and whether every
+/// ancestor shows its children
+/////////////////////////////////////////////////
+template <typename Element> struct DrawOrderedUIElement {
+  Element *element;
+  size_t depth;
+  bool visible;
+};
+
+/////////////////////////////////////////////////
+/// @brief Append a tree to elements in the order it is drawn, a depth at a
+/// time and in tree order within a depth
+///
+/// UIBatch draws in this order and UISpatialIndex hit tests in it, so the last
+/// element containing a point is the one on top.
+///
+/// @param root_element Root of the tree to visit
+/// @param elements Elements to append to, const or not like the root
+/////////////////////////////////////////////////
+template <typename Element>
+void VisitUIElementsByDepth(
+    Element &root_element,
+    std::vector<DrawOrderedUIElement<Element>> &elements) {
+  static_assert(std::is_same_v<std::remove_const_t<Element>, UIElement>);
+
+  const size_t first_element = elements.size();
+  elements.push_back({&root_element, 0, true});
+
+  // breadth first, elements doubles as the queue
+  for (size_t i = first_element; i < elements.size(); i++) {
+    const DrawOrderedUIElement<Element> visited = elements[i];
+    const bool children_visible =
+        visited.visible && visited.element->children_active;
+    for (const auto &child : visited.element->child_elements) {
+      elements.push_back({child.get(), visited.depth + 1, children_visible});
+    }
+  }
+}
 } // namespace steamrot
@@ -8,9 +8,9 @@
 #include "FailInfo.h"
 #include "SubscriberFactory.h"
 #include "event_helpers.h"
+#include "log_channel.h"
 #include "user_interface_generated.h"
 #include <expected>
-#include <iostream>
 #include <string>
 #include <variant>
 
@@ -91,12 +91,9 @@ CreateUIElement(const UIElementDataUnion &data_type, const void *data,
         FailInfo{FailMode::NonExistentEnumValue,
                  "CreateUIElement: Unsupported UI element type in union."});
   }
-  std::cout << "Swtich statment complete." << std::endl;
-
   // Only call this once!
   if (base_data) {
 
-    std::cout << "Configuring base UI element." << std::endl;
     auto base_config_result =
         ConfigureBaseUIElement(*element, *base_data, event_hanlder);
     if (!base_config_result.has_value())
@@ -108,7 +105,7 @@ CreateUIElement(const UIElementDataUnion &data_type, const void *data,
         FailInfo{FailMode::FlatbuffersDataNotFound,
                  "CreateUIElement: Element creation failed, element is null."});
   }
-  std::cout << "UI element created successfully." << std::endl;
+  STEAMROT_LOG_DEBUG(LogChannel::UI, "ui element created");
   return element;
 }
 
@@ -182,7 +179,7 @@ ConfigureBaseUIElement(UIElement &element, const UIElementData &data,
           CreateUIElement(type, child_table, event_handler);
       if (!child_element_result.has_value())
         return std::unexpected(child_element_result.error());
-      element.child_elements.push_back(std::move(child_element_result.value()));
+      element.AddChildElement(std::move(child_element_result.value()));
     }
   }
 
@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the UIRenderCache class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIRenderCache.h"
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+const sf::BlendMode UIRenderCache::kCacheBlendMode{
+    sf::BlendMode::Factor::SrcAlpha,
+    sf::BlendMode::Factor::OneMinusSrcAlpha, sf::BlendMode::Equation::Add,
+    sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha,
+    sf::BlendMode::Equation::Add};
+
+/////////////////////////////////////////////////
+const sf::BlendMode UIRenderCache::kCompositeBlendMode{
+    sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha};
+
+/////////////////////////////////////////////////
+bool UIRenderCache::Redraw(const UIBatch &batch) {
+  // whole pixels, so the cached quad is not resampled when composited
+  const sf::FloatRect &bounds = batch.GetBounds();
+  const sf::Vector2f top_left{std::floor(bounds.position.x),
+                              std::floor(bounds.position.y)};
+  const sf::Vector2f bottom_right{
+      std::ceil(bounds.position.x + bounds.size.x),
+      std::ceil(bounds.position.y + bounds.size.y)};
+  m_area = {top_left, bottom_right - top_left};
+
+  if (m_area.size.x <= 0.f || m_area.size.y <= 0.f) {
+    // nothing visible, so there is nothing to cache
+    m_redraw_count++;
+    return true;
+  }
+
+  const sf::Vector2u required_size{static_cast<unsigned int>(m_area.size.x),
+                                   static_cast<unsigned int>(m_area.size.y)};
+  const sf::Vector2u current_size = m_texture.getSize();
+  if (required_size.x > current_size.x || required_size.y > current_size.y) {
+    // grow to cover both, so a tree changing shape does not reallocate each
+    // frame
+    if (!m_texture.resize({std::max(required_size.x, current_size.x),
+                           std::max(required_size.y, current_size.y)})) {
+      return false;
+    }
+  }
+
+  m_texture.setView(sf::View{
+      sf::FloatRect{m_area.position, sf::Vector2f(m_texture.getSize())}});
+  m_texture.clear(sf::Color::Transparent);
+  batch.Draw(m_texture, sf::RenderStates{kCacheBlendMode});
+  m_texture.display();
+
+  m_redraw_count++;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void UIRenderCache::Draw(sf::RenderTarget &target, const UIBatch &batch) {
+  if (!m_valid || batch.HasChanged()) {
+    m_valid = Redraw(batch);
+  }
+
+  if (!m_valid) {
+    batch.Draw(target);
+    return;
+  }
+  if (m_area.size.x <= 0.f || m_area.size.y <= 0.f) {
+    return;
+  }
+
+  sf::Sprite sprite{m_texture.getTexture(),
+                    sf::IntRect{{0, 0}, sf::Vector2i(m_area.size)}};
+  sprite.setPosition(m_area.position);
+  target.draw(sprite, sf::RenderStates{kCompositeBlendMode});
+}
+
+/////////////////////////////////////////////////
+void UIRenderCache::Invalidate() { m_valid = false; }
+
+/////////////////////////////////////////////////
+size_t UIRenderCache::GetRedrawCount() const { return m_redraw_count; }
+
+} // namespace steamrot
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the UIRenderCache class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIBatch.h"
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <cstddef>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class UIRenderCache
+/// @brief An offscreen copy of a UIBatch, composited as a single quad.
+///
+/// The batch is only drawn into the cache again when its last Update changed
+/// something: a hover, a parent's children_active, a label or the layout.
+/// Otherwise drawing the tree costs one textured quad. The cache is drawn
+/// with premultiplied alpha so translucent colors composite as if the batch
+/// had been drawn directly.
+/////////////////////////////////////////////////
+class UIRenderCache {
+private:
+  /////////////////////////////////////////////////
+  /// @brief Offscreen copy of the batch, only ever grown
+  /////////////////////////////////////////////////
+  sf::RenderTexture m_texture;
+
+  /////////////////////////////////////////////////
+  /// @brief Area of the target the cache covers, in pixel aligned coordinates
+  /////////////////////////////////////////////////
+  sf::FloatRect m_area;
+
+  /////////////////////////////////////////////////
+  /// @brief Whether m_texture holds the batch as it was last updated
+  /////////////////////////////////////////////////
+  bool m_valid{false};
+
+  /////////////////////////////////////////////////
+  /// @brief Number of times the batch has been drawn into the cache
+  /////////////////////////////////////////////////
+  size_t m_redraw_count{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Draw the batch into m_texture
+  ///
+  /// @param batch Batch to copy
+  /// @return False if the texture could not be made large enough
+  /////////////////////////////////////////////////
+  bool Redraw(const UIBatch &batch);
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Blend mode that leaves premultiplied colors in the cache
+  /////////////////////////////////////////////////
+  static const sf::BlendMode kCacheBlendMode;
+
+  /////////////////////////////////////////////////
+  /// @brief Blend mode that composites the premultiplied cache
+  /////////////////////////////////////////////////
+  static const sf::BlendMode kCompositeBlendMode;
+
+  /////////////////////////////////////////////////
+  /// @brief Draw the batch from the cache, updating the cache first if the
+  /// batch changed
+  ///
+  /// Falls back to drawing the batch directly if the cache cannot be sized.
+  ///
+  /// @param target Target to draw to
+  /// @param batch Batch updated for this frame
+  /////////////////////////////////////////////////
+  void Draw(sf::RenderTarget &target, const UIBatch &batch);
+
+  /////////////////////////////////////////////////
+  /// @brief Force the next Draw to redraw the cache
+  /////////////////////////////////////////////////
+  void Invalidate();
+
+  /////////////////////////////////////////////////
+  /// @brief Number of times the batch has been drawn into the cache
+  /////////////////////////////////////////////////
+  size_t GetRedrawCount() const;
+};
+} // namespace steamrot
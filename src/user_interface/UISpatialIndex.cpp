@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the UISpatialIndex class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UISpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @brief Whether every ancestor of an element shows its children
+/////////////////////////////////////////////////
+static bool IsVisible(const UIElement &element) {
+  for (const UIElement *ancestor = element.parent; ancestor;
+       ancestor = ancestor->parent) {
+    if (!ancestor->children_active) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+sf::Vector2u UISpatialIndex::GetCell(const sf::Vector2f &point) const {
+  const sf::Vector2f offset = point - m_grid_area.position;
+  const auto column = static_cast<unsigned int>(
+      std::max(0.f, std::floor(offset.x / m_cell_size.x)));
+  const auto row = static_cast<unsigned int>(
+      std::max(0.f, std::floor(offset.y / m_cell_size.y)));
+  return {std::min(column, m_cell_counts.x - 1),
+          std::min(row, m_cell_counts.y - 1)};
+}
+
+/////////////////////////////////////////////////
+void UISpatialIndex::BuildGrid() {
+  // cells keep their capacity, so rebuilding a similar tree does not allocate
+  for (auto &cell : m_cells) {
+    cell.clear();
+  }
+
+  // only elements with an area can be hit
+  bool has_area{false};
+  sf::Vector2f top_left;
+  sf::Vector2f bottom_right;
+  for (const sf::FloatRect &bounds : m_bounds) {
+    if (bounds.size.x <= 0.f || bounds.size.y <= 0.f) {
+      continue;
+    }
+    const sf::Vector2f end = bounds.position + bounds.size;
+    if (!has_area) {
+      top_left = bounds.position;
+      bottom_right = end;
+      has_area = true;
+      continue;
+    }
+    top_left = {std::min(top_left.x, bounds.position.x),
+                std::min(top_left.y, bounds.position.y)};
+    bottom_right = {std::max(bottom_right.x, end.x),
+                    std::max(bottom_right.y, end.y)};
+  }
+  if (!has_area) {
+    m_grid_area = {};
+    m_cell_counts = {0, 0};
+    return;
+  }
+
+  m_grid_area = {top_left, bottom_right - top_left};
+  m_cell_counts = {
+      std::clamp(static_cast<unsigned int>(
+                     std::ceil(m_grid_area.size.x / kTargetCellSize)),
+                 1u, kMaxCellsPerAxis),
+      std::clamp(static_cast<unsigned int>(
+                     std::ceil(m_grid_area.size.y / kTargetCellSize)),
+                 1u, kMaxCellsPerAxis)};
+  m_cell_size = {m_grid_area.size.x / static_cast<float>(m_cell_counts.x),
+                 m_grid_area.size.y / static_cast<float>(m_cell_counts.y)};
+  m_cells.resize(static_cast<size_t>(m_cell_counts.x) * m_cell_counts.y);
+
+  // pushed in draw order, so each cell is too
+  for (size_t i = 0; i < m_bounds.size(); i++) {
+    const sf::FloatRect &bounds = m_bounds[i];
+    if (bounds.size.x <= 0.f || bounds.size.y <= 0.f) {
+      continue;
+    }
+    const sf::Vector2u first = GetCell(bounds.position);
+    const sf::Vector2u last = GetCell(bounds.position + bounds.size);
+    for (unsigned int row = first.y; row <= last.y; row++) {
+      for (unsigned int column = first.x; column <= last.x; column++) {
+        m_cells[row * m_cell_counts.x + column].push_back(
+            static_cast<uint32_t>(i));
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+bool UISpatialIndex::Update(const std::vector<UIElement *> &root_elements) {
+  m_visited_roots.clear();
+  for (const UIElement *root : root_elements) {
+    m_visited_roots.push_back({root, root->layout_generation});
+  }
+
+  // no tree has been laid out, added or removed
+  if (m_visited_roots == m_roots) {
+    return false;
+  }
+  m_roots = m_visited_roots;
+
+  // the same order UIBatch draws in
+  m_visited.clear();
+  for (UIElement *root : root_elements) {
+    VisitUIElementsByDepth(*root, m_visited);
+  }
+
+  m_elements.clear();
+  m_bounds.clear();
+  for (const DrawOrderedUIElement<UIElement> &visited : m_visited) {
+    m_elements.push_back(visited.element);
+    m_bounds.push_back({visited.element->position, visited.element->size});
+  }
+  BuildGrid();
+  return true;
+}
+
+/////////////////////////////////////////////////
+UIElement *UISpatialIndex::FindTopmostElementAt(
+    const sf::Vector2f &point) const {
+  m_candidate_count = 0;
+
+  if (m_cell_counts.x == 0 || !m_grid_area.contains(point)) {
+    return nullptr;
+  }
+
+  const sf::Vector2u cell = GetCell(point);
+  const auto &candidates = m_cells[cell.y * m_cell_counts.x + cell.x];
+
+  // last drawn first
+  for (auto it = candidates.rbegin(); it != candidates.rend(); ++it) {
+    m_candidate_count++;
+    UIElement *element = m_elements[*it];
+    if (m_bounds[*it].contains(point) && IsVisible(*element)) {
+      return element;
+    }
+  }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////
+const std::vector<UIElement *> &UISpatialIndex::GetElements() const {
+  return m_elements;
+}
+
+/////////////////////////////////////////////////
+size_t UISpatialIndex::GetCandidateCount() const { return m_candidate_count; }
+
+} // namespace steamrot
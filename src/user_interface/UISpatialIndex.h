@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the UISpatialIndex class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIElement.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace steamrot {
+
+/////////////////////////////////////////////////
+/// @class UISpatialIndex
+/// @brief Uniform grid over the laid out bounds of several UIElement trees.
+///
+/// Elements are stored in draw order, trees in the order given and each tree
+/// a depth at a time as UIBatch draws it, so the last element in a cell that
+/// contains a point is the topmost one. The grid is only rebuilt when a root's
+/// layout_generation changes or the set of roots does. Visibility
+/// (children_active) is checked when querying, so showing or hiding children
+/// needs no rebuild.
+/////////////////////////////////////////////////
+class UISpatialIndex {
+private:
+  /////////////////////////////////////////////////
+  /// @brief A root element and the layout it was indexed at
+  /////////////////////////////////////////////////
+  struct IndexedRoot {
+    const UIElement *root;
+    uint64_t layout_generation;
+
+    bool operator==(const IndexedRoot &other) const = default;
+  };
+
+  /////////////////////////////////////////////////
+  /// @brief Preferred width and height of a cell in pixels
+  /////////////////////////////////////////////////
+  static constexpr float kTargetCellSize{64.f};
+
+  /////////////////////////////////////////////////
+  /// @brief Upper limit on cells along each axis, cells grow past that
+  /////////////////////////////////////////////////
+  static constexpr unsigned int kMaxCellsPerAxis{64};
+
+  /////////////////////////////////////////////////
+  /// @brief Every element of every tree, in draw order
+  /////////////////////////////////////////////////
+  std::vector<UIElement *> m_elements;
+
+  /////////////////////////////////////////////////
+  /// @brief Elements visited by the last rebuild, reused between rebuilds
+  /////////////////////////////////////////////////
+  std::vector<DrawOrderedUIElement<UIElement>> m_visited;
+
+  /////////////////////////////////////////////////
+  /// @brief Bounds of each element in m_elements when it was indexed
+  /////////////////////////////////////////////////
+  std::vector<sf::FloatRect> m_bounds;
+
+  /////////////////////////////////////////////////
+  /// @brief Roots the grid was built from
+  /////////////////////////////////////////////////
+  std::vector<IndexedRoot> m_roots;
+
+  /////////////////////////////////////////////////
+  /// @brief Roots passed to the last Update, reused between frames
+  /////////////////////////////////////////////////
+  std::vector<IndexedRoot> m_visited_roots;
+
+  /////////////////////////////////////////////////
+  /// @brief Area covered by the grid
+  /////////////////////////////////////////////////
+  sf::FloatRect m_grid_area;
+
+  /////////////////////////////////////////////////
+  /// @brief Size of a single cell
+  /////////////////////////////////////////////////
+  sf::Vector2f m_cell_size;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of cells along each axis
+  /////////////////////////////////////////////////
+  sf::Vector2u m_cell_counts;
+
+  /////////////////////////////////////////////////
+  /// @brief Indices into m_elements overlapping each cell, row by row
+  /////////////////////////////////////////////////
+  std::vector<std::vector<uint32_t>> m_cells;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of elements the last query tested
+  /////////////////////////////////////////////////
+  mutable size_t m_candidate_count{0};
+
+  /////////////////////////////////////////////////
+  /// @brief Size the grid to the indexed elements and fill its cells
+  /////////////////////////////////////////////////
+  void BuildGrid();
+
+  /////////////////////////////////////////////////
+  /// @brief Cell containing a point, clamped to the grid
+  ///
+  /// @param point Point inside m_grid_area
+  /////////////////////////////////////////////////
+  sf::Vector2u GetCell(const sf::Vector2f &point) const;
+
+public:
+  /////////////////////////////////////////////////
+  /// @brief Rebuild the grid if any tree has been laid out since the last call
+  ///
+  /// @param root_elements Roots of every tree, in the order they are drawn
+  /// @return True if the grid was rebuilt, pointers from before are stale
+  /////////////////////////////////////////////////
+  bool Update(const std::vector<UIElement *> &root_elements);
+
+  /////////////////////////////////////////////////
+  /// @brief Find the topmost visible element containing a point
+  ///
+  /// Only the elements overlapping the point's cell are tested, starting with
+  /// the last drawn.
+  ///
+  /// @param point Point in window coordinates
+  /// @return Null if no visible element contains the point
+  /////////////////////////////////////////////////
+  UIElement *FindTopmostElementAt(const sf::Vector2f &point) const;
+
+  /////////////////////////////////////////////////
+  /// @brief Every indexed element, in draw order
+  /////////////////////////////////////////////////
+  const std::vector<UIElement *> &GetElements() const;
+
+  /////////////////////////////////////////////////
+  /// @brief Number of elements the last FindTopmostElementAt tested
+  /////////////////////////////////////////////////
+  size_t GetCandidateCount() const;
+};
+} // namespace steamrot
@@ -7,13 +7,12 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "draw_ui_elements.h"
-#include "DropDownContainerElement.h"
-#include "user_interface_generated.h"
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/System/Angle.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <array>
 #include <cstdint>
 
 namespace steamrot {
@@ -24,9 +23,6 @@ void DrawNestedUIElements(sf::RenderTexture &texture, const UIElement &element,
   // draw the parent element first
   element.DrawUIElement(texture, style);
 
-  // update the size and position of the child elements
-  UpdateSizeAndPositionOfChildElements(element, style);
-
   // if children are active, draw them
   if (element.children_active) {
     for (const auto &child : element.child_elements) {
@@ -35,37 +31,87 @@ void DrawNestedUIElements(sf::RenderTexture &texture, const UIElement &element,
   }
 }
 
+/////////////////////////////////////////////////
+void WriteQuad(sf::Vertex *vertices, const sf::FloatRect &rect,
+               const sf::Color &color) {
+  const sf::Vector2f top_left = rect.position;
+  const sf::Vector2f top_right{rect.position.x + rect.size.x, rect.position.y};
+  const sf::Vector2f bottom_left{rect.position.x,
+                                 rect.position.y + rect.size.y};
+  const sf::Vector2f bottom_right = rect.position + rect.size;
+
+  vertices[0] = sf::Vertex{top_left, color};
+  vertices[1] = sf::Vertex{top_right, color};
+  vertices[2] = sf::Vertex{bottom_left, color};
+  vertices[3] = sf::Vertex{bottom_left, color};
+  vertices[4] = sf::Vertex{top_right, color};
+  vertices[5] = sf::Vertex{bottom_right, color};
+}
+
+/////////////////////////////////////////////////
+/// @brief Write the background and an inward border, filled with the given
+/// background color
+/////////////////////////////////////////////////
+static void WriteBorderAndBackground(sf::Vertex *vertices,
+                                     const UIElement &element,
+                                     const Style &style,
+                                     const sf::Color &background_color) {
+  const sf::Vector2f &position = element.position;
+  const sf::Vector2f &size = element.size;
+  const float thickness = style.border_thickness;
+
+  // the background covers the whole element, the border is drawn over it
+  WriteQuad(vertices, {position, size}, background_color);
+
+  // top and bottom run the full width, left and right fill the gap between
+  WriteQuad(vertices + 6, {position, {size.x, thickness}}, style.border_color);
+  WriteQuad(vertices + 12,
+            {{position.x, position.y + size.y - thickness}, {size.x, thickness}},
+            style.border_color);
+  WriteQuad(vertices + 18,
+            {{position.x, position.y + thickness},
+             {thickness, size.y - 2 * thickness}},
+            style.border_color);
+  WriteQuad(vertices + 24,
+            {{position.x + size.x - thickness, position.y + thickness},
+             {thickness, size.y - 2 * thickness}},
+            style.border_color);
+}
+
+/////////////////////////////////////////////////
+void WriteBorderAndBackground(sf::Vertex *vertices, const UIElement &element,
+                              const Style &style) {
+  WriteBorderAndBackground(vertices, element, style, style.background_color);
+}
+
+/////////////////////////////////////////////////
+void WriteBorderAndBackground(sf::Vertex *vertices, const UIElement &element,
+                              const ButtonStyle &style) {
+  // Change color if hovered
+  WriteBorderAndBackground(vertices, element, style,
+                           element.is_mouse_over ? style.hover_color
+                                                 : style.background_color);
+}
+
 /////////////////////////////////////////////////
 void DrawBorderAndBackground(sf::RenderTexture &texture,
                              const UIElement &element, const Style &style) {
-
-  // Create the rectangle using the element's position and size
-  sf::RectangleShape rectangle(element.size);
-  rectangle.setPosition(element.position);
-  rectangle.setFillColor(style.background_color);
-  rectangle.setOutlineColor(style.border_color);
-  // Border thickness is negative to draw inwards
-  rectangle.setOutlineThickness(-style.border_thickness);
-  // Draw the rectangle on the texture
-  texture.draw(rectangle);
+  std::array<sf::Vertex, kBorderAndBackgroundVertexCount> vertices;
+  WriteBorderAndBackground(vertices.data(), element, style);
+  texture.draw(vertices.data(), vertices.size(),
+               sf::PrimitiveType::Triangles);
 }
 
 /////////////////////////////////////////////////
 void DrawBorderAndBackground(sf::RenderTexture &texture,
                              const UIElement &element,
                              const ButtonStyle &style) {
-  // Create the rectangle using the element's position and size
-  sf::RectangleShape rectangle(element.size);
-  rectangle.setPosition(element.position);
-  // Change color if hovered
-  element.is_mouse_over ? rectangle.setFillColor(style.hover_color)
-                        : rectangle.setFillColor(style.background_color);
-  rectangle.setOutlineColor(style.border_color);
-  // Border thickness is negative to draw inwards
-  rectangle.setOutlineThickness(-style.border_thickness);
-  // Draw the rectangle on the texture
-  texture.draw(rectangle);
+  std::array<sf::Vertex, kBorderAndBackgroundVertexCount> vertices;
+  WriteBorderAndBackground(vertices.data(), element, style);
+  texture.draw(vertices.data(), vertices.size(),
+               sf::PrimitiveType::Triangles);
 }
+
 /////////////////////////////////////////////////
 void DrawText(sf::RenderTexture &texture, const std::string &text,
               const sf::Vector2f &position, const sf::Vector2f size,
@@ -88,153 +134,5 @@ void DrawText(sf::RenderTexture &texture, const std::string &text,
   texture.draw(text_object);
 }
 
-/////////////////////////////////////////////////
-void UpdateSizeAndPositionOfChildElements(const UIElement &element,
-                                          const UIStyle &style) {
-
-  // guard clause for no children
-  if (element.child_elements.empty()) {
-    return;
-  }
-  // handle DropDownContainer Children
-  if (dynamic_cast<const DropDownContainerElement *>(&element)) {
-    // static cast for speed, only safe because of the above check
-    auto dd_container = static_cast<const DropDownContainerElement *>(&element);
-
-    // pull out ratio
-    float ratio = style.drop_down_container_style.drop_symbol_ratio;
-
-    // ignore Inner margines for dropdown container children
-    float available_width =
-        element.size.x - 2 * style.drop_down_container_style.border_thickness;
-    float available_height =
-        element.size.y - 2 * style.drop_down_container_style.border_thickness;
-
-    sf::Vector2f available_size{available_width, available_height};
-
-    // calculate the start position for the dropdown list
-    sf::Vector2f dd_list_position{
-        element.position.x + style.drop_down_container_style.border_thickness,
-        element.position.y + style.drop_down_container_style.border_thickness};
-
-    // calculate the size of the dropdown list
-    sf::Vector2f dd_list_size{available_size.x * (1 - ratio), available_size.y};
-
-    // set the size and position of the dropdown list child
-    if (!dd_container->child_elements.empty()) {
-      dd_container->child_elements[0]->size = dd_list_size;
-      dd_container->child_elements[0]->position = dd_list_position;
-    }
-
-    // calculate the start position for the dropdown button
-    sf::Vector2f dd_button_position{dd_list_position.x + dd_list_size.x,
-                                    dd_list_position.y};
-
-    // calculate the size of the dropdown button
-    sf::Vector2f dd_button_size{available_size.x * ratio, available_size.y};
-    // set the size and position of the dropdown button child
-    if (dd_container->child_elements.size() > 1) {
-      dd_container->child_elements[1]->size = dd_button_size;
-      dd_container->child_elements[1]->position = dd_button_position;
-    }
-    return;
-  }
-
-  // add generic handling for any UIElement with children
-  switch (element.layout) {
-  case LayoutType_Vertical: {
-    // calculate the available size for the children
-    float available_width = element.size.x -
-                            2 * style.panel_style.border_thickness -
-                            2 * style.panel_style.inner_margin.x;
-    float available_height = element.size.y -
-                             2 * style.panel_style.border_thickness -
-                             2 * style.panel_style.inner_margin.y;
-    sf::Vector2f available_size{available_width, available_height};
-    // calculate the start position for the children
-    sf::Vector2f start_position{
-        element.position.x + style.panel_style.border_thickness +
-            style.panel_style.inner_margin.x,
-        element.position.y + style.panel_style.border_thickness +
-            style.panel_style.inner_margin.y};
-
-    // calculate the height of each child based on the number of children, add
-    // in the inner margin as spacing
-    float child_height =
-        (available_size.y - (element.child_elements.size() - 1) *
-                                style.panel_style.inner_margin.y) /
-        static_cast<float>(element.child_elements.size());
-    // set the size and position of each child
-    for (size_t i = 0; i < element.child_elements.size(); i++) {
-      element.child_elements[i]->size.x = available_size.x;
-      element.child_elements[i]->size.y = child_height;
-      element.child_elements[i]->position = sf::Vector2f{
-          start_position.x,
-          start_position.y +
-              i * (child_height + style.panel_style.inner_margin.y)};
-    }
-    break;
-  }
-  case LayoutType_Horizontal: {
-    // calculate the available size for the children
-    float available_width = element.size.x -
-                            2 * style.panel_style.border_thickness -
-                            2 * style.panel_style.inner_margin.x;
-    float available_height = element.size.y -
-                             2 * style.panel_style.border_thickness -
-                             2 * style.panel_style.inner_margin.y;
-    sf::Vector2f available_size{available_width, available_height};
-    // calculate the start position for the children
-    sf::Vector2f start_position{
-        element.position.x + style.panel_style.border_thickness +
-            style.panel_style.inner_margin.x,
-        element.position.y + style.panel_style.border_thickness +
-            style.panel_style.inner_margin.y};
-    // calculate the width of each child based on the number of children, add
-    // in the inner margin as spacing
-    float child_width =
-        (available_size.x - (element.child_elements.size() - 1) *
-                                style.panel_style.inner_margin.x) /
-        static_cast<float>(element.child_elements.size());
-    // set the size and position of each child
-    for (size_t i = 0; i < element.child_elements.size(); i++) {
-      element.child_elements[i]->size.x = child_width;
-      element.child_elements[i]->size.y = available_size.y;
-      element.child_elements[i]->position =
-          sf::Vector2f{start_position.x +
-                           i * (child_width + style.panel_style.inner_margin.x),
-                       start_position.y};
-    }
-    break;
-  }
-  case LayoutType_DropDown: {
-    // for a dropdown, they are ordered vertically, inner margins are ignored
-    // and the avaiable space is a multiple of the parent inner size (e.g the
-    // more children the more space they take up)
-    float available_width =
-        element.size.x - 2 * style.panel_style.border_thickness;
-    float available_height =
-        element.size.y - 2 * style.panel_style.border_thickness;
-    sf::Vector2f available_size{available_width, available_height};
-    // calculate the start position for the children
-    sf::Vector2f start_position{
-        element.position.x + style.panel_style.border_thickness,
-        element.position.y + style.panel_style.border_thickness};
-    // set the size and position of each child
-    for (size_t i = 0; i < element.child_elements.size(); i++) {
-      element.child_elements[i]->size.x = available_size.x;
-      element.child_elements[i]->size.y = available_size.y;
-      element.child_elements[i]->position = sf::Vector2f{
-          start_position.x, start_position.y + i * available_size.y};
-    }
-    break;
-  }
-
-  default: {
-    // for unsupported layout types, do nothing
-    break;
-  }
-  }
-}
 } // namespace draw_ui_elements
 } // namespace steamrot
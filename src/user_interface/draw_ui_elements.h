@@ -15,8 +15,11 @@
 #include "ButtonStyle.h"
 #include "UIElement.h"
 #include "UIStyle.h"
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <sys/types.h>
@@ -27,6 +30,9 @@ namespace draw_ui_elements {
 /////////////////////////////////////////////////
 /// @brief Draw nested UI elements recursively to a render texture
 ///
+/// Only reads the geometry of each element, run ui_layout::LayOutUIElements
+/// on the tree first.
+///
 /// @param texture Render texture to draw to
 /// @param element Element to draw
 /// @param style Style to use for drawing
@@ -34,6 +40,44 @@ namespace draw_ui_elements {
 void DrawNestedUIElements(sf::RenderTexture &texture, const UIElement &element,
                           const UIStyle &style);
 
+/////////////////////////////////////////////////
+/// @brief Vertices written by WriteBorderAndBackground, one quad for the
+/// background and one for each side of the border
+/////////////////////////////////////////////////
+constexpr size_t kBorderAndBackgroundVertexCount = 30;
+
+/////////////////////////////////////////////////
+/// @brief Write a filled rectangle as two triangles, 6 vertices
+///
+/// @param vertices First of the vertices to write
+/// @param rect Rectangle to fill
+/// @param color Fill color
+/////////////////////////////////////////////////
+void WriteQuad(sf::Vertex *vertices, const sf::FloatRect &rect,
+               const sf::Color &color);
+
+/////////////////////////////////////////////////
+/// @brief Write the border and background of a general UI element as
+/// triangles
+///
+/// @param vertices First of kBorderAndBackgroundVertexCount vertices to write
+/// @param element Element to write
+/// @param style Style to use for drawing
+/////////////////////////////////////////////////
+void WriteBorderAndBackground(sf::Vertex *vertices, const UIElement &element,
+                              const Style &style);
+
+/////////////////////////////////////////////////
+/// @brief Write the border and background of a button UI element as
+/// triangles, using the hover color when the mouse is over it
+///
+/// @param vertices First of kBorderAndBackgroundVertexCount vertices to write
+/// @param element Element to write
+/// @param style ButtonStyle to use for drawing
+/////////////////////////////////////////////////
+void WriteBorderAndBackground(sf::Vertex *vertices, const UIElement &element,
+                              const ButtonStyle &style);
+
 /////////////////////////////////////////////////
 /// @brief Draw the border and background of a general UI element
 ///
@@ -60,8 +104,5 @@ void DrawText(sf::RenderTexture &texture, const std::string &text,
               std::shared_ptr<const sf::Font> font, uint8_t font_size,
               const sf::Color &color);
 
-void UpdateSizeAndPositionOfChildElements(const UIElement &element,
-                                          const UIStyle &style);
-
 } // namespace draw_ui_elements
 } // namespace steamrot
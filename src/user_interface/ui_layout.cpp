@@ -0,0 +1,234 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Implementation of the UI layout pass
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ui_layout.h"
+#include "DropDownContainerElement.h"
+#include "user_interface_generated.h"
+#include <SFML/System/Vector2.hpp>
+
+namespace steamrot {
+namespace ui_layout {
+
+/////////////////////////////////////////////////
+/// @brief Flag an element and everything below it for layout
+///
+/// @param element Top of the subtree to flag
+/////////////////////////////////////////////////
+static void MarkSubtreeLayoutDirty(UIElement &element) {
+  element.layout_dirty = true;
+  element.descendant_layout_dirty = true;
+  for (auto &child : element.child_elements) {
+    MarkSubtreeLayoutDirty(*child);
+  }
+}
+
+/////////////////////////////////////////////////
+/// @brief Lay out the children of every dirty element below element
+///
+/// @param element Element to lay out
+/// @param style Style to lay out with
+/////////////////////////////////////////////////
+static void LayOutNestedUIElements(UIElement &element, const UIStyle &style) {
+
+  if (element.layout_dirty) {
+    element.layout_dirty = false;
+
+    // children pushed straight into the vector have no parent yet
+    for (auto &child : element.child_elements) {
+      child->parent = &element;
+    }
+    UpdateSizeAndPositionOfChildElements(element, style);
+
+    // new children start dirty even if they landed where they were
+    element.descendant_layout_dirty = true;
+  }
+
+  if (!element.descendant_layout_dirty) {
+    return;
+  }
+
+  for (auto &child : element.child_elements) {
+    if (child->layout_dirty || child->descendant_layout_dirty) {
+      LayOutNestedUIElements(*child, style);
+    }
+  }
+
+  // cleared last, so a child marked dirty above stops propagating here
+  element.descendant_layout_dirty = false;
+}
+
+/////////////////////////////////////////////////
+void LayOutUIElements(UIElement &root_element, const UIStyle &style) {
+
+  // margins and borders come from the style, so a new one moves everything
+  if (root_element.layout_style != &style) {
+    MarkSubtreeLayoutDirty(root_element);
+    root_element.layout_style = &style;
+  }
+
+  // nothing has changed since the last pass
+  if (!root_element.layout_dirty && !root_element.descendant_layout_dirty) {
+    return;
+  }
+
+  LayOutNestedUIElements(root_element, style);
+
+  // shared between trees, so a new root allocated where a destroyed one was
+  // never reports that root's generation
+  static uint64_t next_layout_generation{0};
+  root_element.layout_generation = ++next_layout_generation;
+}
+
+/////////////////////////////////////////////////
+void UpdateSizeAndPositionOfChildElements(UIElement &element,
+                                          const UIStyle &style) {
+
+  // guard clause for no children
+  if (element.child_elements.empty()) {
+    return;
+  }
+  // handle DropDownContainer Children, the cast only runs when the element is
+  // dirty
+  if (dynamic_cast<DropDownContainerElement *>(&element)) {
+    // static cast for speed, only safe because of the above check
+    auto dd_container = static_cast<DropDownContainerElement *>(&element);
+
+    // pull out ratio
+    float ratio = style.drop_down_container_style.drop_symbol_ratio;
+
+    // ignore Inner margines for dropdown container children
+    float available_width =
+        element.size.x - 2 * style.drop_down_container_style.border_thickness;
+    float available_height =
+        element.size.y - 2 * style.drop_down_container_style.border_thickness;
+
+    sf::Vector2f available_size{available_width, available_height};
+
+    // calculate the start position for the dropdown list
+    sf::Vector2f dd_list_position{
+        element.position.x + style.drop_down_container_style.border_thickness,
+        element.position.y + style.drop_down_container_style.border_thickness};
+
+    // calculate the size of the dropdown list
+    sf::Vector2f dd_list_size{available_size.x * (1 - ratio), available_size.y};
+
+    // set the size and position of the dropdown list child
+    if (!dd_container->child_elements.empty()) {
+      dd_container->child_elements[0]->SetSize(dd_list_size);
+      dd_container->child_elements[0]->SetPosition(dd_list_position);
+    }
+
+    // calculate the start position for the dropdown button
+    sf::Vector2f dd_button_position{dd_list_position.x + dd_list_size.x,
+                                    dd_list_position.y};
+
+    // calculate the size of the dropdown button
+    sf::Vector2f dd_button_size{available_size.x * ratio, available_size.y};
+    // set the size and position of the dropdown button child
+    if (dd_container->child_elements.size() > 1) {
+      dd_container->child_elements[1]->SetSize(dd_button_size);
+      dd_container->child_elements[1]->SetPosition(dd_button_position);
+    }
+    return;
+  }
+
+  // add generic handling for any UIElement with children
+  switch (element.layout) {
+  case LayoutType_Vertical: {
+    // calculate the available size for the children
+    float available_width = element.size.x -
+                            2 * style.panel_style.border_thickness -
+                            2 * style.panel_style.inner_margin.x;
+    float available_height = element.size.y -
+                             2 * style.panel_style.border_thickness -
+                             2 * style.panel_style.inner_margin.y;
+    sf::Vector2f available_size{available_width, available_height};
+    // calculate the start position for the children
+    sf::Vector2f start_position{
+        element.position.x + style.panel_style.border_thickness +
+            style.panel_style.inner_margin.x,
+        element.position.y + style.panel_style.border_thickness +
+            style.panel_style.inner_margin.y};
+
+    // calculate the height of each child based on the number of children, add
+    // in the inner margin as spacing
+    float child_height =
+        (available_size.y - (element.child_elements.size() - 1) *
+                                style.panel_style.inner_margin.y) /
+        static_cast<float>(element.child_elements.size());
+    // set the size and position of each child
+    for (size_t i = 0; i < element.child_elements.size(); i++) {
+      element.child_elements[i]->SetSize({available_size.x, child_height});
+      element.child_elements[i]->SetPosition(sf::Vector2f{
+          start_position.x,
+          start_position.y +
+              i * (child_height + style.panel_style.inner_margin.y)});
+    }
+    break;
+  }
+  case LayoutType_Horizontal: {
+    // calculate the available size for the children
+    float available_width = element.size.x -
+                            2 * style.panel_style.border_thickness -
+                            2 * style.panel_style.inner_margin.x;
+    float available_height = element.size.y -
+                             2 * style.panel_style.border_thickness -
+                             2 * style.panel_style.inner_margin.y;
+    sf::Vector2f available_size{available_width, available_height};
+    // calculate the start position for the children
+    sf::Vector2f start_position{
+        element.position.x + style.panel_style.border_thickness +
+            style.panel_style.inner_margin.x,
+        element.position.y + style.panel_style.border_thickness +
+            style.panel_style.inner_margin.y};
+    // calculate the width of each child based on the number of children, add
+    // in the inner margin as spacing
+    float child_width =
+        (available_size.x - (element.child_elements.size() - 1) *
+                                style.panel_style.inner_margin.x) /
+        static_cast<float>(element.child_elements.size());
+    // set the size and position of each child
+    for (size_t i = 0; i < element.child_elements.size(); i++) {
+      element.child_elements[i]->SetSize({child_width, available_size.y});
+      element.child_elements[i]->SetPosition(
+          sf::Vector2f{start_position.x +
+                           i * (child_width + style.panel_style.inner_margin.x),
+                       start_position.y});
+    }
+    break;
+  }
+  case LayoutType_DropDown: {
+    // for a dropdown, they are ordered vertically, inner margins are ignored
+    // and the avaiable space is a multiple of the parent inner size (e.g the
+    // more children the more space they take up)
+    float available_width =
+        element.size.x - 2 * style.panel_style.border_thickness;
+    float available_height =
+        element.size.y - 2 * style.panel_style.border_thickness;
+    sf::Vector2f available_size{available_width, available_height};
+    // calculate the start position for the children
+    sf::Vector2f start_position{
+        element.position.x + style.panel_style.border_thickness,
+        element.position.y + style.panel_style.border_thickness};
+    // set the size and position of each child
+    for (size_t i = 0; i < element.child_elements.size(); i++) {
+      element.child_elements[i]->SetSize(available_size);
+      element.child_elements[i]->SetPosition(sf::Vector2f{
+          start_position.x, start_position.y + i * available_size.y});
+    }
+    break;
+  }
+
+  default: {
+    // for unsupported layout types, do nothing
+    break;
+  }
+  }
+}
+} // namespace ui_layout
+} // namespace steamrot
@@ -0,0 +1,43 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Declaration of the ui_layout namespace
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Preprocessor Directives
+/////////////////////////////////////////////////
+#pragma once
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIElement.h"
+#include "UIStyle.h"
+
+namespace steamrot {
+namespace ui_layout {
+
+/////////////////////////////////////////////////
+/// @brief Size and position every element of a UI tree that needs it
+///
+/// Only elements flagged by MarkLayoutDirty (or by changing style) have their
+/// children recomputed, a tree with nothing dirty returns straight away. A
+/// child is flagged in turn only if its size or position actually changed.
+/// A pass that does any work gives the root a new layout_generation.
+///
+/// @param root_element Root of the tree to lay out
+/// @param style Style providing borders and margins
+/////////////////////////////////////////////////
+void LayOutUIElements(UIElement &root_element, const UIStyle &style);
+
+/////////////////////////////////////////////////
+/// @brief Size and position the direct children of an element
+///
+/// @param element Element whose children to update
+/// @param style Style providing borders and margins
+/////////////////////////////////////////////////
+void UpdateSizeAndPositionOfChildElements(UIElement &element,
+                                          const UIStyle &style);
+
+} // namespace ui_layout
+} // namespace steamrot
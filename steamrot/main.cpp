@@ -1,15 +1,97 @@
 #include "GameEngine.h"
+#include "Logger.h"
 #include "PathProvider.h"
+#include "Profiler.h"
+#include "log_channel.h"
 #include "spdlog/spdlog.h"
+#include <filesystem>
 #include <iostream>
-int main() {
-  // start the logger
+#include <string_view>
+int main(int argc, char *argv[]) {
+  // start the logger, it closes its log files when main returns
+  Logger logger("global_logger");
 
   // wrap the whole game engine in a try-catch block to catch any exceptions
   try {
     steamrot::PathProvider path_provider{steamrot::EnvironmentType::Production};
-    steamrot::GameEngine steam_rot(steamrot::EnvironmentType::Production);
-    steam_rot.RunGame();
+    // --headless runs the simulation without opening a window
+    // --trace <path> writes a Chrome trace of the run (profiling builds only)
+    // --record-events <path> writes the session's input on exit
+    // --replay-events <path> replays recorded input headless, as fast as the
+    // ticks run, and exits where the recording ended
+    // --log <spec> sets channel log levels, e.g. events=trace,ui=debug
+    steamrot::DisplayMode display_mode{steamrot::DisplayMode::Windowed};
+    std::filesystem::path trace_path;
+    std::filesystem::path record_events_path;
+    std::filesystem::path replay_events_path;
+    for (int i = 1; i < argc; ++i) {
+      if (std::string_view(argv[i]) == "--headless") {
+        display_mode = steamrot::DisplayMode::Headless;
+      } else if (std::string_view(argv[i]) == "--trace" && i + 1 < argc) {
+        trace_path = argv[++i];
+      } else if (std::string_view(argv[i]) == "--record-events" &&
+                 i + 1 < argc) {
+        record_events_path = argv[++i];
+      } else if (std::string_view(argv[i]) == "--replay-events" &&
+                 i + 1 < argc) {
+        replay_events_path = argv[++i];
+        display_mode = steamrot::DisplayMode::Headless;
+      } else if (std::string_view(argv[i]) == "--log" && i + 1 < argc) {
+        auto log_level_result = steamrot::SetChannelLevels(argv[++i]);
+        if (!log_level_result) {
+          std::cerr << "Invalid --log: " << log_level_result.error().message
+                    << "\n";
+          return 1;
+        }
+      }
+    }
+    steamrot::GameEngine steam_rot(steamrot::EnvironmentType::Production,
+                                   display_mode);
+
+    if (!replay_events_path.empty()) {
+      auto load_replay_result = steam_rot.LoadEventReplay(replay_events_path);
+      if (!load_replay_result) {
+        std::cerr << "Failed to load event replay: "
+                  << load_replay_result.error().message << "\n";
+        return 1;
+      }
+    }
+    if (!record_events_path.empty()) {
+      steam_rot.StartEventRecording();
+    }
+
+#ifdef STEAMROT_PROFILING
+    if (!trace_path.empty()) {
+      steamrot::Profiler::BeginCapture();
+    }
+#endif
+
+    // a replay runs in simulation mode so every run does the same work
+    steam_rot.RunGame(0, !replay_events_path.empty());
+
+    if (!record_events_path.empty()) {
+      auto save_recording_result =
+          steam_rot.SaveEventRecording(record_events_path);
+      if (!save_recording_result) {
+        std::cerr << "Failed to write event recording: "
+                  << save_recording_result.error().message << "\n";
+      }
+    }
+
+#ifdef STEAMROT_PROFILING
+    if (!trace_path.empty()) {
+      steamrot::Profiler::EndCapture();
+      auto write_trace_result = steamrot::Profiler::WriteChromeTrace(trace_path);
+      if (!write_trace_result) {
+        std::cerr << "Failed to write trace: "
+                  << write_trace_result.error().message << "\n";
+      }
+    }
+#else
+    if (!trace_path.empty()) {
+      std::cerr << "--trace needs a build with STEAMROT_ENABLE_PROFILING\n";
+    }
+#endif
 
   } catch (const std::exception &e) {
     // log the exception message
@@ -23,5 +105,6 @@ int main() {
     spdlog::get("global_logger")->error("Unknown exception occurred");
   }
 
+  steamrot::FlushChannelLoggers();
   return 0;
 }
@@ -7,6 +7,7 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "CGrimoireMachina.h"
+#include "containers.h"
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("Configuring a CGrimoireMachina turns it active",
@@ -19,5 +20,6 @@ TEST_CASE("Configuring a CGrimoireMachina turns it active",
   REQUIRE(grimoire.m_all_joints.empty());
   REQUIRE(grimoire.m_machina_forms.empty());
   REQUIRE(grimoire.m_holding_form == nullptr);
-  REQUIRE(grimoire.GetComponentRegisterIndex() == 3);
+  REQUIRE(steamrot::TupleTypeIndex<steamrot::CGrimoireMachina,
+                                  steamrot::ComponentRegister> == 3);
 }
@@ -7,6 +7,7 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "CUIState.h"
+#include "containers.h"
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("CUIState is default constructible and has correct properties",
@@ -18,5 +19,6 @@ TEST_CASE("CUIState is default constructible and has correct properties",
   REQUIRE(ui_state.m_state_to_ui_visibility.empty());
   REQUIRE(ui_state.m_state_values.empty());
   REQUIRE(ui_state.m_state_subscribers.empty());
-  REQUIRE(ui_state.GetComponentRegisterIndex() == 4);
+  REQUIRE(steamrot::TupleTypeIndex<steamrot::CUIState,
+                                  steamrot::ComponentRegister> == 4);
 }
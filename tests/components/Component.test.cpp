@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Layout tests and benchmarks for the Component struct
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "CMachinaForm.h"
+#include "CMeta.h"
+#include "containers.h"
+#include <bitset>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <type_traits>
+#include <vector>
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief Replica of the old virtual Component, kept for comparison
+/////////////////////////////////////////////////
+struct VirtualComponent {
+  virtual ~VirtualComponent() = default;
+  virtual size_t GetComponentRegisterIndex() const = 0;
+  bool m_active{false};
+};
+
+struct VirtualCMeta : public VirtualComponent {
+  bool m_entity_active = false;
+  size_t GetComponentRegisterIndex() const override { return 0; }
+};
+
+struct VirtualCMachinaForm : public VirtualComponent {
+  std::vector<steamrot::Fragment> m_fragments;
+  std::vector<steamrot::Joint> m_joints;
+  size_t GetComponentRegisterIndex() const override { return 2; }
+};
+
+constexpr size_t kBenchmarkPoolSize = 100000;
+
+using BenchmarkArchetypeID = std::bitset<steamrot::kComponentRegisterSize>;
+} // namespace
+
+TEST_CASE("Components in the ComponentRegister carry no vtable",
+          "[Components]") {
+
+  // CMeta is only its flags, no pointer sized vptr
+  REQUIRE(sizeof(steamrot::CMeta) == 2 * sizeof(bool));
+  REQUIRE(sizeof(steamrot::CMeta) < sizeof(VirtualCMeta));
+  REQUIRE(sizeof(steamrot::CMachinaForm) < sizeof(VirtualCMachinaForm));
+
+  REQUIRE(std::is_aggregate_v<steamrot::CMeta>);
+  REQUIRE(std::is_aggregate_v<steamrot::CMachinaForm>);
+  REQUIRE_FALSE(std::is_polymorphic_v<steamrot::CUserInterface>);
+  REQUIRE_FALSE(std::is_polymorphic_v<steamrot::CGrimoireMachina>);
+  REQUIRE_FALSE(std::is_polymorphic_v<steamrot::CUIState>);
+}
+
+TEST_CASE("Benchmark virtual and non-virtual Component pools",
+          "[.][Components][benchmark]") {
+
+  std::vector<VirtualCMeta> virtual_meta(kBenchmarkPoolSize);
+  std::vector<VirtualCMachinaForm> virtual_forms(kBenchmarkPoolSize);
+  std::vector<steamrot::CMeta> meta(kBenchmarkPoolSize);
+  std::vector<steamrot::CMachinaForm> forms(kBenchmarkPoolSize);
+
+  // activate every other entity so the branch cannot be predicted away
+  for (size_t i = 0; i < kBenchmarkPoolSize; i += 2) {
+    virtual_meta[i].m_active = true;
+    virtual_forms[i].m_active = true;
+    meta[i].m_active = true;
+    forms[i].m_active = true;
+  }
+
+  WARN(std::format("pool memory for {} entities (CMeta + CMachinaForm): "
+                   "virtual {} bytes, non-virtual {} bytes",
+                   kBenchmarkPoolSize,
+                   kBenchmarkPoolSize *
+                       (sizeof(VirtualCMeta) + sizeof(VirtualCMachinaForm)),
+                   kBenchmarkPoolSize * (sizeof(steamrot::CMeta) +
+                                         sizeof(steamrot::CMachinaForm))));
+
+  BENCHMARK("archetype IDs through virtual calls") {
+    size_t populated{0};
+    for (size_t i = 0; i < kBenchmarkPoolSize; ++i) {
+      BenchmarkArchetypeID archetype_id{0};
+      archetype_id.set(virtual_meta[i].GetComponentRegisterIndex(),
+                       virtual_meta[i].m_active);
+      archetype_id.set(virtual_forms[i].GetComponentRegisterIndex(),
+                       virtual_forms[i].m_active);
+      populated += archetype_id.any();
+    }
+    return populated;
+  };
+
+  BENCHMARK("archetype IDs through TupleTypeIndex") {
+    size_t populated{0};
+    for (size_t i = 0; i < kBenchmarkPoolSize; ++i) {
+      BenchmarkArchetypeID archetype_id{0};
+      archetype_id.set(
+          steamrot::TupleTypeIndex<steamrot::CMeta, steamrot::ComponentRegister>,
+          meta[i].m_active);
+      archetype_id.set(steamrot::TupleTypeIndex<steamrot::CMachinaForm,
+                                                steamrot::ComponentRegister>,
+                       forms[i].m_active);
+      populated += archetype_id.any();
+    }
+    return populated;
+  };
+}
@@ -7,7 +7,6 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "TestContext.h"
-#include "FlatbuffersConfigurator.h"
 #include "GameContext.h"
 #include "PathProvider.h"
 #include "scene_change_packet_generated.h"
@@ -18,7 +17,7 @@ namespace steamrot::tests {
 /////////////////////////////////////////////////
 TestContext::TestContext(const SceneType scene_type)
     : render_window(sf::VideoMode({900, 600}), "SteamRot Test Window"),
-      event_handler(), archetype_manager(scene_entities) {
+      event_handler(), entity_manager(event_handler) {
 
   // load default assets into the asset manager
   auto load_result = asset_manager.LoadDefaultAssets();
@@ -91,17 +90,16 @@ const LogicContext &TestContext::GetLogicContextForCraftingScene() const {
 void TestContext::ConfigureGameContext() {
   game_context_ptr =
       std::make_unique<GameContext>(render_window, event_handler, loop_number,
-                                    asset_manager, EnvironmentType::Test);
+                                    asset_manager, job_system,
+                                    EnvironmentType::Test);
 }
 
 /////////////////////////////////////////////////
 void TestContext::ConfigureLogicContextForTestScene() {
   // Configure the EntityMemoryPool for the test scene
-  FlatbuffersConfigurator configurator(event_handler);
-
   std::cout << "Configuring entities for Test Scene" << std::endl;
-  auto configure_result = configurator.ConfigureEntitiesFromDefaultData(
-      scene_entities, SceneType::SceneType_TEST);
+  auto configure_result = entity_manager.ConfigureEntitiesFromDefaultData(
+      SceneType::SceneType_TEST, DataType::Flatbuffers);
   std::cout << "Entities configured for Test Scene" << std::endl;
   // check the configuration was successful
   if (!configure_result.has_value()) {
@@ -111,24 +109,25 @@ void TestContext::ConfigureLogicContextForTestScene() {
     std::cerr << "Error configuring entities: " << error.message << std::endl;
   }
   // generate all archetypes for the test scene
-  auto archetype_result = archetype_manager.GenerateAllArchetypes();
+  auto archetype_result = entity_manager.GenerateAllArchetypes();
   if (!archetype_result.has_value()) {
     const FailInfo &error = archetype_result.error();
     std::cerr << "Error generating archetypes: " << error.message << std::endl;
   }
   // create pointer to the logic context for the test scene
   logic_context_for_test_scene = std::make_unique<LogicContext>(
-      LogicContext{scene_entities, archetype_manager.GetArchetypes(),
+      LogicContext{entity_manager.GetEntityMemoryPool(),
+                   entity_manager.GetArchetypeManager(),
                    render_texture, render_window, asset_manager, event_handler,
-                   game_context_ptr->mouse_position});
+                   job_system, game_context_ptr->mouse_position,
+                   game_context_ptr->input_state});
 }
 
 /////////////////////////////////////////////////
 void TestContext::ConfigureLogicContextForTitleScene() {
   // Configure the EntityMemoryPool for the title scene
-  FlatbuffersConfigurator configurator(event_handler);
-  auto configure_result = configurator.ConfigureEntitiesFromDefaultData(
-      scene_entities, SceneType::SceneType_TITLE);
+  auto configure_result = entity_manager.ConfigureEntitiesFromDefaultData(
+      SceneType::SceneType_TITLE, DataType::Flatbuffers);
   // check the configuration was successful
   if (!configure_result.has_value()) {
     // handle the error (for example, log it)
@@ -137,24 +136,25 @@ void TestContext::ConfigureLogicContextForTitleScene() {
     std::cerr << "Error configuring entities: " << error.message << std::endl;
   }
   // generate all archetypes for the title scene
-  auto archetype_result = archetype_manager.GenerateAllArchetypes();
+  auto archetype_result = entity_manager.GenerateAllArchetypes();
   if (!archetype_result.has_value()) {
     const FailInfo &error = archetype_result.error();
     std::cerr << "Error generating archetypes: " << error.message << std::endl;
   }
   // create pointer to the logic context for the title scene
   logic_context_for_title_scene = std::make_unique<LogicContext>(
-      LogicContext{scene_entities, archetype_manager.GetArchetypes(),
+      LogicContext{entity_manager.GetEntityMemoryPool(),
+                   entity_manager.GetArchetypeManager(),
                    render_texture, render_window, asset_manager, event_handler,
-                   game_context_ptr->mouse_position});
+                   job_system, game_context_ptr->mouse_position,
+                   game_context_ptr->input_state});
 }
 
 /////////////////////////////////////////////////
 void TestContext::ConfigureLogicContextForCraftingScene() {
   // Configure the EntityMemoryPool for the crafting scene
-  FlatbuffersConfigurator configurator(event_handler);
-  auto configure_result = configurator.ConfigureEntitiesFromDefaultData(
-      scene_entities, SceneType::SceneType_CRAFTING);
+  auto configure_result = entity_manager.ConfigureEntitiesFromDefaultData(
+      SceneType::SceneType_CRAFTING, DataType::Flatbuffers);
   // check the configuration was successful
   if (!configure_result.has_value()) {
     // handle the error (for example, log it)
@@ -163,15 +163,17 @@ void TestContext::ConfigureLogicContextForCraftingScene() {
     std::cerr << "Error configuring entities: " << error.message << std::endl;
   }
   // generate all archetypes for the crafting scene
-  auto archetype_result = archetype_manager.GenerateAllArchetypes();
+  auto archetype_result = entity_manager.GenerateAllArchetypes();
   if (!archetype_result.has_value()) {
     const FailInfo &error = archetype_result.error();
     std::cerr << "Error generating archetypes: " << error.message << std::endl;
   }
   // create pointer to the logic context for the crafting scene
   logic_context_for_crafting_scene = std::make_unique<LogicContext>(
-      LogicContext{scene_entities, archetype_manager.GetArchetypes(),
+      LogicContext{entity_manager.GetEntityMemoryPool(),
+                   entity_manager.GetArchetypeManager(),
                    render_texture, render_window, asset_manager, event_handler,
-                   game_context_ptr->mouse_position});
+                   job_system, game_context_ptr->mouse_position,
+                   game_context_ptr->input_state});
 }
 } // namespace steamrot::tests
@@ -9,8 +9,10 @@
 #pragma once
 
 #include "ArchetypeManager.h"
+#include "EntityManager.h"
 #include "EventHandler.h"
 #include "GameContext.h"
+#include "JobSystem.h"
 #include "LogicContext.h"
 #include "containers.h"
 #include <SFML/Graphics/RenderTexture.hpp>
@@ -45,6 +47,11 @@ private:
   /////////////////////////////////////////////////
   steamrot::AssetManager asset_manager;
 
+  /////////////////////////////////////////////////
+  /// @brief Instance of the JobSystem used for tests
+  /////////////////////////////////////////////////
+  steamrot::JobSystem job_system;
+
   /////////////////////////////////////////////////
   /// @brief loop number initialized to 0
   /////////////////////////////////////////////////
@@ -56,14 +63,10 @@ private:
   const EnvironmentType env_type{EnvironmentType::Test};
 
   /////////////////////////////////////////////////
-  /// @brief Test EntityMemoryPool instance
-  /////////////////////////////////////////////////
-  EntityMemoryPool scene_entities;
-
-  /////////////////////////////////////////////////
-  /// @brief ArchetypeManager instance for tests
+  /// @brief EntityManager instance for tests, owns the EntityMemoryPool,
+  /// entity signatures and ArchetypeManager
   /////////////////////////////////////////////////
-  ArchetypeManager archetype_manager;
+  EntityManager entity_manager;
 
   /////////////////////////////////////////////////
   /// @brief Test RenderTexture instance
@@ -13,14 +13,15 @@
 #include "configuration_helpers.h"
 #include "containers.h"
 #include "scene_change_packet_generated.h"
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("ArchetypeManager is constructed without errors",
           "[ArchetypeManager]") {
 
-  // create an instance of the EMP to pass to the ArchetypeManager
-  steamrot::EntityMemoryPool emp;
-  steamrot::ArchetypeManager archetype_manager(emp);
+  // create a signature column to pass to the ArchetypeManager
+  std::vector<ArchetypeID> entity_signatures;
+  steamrot::ArchetypeManager archetype_manager(entity_signatures);
   REQUIRE_NOTHROW(archetype_manager);
 }
 
@@ -39,7 +40,7 @@ TEST_CASE("ArchetypeManager archetype map is empty with a non configured EMP",
 
   // create an instance of the ArchetypeManager
   steamrot::ArchetypeManager archetype_manager(
-      entity_manager.GetEntityMemoryPool());
+      entity_manager.GetEntitySignatures());
   // attempt to generate all archetype IDs
   auto generate_result = archetype_manager.GenerateAllArchetypes();
   // check that the result is not an error
@@ -64,7 +65,7 @@ TEST_CASE("ArchetypeManager generates archetype IDs correctly",
       entity_manager.GetEntityMemoryPool());
 
   steamrot::ArchetypeManager archetype_manager(
-      entity_manager.GetEntityMemoryPool());
+      entity_manager.GetEntitySignatures());
 
   // configure the entity memory pool and then generate archetypes
   auto configure_result = entity_manager.ConfigureEntitiesFromDefaultData(
@@ -81,3 +82,72 @@ TEST_CASE("ArchetypeManager generates archetype IDs correctly",
   steamrot::tests::TestArchetypesOfConfiguredEMPfromDefaultData(
       archetypes, steamrot::SceneType_TEST);
 }
+
+TEST_CASE("ArchetypeManager moves a single entity between archetypes",
+          "[ArchetypeManager]") {
+
+  // create a signature column of 10 entities with no components
+  std::vector<ArchetypeID> entity_signatures(10);
+
+  steamrot::ArchetypeManager archetype_manager(entity_signatures);
+  auto generate_result = archetype_manager.GenerateAllArchetypes();
+  if (!generate_result.has_value())
+    FAIL(generate_result.error().message);
+
+  ArchetypeID ui_archetype_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface>();
+
+  // give entity 3 a component and tell the manager what it used to be
+  entity_signatures[3] = ui_archetype_id;
+  auto move_result = archetype_manager.MoveEntity(3, ArchetypeID{0});
+  if (!move_result.has_value())
+    FAIL(move_result.error().message);
+
+  const auto &archetypes = archetype_manager.GetArchetypes();
+  REQUIRE(archetypes.size() == 2);
+  REQUIRE(archetypes.at(0).size() == 9);
+  REQUIRE(archetypes.at(ui_archetype_id) == steamrot::Archetype{3});
+
+  // the swap-remove keeps every remaining entity in the empty archetype
+  for (size_t i = 0; i < 10; ++i) {
+    if (i == 3)
+      continue;
+    REQUIRE(std::ranges::find(archetypes.at(0), i) != archetypes.at(0).end());
+  }
+
+  // moving it back erases the now empty archetype
+  entity_signatures[3].reset();
+  move_result = archetype_manager.MoveEntity(3, ui_archetype_id);
+  if (!move_result.has_value())
+    FAIL(move_result.error().message);
+
+  REQUIRE(archetypes.size() == 1);
+  REQUIRE(archetypes.at(0).size() == 10);
+
+  // out of bounds indexes and wrong previous signatures are reported
+  REQUIRE_FALSE(archetype_manager.MoveEntity(10, ArchetypeID{0}));
+  entity_signatures[4] = ui_archetype_id;
+  REQUIRE_FALSE(archetype_manager.MoveEntity(4, ui_archetype_id.flip()));
+}
+
+TEST_CASE("ArchetypeManager tracks entities appended to the signatures",
+          "[ArchetypeManager]") {
+
+  std::vector<ArchetypeID> entity_signatures(2);
+  steamrot::ArchetypeManager archetype_manager(entity_signatures);
+  auto generate_result = archetype_manager.GenerateAllArchetypes();
+  if (!generate_result.has_value())
+    FAIL(generate_result.error().message);
+
+  ArchetypeID ui_archetype_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface>();
+  entity_signatures.push_back(ui_archetype_id);
+
+  auto track_result = archetype_manager.TrackNewEntities();
+  if (!track_result.has_value())
+    FAIL(track_result.error().message);
+
+  const auto &archetypes = archetype_manager.GetArchetypes();
+  REQUIRE(archetypes.at(0).size() == 2);
+  REQUIRE(archetypes.at(ui_archetype_id) == steamrot::Archetype{2});
+}
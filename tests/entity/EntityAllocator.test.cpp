@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the EntityAllocator class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EntityAllocator.h"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("EntityAllocator hands out the lowest free index first",
+          "[EntityAllocator]") {
+
+  steamrot::EntityAllocator allocator{4};
+  REQUIRE(allocator.GetCapacity() == 4);
+  REQUIRE(allocator.PeekNextFreeIndex() == 0);
+
+  for (size_t i = 0; i < 4; ++i) {
+    steamrot::EntityHandle handle = allocator.Allocate();
+    REQUIRE(handle.index == i);
+    REQUIRE(handle.generation == 0);
+    REQUIRE(allocator.IsValid(handle));
+  }
+
+  // the free-list is empty so the next index is the first after growth
+  REQUIRE(allocator.PeekNextFreeIndex() == 4);
+}
+
+TEST_CASE("EntityAllocator grows when the free-list is exhausted",
+          "[EntityAllocator]") {
+
+  steamrot::EntityAllocator allocator;
+  REQUIRE(allocator.GetCapacity() == 0);
+
+  steamrot::EntityHandle handle = allocator.Allocate();
+  REQUIRE(handle.index == 0);
+  REQUIRE(allocator.GetCapacity() == steamrot::kMinimumEntityCapacity);
+
+  for (size_t i = 1; i <= steamrot::kMinimumEntityCapacity; ++i) {
+    REQUIRE(allocator.Allocate().index == i);
+  }
+  REQUIRE(allocator.GetCapacity() == steamrot::kMinimumEntityCapacity * 2);
+}
+
+TEST_CASE("EntityAllocator detects stale handles", "[EntityAllocator]") {
+
+  steamrot::EntityAllocator allocator{2};
+  steamrot::EntityHandle first = allocator.Allocate();
+  steamrot::EntityHandle second = allocator.Allocate();
+
+  REQUIRE(allocator.Release(first).has_value());
+  REQUIRE_FALSE(allocator.IsValid(first));
+  REQUIRE(allocator.IsValid(second));
+
+  // releasing twice is an error through a handle
+  auto release_result = allocator.Release(first);
+  REQUIRE_FALSE(release_result.has_value());
+  REQUIRE(release_result.error().mode == steamrot::FailMode::StaleHandle);
+
+  // the index is reused with a new generation
+  steamrot::EntityHandle reused = allocator.Allocate();
+  REQUIRE(reused.index == first.index);
+  REQUIRE(reused.generation == first.generation + 1);
+  REQUIRE(allocator.IsValid(reused));
+  REQUIRE_FALSE(allocator.IsValid(first));
+}
+
+TEST_CASE("EntityAllocator rebuilds from CMeta data", "[EntityAllocator]") {
+
+  std::vector<steamrot::CMeta> meta_data(4);
+  meta_data[0].m_entity_active = true;
+  meta_data[2].m_entity_active = true;
+
+  steamrot::EntityAllocator allocator;
+  allocator.Rebuild(meta_data);
+
+  REQUIRE(allocator.GetCapacity() == 4);
+  REQUIRE(allocator.GetHandle(0).has_value());
+  REQUIRE_FALSE(allocator.GetHandle(1).has_value());
+  REQUIRE(allocator.Allocate().index == 1);
+  REQUIRE(allocator.Allocate().index == 3);
+  REQUIRE(allocator.PeekNextFreeIndex() == 4);
+}
@@ -7,9 +7,11 @@
 /// Headers
 /////////////////////////////////////////////////
 #include "EntityManager.h"
+#include "ArchetypeHelpers.h"
 #include "PathProvider.h"
 #include "TestContext.h"
 #include "configuration_helpers.h"
+#include "emp_helpers.h"
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("EntityManager calls configurator with no errors",
@@ -38,3 +40,152 @@ TEST_CASE("EntityManager calls configurator with no errors",
       entity_manager.GetEntityMemoryPool(),
       steamrot::SceneType::SceneType_TEST);
 }
+
+TEST_CASE("EntityManager adds, removes and destroys components incrementally",
+          "[EntityManager]") {
+
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  steamrot::tests::TestContext test_context;
+  steamrot::EntityManager entity_manager{
+      10, test_context.GetGameContext().event_handler};
+
+  auto generate_result = entity_manager.GenerateAllArchetypes();
+  if (!generate_result.has_value())
+    FAIL(generate_result.error().message);
+
+  ArchetypeID ui_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface>();
+  ArchetypeID ui_state_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface,
+                                             steamrot::CUIState>();
+
+  // add a CUserInterface to entity 2
+  steamrot::CUserInterface ui_component;
+  ui_component.m_name = "incremental";
+  auto add_result = entity_manager.AddComponent<steamrot::CUserInterface>(
+      2, std::move(ui_component));
+  if (!add_result.has_value())
+    FAIL(add_result.error().message);
+
+  const auto &pool = entity_manager.GetEntityMemoryPool();
+  const auto &stored =
+      steamrot::emp_helpers::GetComponent<steamrot::CUserInterface>(2, pool);
+  REQUIRE(stored.m_active);
+  REQUIRE(stored.m_name == "incremental");
+
+  const auto &archetypes =
+      entity_manager.GetArchetypeManager().GetArchetypes();
+  REQUIRE(archetypes.at(ui_id) == steamrot::Archetype{2});
+  REQUIRE(entity_manager.GetEntitySignatures()[2] == ui_id);
+
+  // add a second component to the same entity
+  add_result = entity_manager.AddComponent<steamrot::CUIState>(2);
+  if (!add_result.has_value())
+    FAIL(add_result.error().message);
+  REQUIRE(archetypes.at(ui_state_id) == steamrot::Archetype{2});
+  REQUIRE_FALSE(archetypes.contains(ui_id));
+
+  // remove one component
+  auto remove_result = entity_manager.RemoveComponent<steamrot::CUIState>(2);
+  if (!remove_result.has_value())
+    FAIL(remove_result.error().message);
+  REQUIRE(archetypes.at(ui_id) == steamrot::Archetype{2});
+  REQUIRE_FALSE(
+      steamrot::emp_helpers::GetComponent<steamrot::CUIState>(2, pool).m_active);
+
+  // destroy the entity
+  auto destroy_result = entity_manager.DestroyEntity(2);
+  if (!destroy_result.has_value())
+    FAIL(destroy_result.error().message);
+  REQUIRE(archetypes.size() == 1);
+  REQUIRE(archetypes.at(0).size() == 10);
+  REQUIRE(entity_manager.GetEntitySignatures()[2].none());
+  REQUIRE_FALSE(stored.m_active);
+
+  // out of range entity indexes fail
+  REQUIRE_FALSE(entity_manager.DestroyEntity(10));
+}
+
+TEST_CASE("EntityManager creates entities and grows the memory pool",
+          "[EntityManager]") {
+
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  steamrot::tests::TestContext test_context;
+  steamrot::EntityManager entity_manager{
+      2, test_context.GetGameContext().event_handler};
+
+  const auto &pool = entity_manager.GetEntityMemoryPool();
+
+  // fill the pool
+  auto first = entity_manager.CreateEntity();
+  auto second = entity_manager.CreateEntity();
+  REQUIRE(first.has_value());
+  REQUIRE(second.has_value());
+  REQUIRE(first.value().index == 0);
+  REQUIRE(second.value().index == 1);
+  REQUIRE(steamrot::emp_helpers::GetMemoryPoolSize(pool) == 2);
+
+  // the next entity forces every component vector to grow together
+  auto third = entity_manager.CreateEntity();
+  REQUIRE(third.has_value());
+  REQUIRE(third.value().index == 2);
+  const size_t pool_size = steamrot::emp_helpers::GetMemoryPoolSize(pool);
+  REQUIRE(pool_size > 2);
+  bool all_resized = std::apply(
+      [pool_size](const auto &...component_vector) {
+        return ((component_vector.size() == pool_size) && ...);
+      },
+      pool);
+  REQUIRE(all_resized);
+  REQUIRE(steamrot::emp_helpers::GetComponent<steamrot::CMeta>(2, pool)
+              .m_entity_active);
+
+  // destroyed entities invalidate their handle and free the index
+  REQUIRE(entity_manager.DestroyEntity(first.value()).has_value());
+  REQUIRE_FALSE(entity_manager.IsEntityValid(first.value()));
+  REQUIRE_FALSE(entity_manager.DestroyEntity(first.value()).has_value());
+  REQUIRE(entity_manager.GetNextFreeEntityIndex() == 0);
+
+  auto reused = entity_manager.CreateEntity();
+  REQUIRE(reused.value().index == 0);
+  REQUIRE(entity_manager.IsEntityValid(reused.value()));
+}
+
+TEST_CASE("EntityManager builds entity signatures from default data",
+          "[EntityManager]") {
+
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  steamrot::tests::TestContext test_context;
+  steamrot::EntityManager entity_manager{
+      test_context.GetGameContext().event_handler};
+
+  auto result = entity_manager.ConfigureEntitiesFromDefaultData(
+      steamrot::SceneType::SceneType_TEST, steamrot::DataType::Flatbuffers);
+  if (!result.has_value())
+    FAIL(result.error().message);
+
+  const auto &pool = entity_manager.GetEntityMemoryPool();
+  const auto &signatures = entity_manager.GetEntitySignatures();
+  REQUIRE(signatures.size() == steamrot::emp_helpers::GetMemoryPoolSize(pool));
+
+  // each signature bit mirrors the active flag of the matching component
+  for (size_t i = 0; i < signatures.size(); ++i) {
+    REQUIRE(signatures[i].test(
+                steamrot::TupleTypeIndex<steamrot::CUserInterface,
+                                         steamrot::ComponentRegister>) ==
+            steamrot::emp_helpers::GetComponent<steamrot::CUserInterface>(i,
+                                                                         pool)
+                .m_active);
+    REQUIRE(signatures[i].test(
+                steamrot::TupleTypeIndex<steamrot::CGrimoireMachina,
+                                         steamrot::ComponentRegister>) ==
+            steamrot::emp_helpers::GetComponent<steamrot::CGrimoireMachina>(
+                i, pool)
+                .m_active);
+  }
+
+  // archetypes are already generated from the signatures
+  steamrot::tests::TestArchetypesOfConfiguredEMPfromDefaultData(
+      entity_manager.GetArchetypeManager().GetArchetypes(),
+      steamrot::SceneType_TEST);
+}
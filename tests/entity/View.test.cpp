@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the View class template
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "View.h"
+#include "EntityManager.h"
+#include "JobSystem.h"
+#include "PathProvider.h"
+#include "TestContext.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <string>
+#include <vector>
+
+TEST_CASE("View matches every archetype that is a superset of its components",
+          "[View]") {
+
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  steamrot::tests::TestContext test_context;
+  steamrot::EntityManager entity_manager{
+      10, test_context.GetGameContext().event_handler};
+
+  auto generate_result = entity_manager.GenerateAllArchetypes();
+  if (!generate_result.has_value())
+    FAIL(generate_result.error().message);
+
+  // entity 1 has CUserInterface only, entity 4 has CUserInterface and CUIState
+  steamrot::CUserInterface ui_component;
+  ui_component.m_name = "ui only";
+  REQUIRE(entity_manager.AddComponent<steamrot::CUserInterface>(
+      1, std::move(ui_component)));
+  steamrot::CUserInterface ui_state_component;
+  ui_state_component.m_name = "ui and state";
+  REQUIRE(entity_manager.AddComponent<steamrot::CUserInterface>(
+      4, std::move(ui_state_component)));
+  REQUIRE(entity_manager.AddComponent<steamrot::CUIState>(4));
+
+  steamrot::View<steamrot::CUserInterface> ui_view(
+      entity_manager.GetEntityMemoryPool(),
+      entity_manager.GetArchetypeManager());
+  steamrot::View<steamrot::CUserInterface, steamrot::CUIState> ui_state_view(
+      entity_manager.GetEntityMemoryPool(),
+      entity_manager.GetArchetypeManager());
+
+  // the CUserInterface view picks up both archetypes
+  std::vector<size_t> visited;
+  for (auto [entity_id, ui] : ui_view) {
+    REQUIRE(ui.m_active);
+    visited.push_back(entity_id);
+  }
+  std::ranges::sort(visited);
+  REQUIRE(visited == std::vector<size_t>{1, 4});
+  REQUIRE(ui_view.GetArchetypeCount() == 2);
+
+  // the combined view only matches the entity with both components, and the
+  // references point straight into the pool
+  size_t visit_count{0};
+  ui_state_view.ForEach([&](size_t entity_id, steamrot::CUserInterface &ui,
+                            steamrot::CUIState &ui_state) {
+    REQUIRE(entity_id == 4);
+    REQUIRE(ui.m_name == "ui and state");
+    REQUIRE(ui_state.m_active);
+    ui.m_name = "changed through view";
+    ++visit_count;
+  });
+  REQUIRE(visit_count == 1);
+  REQUIRE(steamrot::emp_helpers::GetComponent<steamrot::CUserInterface>(
+              4, entity_manager.GetEntityMemoryPool())
+              .m_name == "changed through view");
+}
+
+TEST_CASE("View refreshes its cached archetypes when the archetype set changes",
+          "[View]") {
+
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  steamrot::tests::TestContext test_context;
+  steamrot::EntityManager entity_manager{
+      10, test_context.GetGameContext().event_handler};
+
+  auto generate_result = entity_manager.GenerateAllArchetypes();
+  if (!generate_result.has_value())
+    FAIL(generate_result.error().message);
+
+  steamrot::View<steamrot::CUserInterface> ui_view(
+      entity_manager.GetEntityMemoryPool(),
+      entity_manager.GetArchetypeManager());
+  REQUIRE(ui_view.GetEntityCount() == 0);
+  REQUIRE(ui_view.begin() == ui_view.end());
+
+  const size_t version =
+      entity_manager.GetArchetypeManager().GetArchetypeSetVersion();
+
+  // a new archetype bumps the version and the view sees it
+  REQUIRE(entity_manager.AddComponent<steamrot::CUserInterface>(2));
+  REQUIRE(entity_manager.GetArchetypeManager().GetArchetypeSetVersion() !=
+          version);
+  REQUIRE(ui_view.GetEntityCount() == 1);
+
+  // moving into an existing archetype does not change the set, but the
+  // cached archetype still sees the new entity
+  const size_t populated_version =
+      entity_manager.GetArchetypeManager().GetArchetypeSetVersion();
+  REQUIRE(entity_manager.AddComponent<steamrot::CUserInterface>(3));
+  REQUIRE(entity_manager.GetArchetypeManager().GetArchetypeSetVersion() ==
+          populated_version);
+  REQUIRE(ui_view.GetEntityCount() == 2);
+
+  // removing the last entities erases the archetype and the view drops it
+  REQUIRE(entity_manager.RemoveComponent<steamrot::CUserInterface>(2));
+  REQUIRE(entity_manager.RemoveComponent<steamrot::CUserInterface>(3));
+  REQUIRE(ui_view.GetArchetypeCount() == 0);
+  REQUIRE(ui_view.GetEntityCount() == 0);
+}
+
+TEST_CASE("View ParallelForEach visits every matching entity once",
+          "[View]") {
+
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  steamrot::tests::TestContext test_context;
+  steamrot::EntityManager entity_manager{
+      1000, test_context.GetGameContext().event_handler};
+
+  auto generate_result = entity_manager.GenerateAllArchetypes();
+  if (!generate_result.has_value())
+    FAIL(generate_result.error().message);
+
+  // split the entities over two archetypes that both match the view
+  for (size_t i = 0; i < 1000; ++i) {
+    REQUIRE(entity_manager.AddComponent<steamrot::CUserInterface>(i));
+    if (i % 3 == 0) {
+      REQUIRE(entity_manager.AddComponent<steamrot::CUIState>(i));
+    }
+  }
+
+  steamrot::View<steamrot::CUserInterface> ui_view(
+      entity_manager.GetEntityMemoryPool(),
+      entity_manager.GetArchetypeManager());
+
+  const size_t worker_count = GENERATE(0, 3);
+  steamrot::JobSystem job_system(worker_count);
+
+  // each entity only touches its own component, so no synchronisation needed
+  ui_view.ParallelForEach(
+      job_system,
+      [](size_t entity_id, steamrot::CUserInterface &ui) {
+        ui.m_name = std::to_string(entity_id);
+      },
+      64);
+
+  const auto &pool = entity_manager.GetEntityMemoryPool();
+  for (size_t i = 0; i < 1000; ++i) {
+    REQUIRE(steamrot::emp_helpers::GetComponent<steamrot::CUserInterface>(i,
+                                                                         pool)
+                .m_name == std::to_string(i));
+  }
+}
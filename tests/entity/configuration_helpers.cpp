@@ -173,12 +173,10 @@ void TestArchetypesOfConfiguredEMPfromDefaultData(
     // Check each component and set the corresponding bit in the ArchetypeID if
     // it is active
     if (entity_data->c_user_interface()) {
-      CUserInterface c_user_interface;
-      archetype_id.set(c_user_interface.GetComponentRegisterIndex());
+      archetype_id.set(TupleTypeIndex<CUserInterface, ComponentRegister>);
     }
     if (entity_data->c_grimoire_machina()) {
-      CGrimoireMachina c_grimoire_machina;
-      archetype_id.set(c_grimoire_machina.GetComponentRegisterIndex());
+      archetype_id.set(TupleTypeIndex<CGrimoireMachina, ComponentRegister>);
     }
     // fill in further components as needed
 
@@ -8,13 +8,18 @@
 /////////////////////////////////////////////////
 #include "EventHandler.h"
 #include "EventPacket.h"
+#include "JobSystem.h"
 #include "Subscriber.h"
 #include "events_generated.h"
+#include "uuid.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 #include <X11/extensions/XTest.h>
 #include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST_CASE("EventHandler registers Subscribers", "[EventHandler]") {
   // Create an EventHandler instance
@@ -28,26 +33,224 @@ TEST_CASE("EventHandler registers Subscribers", "[EventHandler]") {
   std::shared_ptr<steamrot::Subscriber> subscriber =
       std::make_shared<steamrot::Subscriber>(event_type);
 
-  // Check that the EventHandler UserInput register is empty initially
-  auto subscriber_register = event_handler.GetSubcriberRegister();
-  REQUIRE(subscriber_register.empty());
+  // Check that the EventHandler has no subscribers initially
+  REQUIRE(event_handler.GetSubscriberCount() == 0);
 
   auto result = event_handler.RegisterSubscriber(subscriber);
   if (!result.has_value())
     FAIL(result.error().message);
 
   // Check that the Subscriber was registered successfully
-  subscriber_register = event_handler.GetSubcriberRegister();
+  REQUIRE(event_handler.GetSubscriberCount() == 1);
+  REQUIRE(event_handler.GetSubscriberCount(event_type) == 1);
+  REQUIRE(subscriber->IsRegistered());
+  const steamrot::SubscriberHandle handle = subscriber->GetHandle();
+  REQUIRE(event_handler.IsSubscriberValid(handle));
 
-  REQUIRE(subscriber_register.size() == 1);
-  REQUIRE(subscriber_register.at(event_type).size() == 1);
+  // registering twice is refused
+  REQUIRE_FALSE(event_handler.RegisterSubscriber(subscriber).has_value());
 
-  // check that the pointers are the same
-  REQUIRE(subscriber == subscriber_register.at(event_type)[0].lock());
+  // when the subscriber is destroyed it deregisters itself
+  subscriber.reset();
+  REQUIRE(event_handler.GetSubscriberCount() == 0);
+  REQUIRE(event_handler.GetSubscriberCount(event_type) == 0);
+  REQUIRE_FALSE(event_handler.IsSubscriberValid(handle));
+}
+
+TEST_CASE("EventHandler refuses Subscribers it cannot dispatch to",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+
+  REQUIRE_FALSE(event_handler.RegisterSubscriber(nullptr).has_value());
+
+  auto none_result = event_handler.RegisterSubscriber(
+      std::make_shared<steamrot::Subscriber>(steamrot::EventType_NONE));
+  REQUIRE_FALSE(none_result.has_value());
+  REQUIRE(none_result.error().mode ==
+          steamrot::FailMode::NonExistentEnumValue);
+
+  // a bit past EventType_ANY is not an event type
+  auto unknown_result =
+      event_handler.RegisterSubscriber(std::make_shared<steamrot::Subscriber>(
+          static_cast<steamrot::EventType>(
+              static_cast<uint64_t>(steamrot::EventType_ANY) + 1)));
+  REQUIRE_FALSE(unknown_result.has_value());
+  REQUIRE(event_handler.GetSubscriberCount() == 0);
+}
+
+TEST_CASE("EventHandler registers Subscribers for several EventTypes",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  const steamrot::EventType event_mask = static_cast<steamrot::EventType>(
+      steamrot::EventType_EVENT_TEST | steamrot::EventType_EVENT_QUIT_GAME);
+
+  auto subscriber = std::make_shared<steamrot::Subscriber>(event_mask);
+  REQUIRE(subscriber->IsSubscribedTo(steamrot::EventType_EVENT_TEST));
+  REQUIRE(subscriber->IsSubscribedTo(steamrot::EventType_EVENT_QUIT_GAME));
+  REQUIRE_FALSE(
+      subscriber->IsSubscribedTo(steamrot::EventType_EVENT_USER_INPUT));
+
+  auto result = event_handler.RegisterSubscriber(subscriber);
+  if (!result.has_value())
+    FAIL(result.error().message);
+
+  // one Subscriber, in the dispatch list of each of its event types
+  REQUIRE(event_handler.GetSubscriberCount() == 1);
+  REQUIRE(event_handler.GetSubscriberCount(steamrot::EventType_EVENT_TEST) ==
+          1);
+  REQUIRE(event_handler.GetSubscriberCount(
+              steamrot::EventType_EVENT_QUIT_GAME) == 1);
+  REQUIRE(event_handler.GetSubscriberCount(
+              steamrot::EventType_EVENT_USER_INPUT) == 0);
+
+  // an event type outside the mask does nothing
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_USER_INPUT, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+  event_handler.UpateSubscribersFromGlobalEventBus();
+  REQUIRE_FALSE(subscriber->IsActive());
+  event_handler.TickGlobalEventBus();
+
+  // either event type activates it, the last one on the bus is recorded
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate{}});
+  event_handler.AddEvent(
+      steamrot::EventPacket{steamrot::EventType_EVENT_TEST, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+  event_handler.UpateSubscribersFromGlobalEventBus();
+  REQUIRE(subscriber->IsActive());
+  REQUIRE(subscriber->GetTriggeredEventType() ==
+          steamrot::EventType_EVENT_TEST);
 
-  // when the subscriber goes out of scope, the weak pointer should be expired
+  // deregistering removes it from every list
   subscriber.reset();
-  REQUIRE(subscriber_register.at(event_type)[0].expired());
+  REQUIRE(event_handler.GetSubscriberCount(steamrot::EventType_EVENT_TEST) ==
+          0);
+  REQUIRE(event_handler.GetSubscriberCount(
+              steamrot::EventType_EVENT_QUIT_GAME) == 0);
+  event_handler.UpateSubscribersFromGlobalEventBus();
+}
+
+TEST_CASE("EventHandler only activates Subscribers whose trigger matches",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  const steamrot::EventType event_type = steamrot::EventType_EVENT_TEST;
+
+  // many exact triggers, as a UI scene full of buttons has
+  std::vector<std::shared_ptr<steamrot::Subscriber>> button_subscribers;
+  for (size_t index = 0; index < 100; index++) {
+    button_subscribers.push_back(std::make_shared<steamrot::Subscriber>(
+        event_type,
+        steamrot::UIElementName{"button_" + std::to_string(index)}));
+    auto result = event_handler.RegisterSubscriber(button_subscribers.back());
+    if (!result.has_value())
+      FAIL(result.error().message);
+  }
+
+  // and one Subscriber without a trigger
+  auto catch_all_subscriber =
+      std::make_shared<steamrot::Subscriber>(event_type);
+  REQUIRE(event_handler.RegisterSubscriber(catch_all_subscriber).has_value());
+  REQUIRE(event_handler.GetSubscriberCount(event_type) == 101);
+
+  event_handler.AddEvent(
+      steamrot::EventPacket{event_type, steamrot::UIElementName{"button_42"}});
+  event_handler.ProcessWaitingRoomEventBus();
+  event_handler.UpateSubscribersFromGlobalEventBus();
+
+  REQUIRE(catch_all_subscriber->IsActive());
+  for (size_t index = 0; index < button_subscribers.size(); index++) {
+    REQUIRE(button_subscribers[index]->IsActive() == (index == 42));
+  }
+
+  // deregistered Subscribers leave their buckets
+  button_subscribers.clear();
+  REQUIRE(event_handler.GetSubscriberCount(event_type) == 1);
+  event_handler.UpateSubscribersFromGlobalEventBus();
+}
+
+TEST_CASE("EventHandler tracks the EventTypes present on the global EventBus",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  REQUIRE(event_handler.GetPresentEventMask() == steamrot::EventType_NONE);
+
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_TEST, std::monostate{}, uint8_t{2}});
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetPresentEventMask() ==
+          static_cast<steamrot::EventType>(
+              steamrot::EventType_EVENT_TEST |
+              steamrot::EventType_EVENT_QUIT_GAME));
+
+  // only the surviving event is left after a tick
+  event_handler.TickGlobalEventBus();
+  REQUIRE(event_handler.GetPresentEventMask() ==
+          steamrot::EventType_EVENT_TEST);
+
+  event_handler.TickGlobalEventBus();
+  REQUIRE(event_handler.GetPresentEventMask() == steamrot::EventType_NONE);
+}
+
+TEST_CASE("EventHandler reuses deregistered slots with a new generation",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  const steamrot::EventType event_type = steamrot::EventType_EVENT_TEST;
+
+  auto first = std::make_shared<steamrot::Subscriber>(event_type);
+  REQUIRE(event_handler.RegisterSubscriber(first).has_value());
+  const steamrot::SubscriberHandle first_handle = first->GetHandle();
+
+  auto deregister_result = event_handler.DeregisterSubscriber(first_handle);
+  REQUIRE(deregister_result.has_value());
+  REQUIRE_FALSE(first->IsRegistered());
+
+  // a stale handle cannot deregister whatever reuses the slot
+  auto second = std::make_shared<steamrot::Subscriber>(event_type);
+  REQUIRE(event_handler.RegisterSubscriber(second).has_value());
+  REQUIRE(second->GetHandle().index == first_handle.index);
+  REQUIRE(second->GetHandle().generation != first_handle.generation);
+
+  auto stale_result = event_handler.DeregisterSubscriber(first_handle);
+  REQUIRE_FALSE(stale_result.has_value());
+  REQUIRE(stale_result.error().mode == steamrot::FailMode::StaleHandle);
+  REQUIRE(second->IsRegistered());
+  REQUIRE(event_handler.GetSubscriberCount(event_type) == 1);
+}
+
+TEST_CASE("EventHandler only dispatches to live Subscribers",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  const steamrot::EventType event_type = steamrot::EventType_EVENT_TEST;
+
+  auto kept = std::make_shared<steamrot::Subscriber>(event_type);
+  auto dropped = std::make_shared<steamrot::Subscriber>(event_type);
+  REQUIRE(event_handler.RegisterSubscriber(kept).has_value());
+  REQUIRE(event_handler.RegisterSubscriber(dropped).has_value());
+  dropped.reset();
+
+  event_handler.AddEvent(steamrot::EventPacket{event_type, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+  event_handler.UpateSubscribersFromGlobalEventBus();
+
+  REQUIRE(kept->IsActive());
+  REQUIRE(event_handler.GetSubscriberCount(event_type) == 1);
+}
+
+TEST_CASE("Subscribers outliving their EventHandler are detached",
+          "[EventHandler]") {
+  auto subscriber =
+      std::make_shared<steamrot::Subscriber>(steamrot::EventType_EVENT_TEST);
+  {
+    steamrot::EventHandler event_handler;
+    REQUIRE(event_handler.RegisterSubscriber(subscriber).has_value());
+
+    // copies start unregistered
+    steamrot::Subscriber copy{*subscriber};
+    REQUIRE_FALSE(copy.IsRegistered());
+  }
+  REQUIRE_FALSE(subscriber->IsRegistered());
 }
 TEST_CASE("AddEvent adds an event to an EventBus", "[EventHandler]") {
   // create an eventHandler
@@ -63,6 +266,152 @@ TEST_CASE("AddEvent adds an event to an EventBus", "[EventHandler]") {
   REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
 }
 
+TEST_CASE("EmplaceEvent constructs an event on the waiting room EventBus",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+
+  steamrot::EventPacket &event = event_handler.EmplaceEvent(
+      steamrot::EventType_EVENT_TEST, std::monostate{}, uint8_t{3});
+  REQUIRE(event.m_event_type == steamrot::EventType_EVENT_TEST);
+
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
+  REQUIRE(event_handler.GetGlobalEventBus()[0].event_lifetime == 3);
+}
+
+TEST_CASE("Events added from other threads are merged in source and posting "
+          "order",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  constexpr uint8_t kEventsPerThread = 100;
+
+  const uuids::uuid first_source =
+      uuids::uuid::from_string("00000000-0000-0000-0000-000000000001").value();
+  const uuids::uuid second_source =
+      uuids::uuid::from_string("00000000-0000-0000-0000-000000000002").value();
+
+  // the lifetime records the order each thread posted in
+  auto post_events = [&event_handler](const uuids::uuid &source_id) {
+    for (uint8_t index = 1; index <= kEventsPerThread; index++) {
+      steamrot::EventPacket &event = event_handler.EmplaceEvent(
+          steamrot::EventType_EVENT_TEST, std::monostate{}, index);
+      event.source_id = source_id;
+    }
+  };
+
+  // start the second source first, the order must not depend on it
+  {
+    std::jthread second_thread{post_events, second_source};
+    std::jthread first_thread{post_events, first_source};
+  }
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate{}});
+
+  event_handler.ProcessWaitingRoomEventBus();
+  const auto &global_event_bus = event_handler.GetGlobalEventBus();
+  REQUIRE(global_event_bus.size() == 2 * kEventsPerThread + 1);
+
+  // events added on the owning thread come first
+  REQUIRE(global_event_bus[0].m_event_type ==
+          steamrot::EventType_EVENT_QUIT_GAME);
+  for (size_t index = 0; index < kEventsPerThread; index++) {
+    const auto &first_event = global_event_bus[1 + index];
+    const auto &second_event = global_event_bus[1 + kEventsPerThread + index];
+    REQUIRE(first_event.source_id == first_source);
+    REQUIRE(first_event.event_lifetime == index + 1);
+    REQUIRE(second_event.source_id == second_source);
+    REQUIRE(second_event.event_lifetime == index + 1);
+  }
+
+  // the staging buffers are emptied by the merge
+  event_handler.TickGlobalEventBus();
+  const size_t surviving_event_count = global_event_bus.size();
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(global_event_bus.size() == surviving_event_count);
+}
+
+TEST_CASE("Events added from jobs are staged even on the owning thread",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+
+  // no workers, so the job runs on this thread inside Wait
+  steamrot::JobSystem job_system{0};
+  steamrot::JobCounter counter;
+  job_system.Submit(
+      [&event_handler]() {
+        event_handler.AddEvent(steamrot::EventPacket{
+            steamrot::EventType_EVENT_TEST, std::monostate{}});
+      },
+      counter);
+  job_system.Wait(counter);
+
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+
+  const auto &global_event_bus = event_handler.GetGlobalEventBus();
+  REQUIRE(global_event_bus.size() == 2);
+  REQUIRE(global_event_bus[0].m_event_type ==
+          steamrot::EventType_EVENT_QUIT_GAME);
+  REQUIRE(global_event_bus[1].m_event_type == steamrot::EventType_EVENT_TEST);
+}
+
+TEST_CASE("Events added from many jobs are all merged", "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  steamrot::JobSystem job_system{4};
+  constexpr size_t kJobCount = 64;
+
+  steamrot::JobCounter counter;
+  for (size_t index = 0; index < kJobCount; index++) {
+    job_system.Submit(
+        [&event_handler]() {
+          event_handler.EmplaceEvent(steamrot::EventType_EVENT_TEST,
+                                     std::monostate{});
+        },
+        counter);
+  }
+  job_system.Wait(counter);
+
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == kJobCount);
+}
+
+TEST_CASE("ProcessWaitingRoomEventBus keeps surviving events first and "
+          "never shrinks the preallocated EventBuses",
+          "[EventHandler]") {
+  steamrot::EventHandler event_handler;
+  REQUIRE(event_handler.GetGlobalEventBus().capacity() >=
+          steamrot::kEventBusCapacity);
+
+  // an event that survives one tick
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_TEST, std::monostate{}, uint8_t{2}});
+  event_handler.ProcessWaitingRoomEventBus();
+  event_handler.TickGlobalEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
+
+  // followed by a new event
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+
+  const auto &global_event_bus = event_handler.GetGlobalEventBus();
+  REQUIRE(global_event_bus.size() == 2);
+  REQUIRE(global_event_bus[0].m_event_type == steamrot::EventType_EVENT_TEST);
+  REQUIRE(global_event_bus[1].m_event_type ==
+          steamrot::EventType_EVENT_QUIT_GAME);
+
+  // once empty, the buses trade storage and keep their capacity
+  event_handler.TickGlobalEventBus();
+  event_handler.TickGlobalEventBus();
+  REQUIRE(global_event_bus.empty());
+  event_handler.AddEvent(steamrot::EventPacket{
+      steamrot::EventType_EVENT_TEST, std::monostate{}});
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(global_event_bus.size() == 1);
+  REQUIRE(global_event_bus.capacity() >= steamrot::kEventBusCapacity);
+}
+
 TEST_CASE("DecrementEventLifetimes decrease all lifetimes by 1",
           "[EventHandler]") {
 
@@ -193,13 +542,14 @@ TEST_CASE("UpdateSubscribers turns on Subscribers and copies EventData",
   user_input_bitset = steamrot::UserInputBitset{{event}};
 
   // Update the subscriber with the event data
-  std::weak_ptr<steamrot::Subscriber> weak_subscriber = subscriber;
-  steamrot::UpdateSubscriber(weak_subscriber, user_input_bitset);
+  steamrot::UpdateSubscriber(
+      *subscriber, steamrot::EventPacket{event_type, user_input_bitset});
 
   REQUIRE(subscriber->IsActive());
   REQUIRE(std::holds_alternative<steamrot::UserInputBitset>(
       subscriber->GetEventData()));
   REQUIRE(subscriber->GetEventData() == user_input_bitset);
+  REQUIRE(subscriber->GetTriggeredEventType() == event_type);
 }
 
 TEST_CASE("EventHandler::UpdateSubscribersFrom does not update Subscribers "
@@ -266,8 +616,8 @@ TEST_CASE("EventHandler::UpdateSubscribers does not update Subscriber if "
 
   REQUIRE(user_input_bitset != trigger_data);
   // Update the subscriber with the event data
-  std::weak_ptr<steamrot::Subscriber> weak_subscriber = subscriber;
-  steamrot::UpdateSubscriber(weak_subscriber, user_input_bitset);
+  steamrot::UpdateSubscriber(
+      *subscriber, steamrot::EventPacket{event_type, user_input_bitset});
 
   // check that the subscriber is still not active
   REQUIRE_FALSE(subscriber->IsActive());
@@ -299,8 +649,8 @@ TEST_CASE(
   REQUIRE(user_input_bitset == trigger_data);
 
   // Update the subscriber with the event data
-  std::weak_ptr<steamrot::Subscriber> weak_subscriber = subscriber;
-  steamrot::UpdateSubscriber(weak_subscriber, user_input_bitset);
+  steamrot::UpdateSubscriber(
+      *subscriber, steamrot::EventPacket{event_type, user_input_bitset});
 
   // check that the subscriber is now active
   REQUIRE(subscriber->IsActive());
@@ -0,0 +1,170 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the EventRecorder class and recording files
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventRecorder.h"
+#include "EventPacket.h"
+#include "FailInfo.h"
+#include "UserInputBitset.h"
+#include "event_recording.h"
+#include "events_generated.h"
+#include "uuid.h"
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+
+TEST_CASE("EventRecorder tags events with the current loop number",
+          "[EventRecorder]") {
+  size_t loop_number = 3;
+  steamrot::EventRecorder event_recorder{loop_number};
+
+  event_recorder.Record(
+      steamrot::EventPacket{steamrot::EventType_EVENT_TEST, std::monostate{}});
+  loop_number = 7;
+  event_recorder.Record(steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate{}});
+  loop_number = 9;
+
+  const steamrot::EventRecording &recording = event_recorder.GetRecording();
+  REQUIRE(recording.events.size() == 2);
+  REQUIRE(recording.events[0].loop_number == 3);
+  REQUIRE(recording.events[0].event.m_event_type ==
+          steamrot::EventType_EVENT_TEST);
+  REQUIRE(recording.events[1].loop_number == 7);
+  REQUIRE(recording.end_loop_number == 9);
+}
+
+TEST_CASE("Event recordings survive a round trip through a file",
+          "[EventRecorder]") {
+  size_t loop_number = 1;
+  steamrot::EventRecorder event_recorder{loop_number};
+
+  steamrot::UserInputBitset user_input;
+  user_input.setKeyPressed(sf::Keyboard::Key::W);
+  user_input.setMouseReleased(sf::Mouse::Button::Left);
+  steamrot::EventPacket input_event{steamrot::EventType_EVENT_USER_INPUT,
+                                    user_input};
+  input_event.source_id =
+      uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+  event_recorder.Record(input_event);
+
+  loop_number = 4;
+  const steamrot::SceneChangePacket scene_change{
+      uuids::uuid::from_string("00000000-0000-0000-0000-000000000001"),
+      steamrot::SceneType_TITLE};
+  event_recorder.Record(steamrot::EventPacket{
+      steamrot::EventType_EVENT_CHANGE_SCENE, scene_change, uint8_t{3}});
+  event_recorder.Record(steamrot::EventPacket{
+      steamrot::EventType_EVENT_TOGGLE_DROPDOWN,
+      steamrot::UIElementName{"settings_dropdown"}});
+  event_recorder.RecordMousePosition({-12, 480});
+  loop_number = 5;
+  // an unmoved mouse is not recorded again
+  event_recorder.RecordMousePosition({-12, 480});
+  loop_number = 10;
+
+  const std::filesystem::path recording_path =
+      std::filesystem::temp_directory_path() / "steamrot_event_recording.bin";
+  auto write_result = event_recorder.WriteToFile(recording_path);
+  if (!write_result.has_value())
+    FAIL(write_result.error().message);
+
+  auto read_result = steamrot::ReadEventRecording(recording_path);
+  std::filesystem::remove(recording_path);
+  if (!read_result.has_value())
+    FAIL(read_result.error().message);
+
+  const steamrot::EventRecording &recording = read_result.value();
+  REQUIRE(recording.end_loop_number == 10);
+  REQUIRE(recording.events.size() == 3);
+
+  REQUIRE(recording.events[0].loop_number == 1);
+  REQUIRE(recording.events[0].event.m_event_type ==
+          steamrot::EventType_EVENT_USER_INPUT);
+  REQUIRE(recording.events[0].event.m_event_data ==
+          steamrot::EventData{user_input});
+  REQUIRE(recording.events[0].event.source_id == input_event.source_id);
+
+  REQUIRE(recording.events[1].loop_number == 4);
+  REQUIRE(recording.events[1].event.event_lifetime == 3);
+  REQUIRE(recording.events[1].event.m_event_data ==
+          steamrot::EventData{scene_change});
+
+  REQUIRE(recording.events[2].event.m_event_data ==
+          steamrot::EventData{steamrot::UIElementName{"settings_dropdown"}});
+
+  REQUIRE(recording.mouse_positions.size() == 1);
+  REQUIRE(recording.mouse_positions[0].loop_number == 4);
+  REQUIRE(recording.mouse_positions[0].position == sf::Vector2i{-12, 480});
+}
+
+TEST_CASE("ReadEventRecording refuses missing and foreign files",
+          "[EventRecorder]") {
+  const std::filesystem::path recording_path =
+      std::filesystem::temp_directory_path() / "steamrot_not_a_recording.bin";
+
+  auto missing_result = steamrot::ReadEventRecording(recording_path);
+  REQUIRE_FALSE(missing_result.has_value());
+  REQUIRE(missing_result.error().mode == steamrot::FailMode::FileNotFound);
+
+  {
+    std::ofstream recording_file(recording_path, std::ios::binary);
+    recording_file << "definitely not events";
+  }
+  auto foreign_result = steamrot::ReadEventRecording(recording_path);
+  std::filesystem::remove(recording_path);
+  REQUIRE_FALSE(foreign_result.has_value());
+  REQUIRE(foreign_result.error().mode == steamrot::FailMode::ReadFailure);
+}
+
+TEST_CASE("ReadEventRecording refuses corrupt names and event types",
+          "[EventRecorder]") {
+  const std::filesystem::path recording_path =
+      std::filesystem::temp_directory_path() / "steamrot_corrupt_recording.bin";
+
+  steamrot::EventRecording recording;
+  recording.end_loop_number = 2;
+  recording.events.push_back(
+      {1, steamrot::EventPacket{steamrot::EventType_EVENT_TOGGLE_DROPDOWN,
+                                steamrot::UIElementName{"settings"}}});
+
+  // header, then loop number, event type, lifetime, two uuids, data index
+  constexpr std::streamoff kEventTypeOffset = 28 + 8;
+  constexpr std::streamoff kNameSizeOffset = kEventTypeOffset + 8 + 1 + 32 + 1;
+
+  auto write_corrupted = [&](std::streamoff offset, auto value) {
+    auto write_result =
+        steamrot::WriteEventRecording(recording, recording_path);
+    if (!write_result.has_value())
+      FAIL(write_result.error().message);
+    std::fstream recording_file(recording_path, std::ios::binary |
+                                                    std::ios::in |
+                                                    std::ios::out);
+    recording_file.seekp(offset);
+    recording_file.write(reinterpret_cast<const char *>(&value),
+                         sizeof(value));
+  };
+
+  // the untouched file reads back
+  write_corrupted(kNameSizeOffset, uint32_t{8});
+  REQUIRE(steamrot::ReadEventRecording(recording_path).has_value());
+
+  // a name longer than the file is refused before it is allocated
+  write_corrupted(kNameSizeOffset, uint32_t{0xFFFFFFFF});
+  auto name_result = steamrot::ReadEventRecording(recording_path);
+  REQUIRE_FALSE(name_result.has_value());
+  REQUIRE(name_result.error().mode == steamrot::FailMode::ReadFailure);
+
+  // so is a value that is not one EventType
+  write_corrupted(kEventTypeOffset, uint64_t{3});
+  auto type_result = steamrot::ReadEventRecording(recording_path);
+  std::filesystem::remove(recording_path);
+  REQUIRE_FALSE(type_result.has_value());
+  REQUIRE(type_result.error().mode == steamrot::FailMode::ReadFailure);
+}
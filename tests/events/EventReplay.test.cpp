@@ -0,0 +1,158 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the EventReplay class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventReplay.h"
+#include "EventHandler.h"
+#include "EventPacket.h"
+#include "EventRecorder.h"
+#include "InputState.h"
+#include "event_recording.h"
+#include "events_generated.h"
+#include <SFML/System/Vector2.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief A recording with one test event on each of the given loop numbers
+/////////////////////////////////////////////////
+steamrot::EventRecording
+MakeRecording(std::initializer_list<size_t> loop_numbers,
+              size_t end_loop_number) {
+  steamrot::EventRecording recording;
+  recording.end_loop_number = end_loop_number;
+  for (const size_t loop_number : loop_numbers) {
+    recording.events.push_back(
+        {loop_number, steamrot::EventPacket{steamrot::EventType_EVENT_TEST,
+                                            std::monostate{}}});
+  }
+  return recording;
+}
+} // namespace
+
+TEST_CASE("EventReplay hands back events on the loop they were recorded on",
+          "[EventReplay]") {
+  steamrot::EventReplay event_replay{MakeRecording({1, 1, 3}, 5)};
+
+  REQUIRE(event_replay.TakeEventsUpTo(1).size() == 2);
+  REQUIRE(event_replay.TakeEventsUpTo(1).empty());
+  REQUIRE(event_replay.TakeEventsUpTo(2).empty());
+
+  // anything skipped over is still handed back
+  const auto late_events = event_replay.TakeEventsUpTo(4);
+  REQUIRE(late_events.size() == 1);
+  REQUIRE(late_events[0].loop_number == 3);
+
+  REQUIRE_FALSE(event_replay.IsFinished(4));
+  REQUIRE(event_replay.IsFinished(5));
+  REQUIRE(event_replay.GetEndLoopNumber() == 5);
+}
+
+TEST_CASE("EventHandler::PreloadEvents adds replayed events to the waiting "
+          "room and records them",
+          "[EventReplay]") {
+  steamrot::EventHandler event_handler;
+  steamrot::InputState input_state;
+  steamrot::EventReplay event_replay{MakeRecording({1, 2}, 3)};
+  sf::Vector2i mouse_position{0, 0};
+
+  size_t loop_number = 1;
+  steamrot::EventRecorder event_recorder{loop_number};
+  event_handler.SetEventRecorder(&event_recorder);
+
+  event_handler.PreloadEvents(event_replay, loop_number, input_state,
+                              mouse_position);
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
+  event_handler.TickGlobalEventBus();
+
+  loop_number = 2;
+  event_handler.PreloadEvents(event_replay, loop_number, input_state,
+                              mouse_position);
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
+
+  // a recording of a replay matches the original
+  event_handler.SetEventRecorder(nullptr);
+  loop_number = 3;
+  const steamrot::EventRecording &recording = event_recorder.GetRecording();
+  REQUIRE(recording.events.size() == 2);
+  REQUIRE(recording.events[0].loop_number == 1);
+  REQUIRE(recording.events[1].loop_number == 2);
+  REQUIRE(recording.end_loop_number == 3);
+}
+
+TEST_CASE("EventHandler::PreloadEvents replays user input through the "
+          "InputState",
+          "[EventReplay]") {
+  steamrot::EventHandler event_handler;
+  steamrot::InputState input_state;
+
+  steamrot::UserInputBitset user_input;
+  user_input.setKeyPressed(sf::Keyboard::Key::A);
+  steamrot::EventRecording recording;
+  recording.end_loop_number = 2;
+  recording.events.push_back(
+      {1, steamrot::EventPacket{steamrot::EventType_EVENT_USER_INPUT,
+                                user_input}});
+  steamrot::EventReplay event_replay{std::move(recording)};
+  sf::Vector2i mouse_position{0, 0};
+
+  event_handler.PreloadEvents(event_replay, 1, input_state, mouse_position);
+  // nothing is published until the snapshot
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().empty());
+
+  input_state.Snapshot();
+  REQUIRE(input_state.IsPressed(sf::Keyboard::Key::A));
+  event_handler.PreloadEvents(input_state, mouse_position);
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
+  REQUIRE(std::get<steamrot::UserInputBitset>(
+              event_handler.GetGlobalEventBus()[0].m_event_data) ==
+          user_input);
+}
+
+TEST_CASE("EventHandler::PreloadEvents replays the recorded mouse position",
+          "[EventReplay]") {
+  steamrot::EventHandler event_handler;
+  steamrot::InputState input_state;
+
+  steamrot::EventRecording recording = MakeRecording({}, 6);
+  recording.mouse_positions.push_back({2, sf::Vector2i{10, 20}});
+  recording.mouse_positions.push_back({4, sf::Vector2i{30, 40}});
+  steamrot::EventReplay event_replay{std::move(recording)};
+
+  size_t loop_number = 1;
+  steamrot::EventRecorder event_recorder{loop_number};
+  event_handler.SetEventRecorder(&event_recorder);
+
+  // the window's position stands until the first recorded one
+  sf::Vector2i mouse_position{5, 5};
+  event_handler.PreloadEvents(event_replay, loop_number, input_state,
+                              mouse_position);
+  REQUIRE(mouse_position == sf::Vector2i{5, 5});
+
+  // and is overridden on every tick after it
+  for (loop_number = 2; loop_number < 6; loop_number++) {
+    mouse_position = sf::Vector2i{5, 5};
+    event_handler.PreloadEvents(event_replay, loop_number, input_state,
+                                mouse_position);
+    REQUIRE(mouse_position ==
+            (loop_number < 4 ? sf::Vector2i{10, 20} : sf::Vector2i{30, 40}));
+    event_handler.PreloadEvents(input_state, mouse_position);
+  }
+
+  // a recording of a replay only keeps the moves
+  event_handler.SetEventRecorder(nullptr);
+  const steamrot::EventRecording &rerecording = event_recorder.GetRecording();
+  REQUIRE(rerecording.mouse_positions.size() == 2);
+  REQUIRE(rerecording.mouse_positions[0].loop_number == 2);
+  REQUIRE(rerecording.mouse_positions[0].position == sf::Vector2i{10, 20});
+  REQUIRE(rerecording.mouse_positions[1].loop_number == 4);
+  REQUIRE(rerecording.mouse_positions[1].position == sf::Vector2i{30, 40});
+}
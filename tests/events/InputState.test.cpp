@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the InputState class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "InputState.h"
+#include "EventHandler.h"
+#include "UserInputBitset.h"
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <variant>
+
+namespace {
+/////////////////////////////////////////////////
+sf::Event KeyPressed(sf::Keyboard::Key key) {
+  return sf::Event::KeyPressed{key, {}, false, false, false, false};
+}
+
+/////////////////////////////////////////////////
+sf::Event KeyReleased(sf::Keyboard::Key key) {
+  return sf::Event::KeyReleased{key, {}, false, false, false, false};
+}
+} // namespace
+
+TEST_CASE("InputState reports pressed, held and released across snapshots",
+          "[InputState]") {
+  steamrot::InputState input_state;
+  const auto key = sf::Keyboard::Key::W;
+
+  REQUIRE(input_state.ApplyEvent(KeyPressed(key)));
+  // nothing changes until the snapshot
+  REQUIRE_FALSE(input_state.IsDown(key));
+
+  input_state.Snapshot();
+  REQUIRE(input_state.IsDown(key));
+  REQUIRE(input_state.IsPressed(key));
+  REQUIRE_FALSE(input_state.IsHeld(key));
+  REQUIRE(input_state.HasEdges());
+
+  // a key repeat is not a new press
+  input_state.ApplyEvent(KeyPressed(key));
+  input_state.Snapshot();
+  REQUIRE(input_state.IsHeld(key));
+  REQUIRE_FALSE(input_state.IsPressed(key));
+  REQUIRE_FALSE(input_state.HasEdges());
+
+  input_state.ApplyEvent(KeyReleased(key));
+  input_state.Snapshot();
+  REQUIRE(input_state.IsReleased(key));
+  REQUIRE_FALSE(input_state.IsDown(key));
+  REQUIRE_FALSE(input_state.IsHeld(key));
+
+  input_state.Snapshot();
+  REQUIRE_FALSE(input_state.IsReleased(key));
+  REQUIRE(input_state.GetDown().none());
+}
+
+TEST_CASE("InputState keeps a tap down for one snapshot", "[InputState]") {
+  steamrot::InputState input_state;
+  const auto button = sf::Mouse::Button::Left;
+
+  input_state.ApplyEvent(sf::Event::MouseButtonPressed{button, {0, 0}});
+  input_state.ApplyEvent(sf::Event::MouseButtonReleased{button, {0, 0}});
+
+  input_state.Snapshot();
+  REQUIRE(input_state.IsPressed(button));
+
+  input_state.Snapshot();
+  REQUIRE(input_state.IsReleased(button));
+}
+
+TEST_CASE("InputState ignores other events and releases everything on focus "
+          "loss",
+          "[InputState]") {
+  steamrot::InputState input_state;
+
+  REQUIRE_FALSE(input_state.ApplyEvent(sf::Event::Closed{}));
+  // an unknown key is input without a bit
+  REQUIRE(input_state.ApplyEvent(KeyPressed(sf::Keyboard::Key::Unknown)));
+  input_state.Snapshot();
+  REQUIRE(input_state.GetDown().none());
+
+  input_state.ApplyEvent(KeyPressed(sf::Keyboard::Key::A));
+  input_state.Snapshot();
+  REQUIRE_FALSE(input_state.ApplyEvent(sf::Event::FocusLost{}));
+  input_state.Snapshot();
+  REQUIRE(input_state.IsReleased(sf::Keyboard::Key::A));
+}
+
+TEST_CASE("InputState edges round trip through a user input event",
+          "[InputState]") {
+  steamrot::InputState input_state;
+  input_state.ApplyEvent(KeyPressed(sf::Keyboard::Key::A));
+  input_state.ApplyEvent(sf::Event::MouseButtonPressed{
+      sf::Mouse::Button::Right, {0, 0}});
+  input_state.Snapshot();
+  input_state.ApplyEvent(KeyReleased(sf::Keyboard::Key::A));
+  input_state.Snapshot();
+
+  // same layout as a user input event built from window events
+  steamrot::UserInputBitset expected_edges;
+  expected_edges.setKeyReleased(sf::Keyboard::Key::A);
+  REQUIRE(input_state.GetEdges() == expected_edges);
+
+  // applying the edges of each snapshot reproduces the state
+  steamrot::InputState replayed_state;
+  steamrot::UserInputBitset first_edges;
+  first_edges.setKeyPressed(sf::Keyboard::Key::A);
+  first_edges.setMousePressed(sf::Mouse::Button::Right);
+  replayed_state.ApplyUserInput(first_edges);
+  replayed_state.Snapshot();
+  replayed_state.ApplyUserInput(expected_edges);
+  replayed_state.Snapshot();
+  REQUIRE(replayed_state.GetDown() == input_state.GetDown());
+  REQUIRE(replayed_state.GetReleased() == input_state.GetReleased());
+  REQUIRE(replayed_state.IsHeld(sf::Mouse::Button::Right));
+}
+
+TEST_CASE("EventHandler::PreloadEvents publishes user input only on edges",
+          "[InputState]") {
+  steamrot::EventHandler event_handler;
+  steamrot::InputState input_state;
+  const sf::Vector2i mouse_position{0, 0};
+
+  input_state.ApplyEvent(KeyPressed(sf::Keyboard::Key::Space));
+  input_state.Snapshot();
+  event_handler.PreloadEvents(input_state, mouse_position);
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().size() == 1);
+
+  const steamrot::EventPacket &event = event_handler.GetGlobalEventBus()[0];
+  REQUIRE(event.m_event_type ==
+          steamrot::EventType::EventType_EVENT_USER_INPUT);
+  REQUIRE(std::get<steamrot::UserInputBitset>(event.m_event_data) ==
+          input_state.GetEdges());
+  event_handler.TickGlobalEventBus();
+
+  // holding the key publishes nothing
+  input_state.Snapshot();
+  event_handler.PreloadEvents(input_state, mouse_position);
+  event_handler.ProcessWaitingRoomEventBus();
+  REQUIRE(event_handler.GetGlobalEventBus().empty());
+}
@@ -0,0 +1,49 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the InternedString class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "EventPacket.h"
+#include "InternedString.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+TEST_CASE("InternedString shares one entry per distinct text",
+          "[InternedString]") {
+
+  const steamrot::InternedString first{"InternedString.test::button"};
+  const size_t interned_count = steamrot::InternedString::GetInternedCount();
+
+  // interning the same text again adds nothing and compares equal
+  const std::string same_text{"InternedString.test::button"};
+  const steamrot::InternedString second{same_text};
+  REQUIRE(steamrot::InternedString::GetInternedCount() == interned_count);
+  REQUIRE(first == second);
+  REQUIRE(&first.Get() == &second.Get());
+  REQUIRE(first.Get() == "InternedString.test::button");
+
+  const steamrot::InternedString other{"InternedString.test::panel"};
+  REQUIRE(steamrot::InternedString::GetInternedCount() == interned_count + 1);
+  REQUIRE_FALSE(first == other);
+}
+
+TEST_CASE("InternedString defaults to the empty string", "[InternedString]") {
+
+  const steamrot::InternedString empty;
+  REQUIRE(empty.Get().empty());
+  REQUIRE(empty == steamrot::InternedString{""});
+}
+
+TEST_CASE("EventData compares UIElementNames by interned entry",
+          "[InternedString]") {
+
+  const steamrot::EventData event_data =
+      steamrot::UIElementName{"InternedString.test::dropdown"};
+  const steamrot::EventData same_event_data =
+      steamrot::UIElementName{"InternedString.test::dropdown"};
+
+  REQUIRE(event_data == same_event_data);
+}
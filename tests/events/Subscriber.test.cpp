@@ -19,6 +19,10 @@ TEST_CASE("Subscriber: check functions", "[Subscriber]") {
   // check the event type
   auto registration_info = subscriber.GetRegistrationInfo();
   REQUIRE(registration_info.first == steamrot::EventType::EventType_EVENT_TEST);
+  REQUIRE(subscriber.GetEventMask() ==
+          steamrot::EventType::EventType_EVENT_TEST);
+  REQUIRE(subscriber.GetTriggeredEventType() ==
+          steamrot::EventType::EventType_NONE);
   REQUIRE(std::holds_alternative<std::monostate>(
       registration_info.second)); // check the event data is monostate
 
@@ -25,9 +25,8 @@ TEST_CASE("SubscriberFactory::CreateAndRegisterSubscriber creates a subscriber "
   const steamrot::EventType event_type =
       steamrot::EventType::EventType_EVENT_USER_INPUT;
 
-  // check that the EventHandler UserInput register is empty initially
-  auto &subscriber_register = mock_event_handler.GetSubcriberRegister();
-  REQUIRE(subscriber_register.empty());
+  // check that the EventHandler has no subscribers initially
+  REQUIRE(mock_event_handler.GetSubscriberCount() == 0);
 
   // create and register a Subscriber
   auto create_result = factory.CreateAndRegisterSubscriber(event_type);
@@ -35,11 +34,10 @@ TEST_CASE("SubscriberFactory::CreateAndRegisterSubscriber creates a subscriber "
     FAIL(create_result.error().message);
 
   // check that the Subscriber was created successfully
-  REQUIRE(!subscriber_register.empty());
-  REQUIRE(subscriber_register.size() == 1);
-  REQUIRE(subscriber_register.at(event_type).size() == 1);
-  REQUIRE(create_result.value() ==
-          subscriber_register.at(event_type)[0].lock());
+  REQUIRE(mock_event_handler.GetSubscriberCount() == 1);
+  REQUIRE(mock_event_handler.GetSubscriberCount(event_type) == 1);
+  REQUIRE(mock_event_handler.IsSubscriberValid(
+      create_result.value()->GetHandle()));
 }
 
 TEST_CASE(
@@ -59,18 +57,16 @@ TEST_CASE(
   const steamrot::EventData trigger_data =
       steamrot::UserInputBitset{{key_event}};
 
-  // check that the EventHandler UserInput register is empty initially
-  auto &subscriber_register = mock_event_handler.GetSubcriberRegister();
-  REQUIRE(subscriber_register.empty());
+  // check that the EventHandler has no subscribers initially
+  REQUIRE(mock_event_handler.GetSubscriberCount() == 0);
   // create and register a Subscriber
   auto create_result =
       factory.CreateAndRegisterSubscriber(event_type, trigger_data);
   if (!create_result.has_value())
     FAIL(create_result.error().message);
   // check that the Subscriber was created successfully
-  REQUIRE(!subscriber_register.empty());
-  REQUIRE(subscriber_register.size() == 1);
-  REQUIRE(subscriber_register.at(event_type).size() == 1);
-  REQUIRE(create_result.value() ==
-          subscriber_register.at(event_type)[0].lock());
+  REQUIRE(mock_event_handler.GetSubscriberCount() == 1);
+  REQUIRE(mock_event_handler.GetSubscriberCount(event_type) == 1);
+  REQUIRE(mock_event_handler.IsSubscriberValid(
+      create_result.value()->GetHandle()));
 }
@@ -0,0 +1,109 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the TriggerMatcher class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "TriggerMatcher.h"
+#include "EventPacket.h"
+#include "UserInputBitset.h"
+#include <SFML/Window/Keyboard.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <variant>
+
+TEST_CASE("TriggerMatcher without trigger data matches anything",
+          "[TriggerMatcher]") {
+  const steamrot::TriggerMatcher matcher;
+
+  REQUIRE(matcher.Matches(std::monostate{}));
+  REQUIRE(matcher.Matches(steamrot::UIElementName{"button"}));
+  REQUIRE_FALSE(matcher.GetKey().has_value());
+}
+
+TEST_CASE("TriggerMatcher compares user input exactly, or by any or all of its "
+          "inputs",
+          "[TriggerMatcher]") {
+  steamrot::UserInputBitset a_and_b;
+  a_and_b.setKeyPressed(sf::Keyboard::Key::A);
+  a_and_b.setKeyPressed(sf::Keyboard::Key::B);
+
+  steamrot::UserInputBitset only_a;
+  only_a.setKeyPressed(sf::Keyboard::Key::A);
+
+  steamrot::UserInputBitset a_b_and_w = a_and_b;
+  a_b_and_w.setKeyPressed(sf::Keyboard::Key::W);
+
+  steamrot::UserInputBitset only_w;
+  only_w.setKeyPressed(sf::Keyboard::Key::W);
+
+  SECTION("Exact") {
+    const steamrot::TriggerMatcher matcher{a_and_b};
+    REQUIRE(matcher.Matches(a_and_b));
+    REQUIRE_FALSE(matcher.Matches(only_a));
+    REQUIRE_FALSE(matcher.Matches(a_b_and_w));
+    REQUIRE(matcher.GetKey() == steamrot::GetTriggerKey(a_and_b));
+  }
+
+  SECTION("AnyOf") {
+    const steamrot::TriggerMatcher matcher{a_and_b,
+                                           steamrot::TriggerMode::AnyOf};
+    REQUIRE(matcher.Matches(a_and_b));
+    REQUIRE(matcher.Matches(only_a));
+    REQUIRE(matcher.Matches(a_b_and_w));
+    REQUIRE_FALSE(matcher.Matches(only_w));
+    REQUIRE_FALSE(matcher.GetKey().has_value());
+  }
+
+  SECTION("AllOf") {
+    const steamrot::TriggerMatcher matcher{a_and_b,
+                                           steamrot::TriggerMode::AllOf};
+    REQUIRE(matcher.Matches(a_and_b));
+    REQUIRE_FALSE(matcher.Matches(only_a));
+    REQUIRE(matcher.Matches(a_b_and_w));
+    REQUIRE_FALSE(matcher.Matches(only_w));
+    REQUIRE_FALSE(matcher.GetKey().has_value());
+  }
+
+  // other event data never matches user input
+  const steamrot::TriggerMatcher matcher{a_and_b,
+                                         steamrot::TriggerMode::AnyOf};
+  REQUIRE_FALSE(matcher.Matches(std::monostate{}));
+}
+
+TEST_CASE("TriggerMatcher compares names and scene changes exactly",
+          "[TriggerMatcher]") {
+  const steamrot::TriggerMatcher name_matcher{
+      steamrot::UIElementName{"start_button"}};
+  REQUIRE(name_matcher.Matches(steamrot::UIElementName{"start_button"}));
+  REQUIRE_FALSE(name_matcher.Matches(steamrot::UIElementName{"quit_button"}));
+  REQUIRE(name_matcher.GetKey() ==
+          steamrot::GetTriggerKey(steamrot::UIElementName{"start_button"}));
+
+  // modes other than Exact only apply to user input
+  const steamrot::TriggerMatcher any_name_matcher{
+      steamrot::UIElementName{"start_button"}, steamrot::TriggerMode::AnyOf};
+  REQUIRE(any_name_matcher.GetKey().has_value());
+
+  const steamrot::SceneChangePacket title_scene{std::nullopt,
+                                                steamrot::SceneType_TITLE};
+  const steamrot::TriggerMatcher scene_matcher{title_scene};
+  REQUIRE(scene_matcher.Matches(title_scene));
+  REQUIRE_FALSE(scene_matcher.Matches(steamrot::SceneChangePacket{
+      std::nullopt, steamrot::SceneType_CRAFTING}));
+  REQUIRE_FALSE(scene_matcher.Matches(std::monostate{}));
+}
+
+TEST_CASE("GetTriggerKey is equal for equal event data", "[TriggerMatcher]") {
+  REQUIRE(steamrot::GetTriggerKey(steamrot::UIElementName{"button"}) ==
+          steamrot::GetTriggerKey(steamrot::UIElementName{"button"}));
+  REQUIRE(steamrot::GetTriggerKey(std::monostate{}) ==
+          steamrot::GetTriggerKey(std::monostate{}));
+
+  steamrot::UserInputBitset input;
+  input.setKeyPressed(sf::Keyboard::Key::A);
+  steamrot::UserInputBitset same_input;
+  same_input.setKeyPressed(sf::Keyboard::Key::A);
+  REQUIRE(steamrot::GetTriggerKey(input) == steamrot::GetTriggerKey(same_input));
+}
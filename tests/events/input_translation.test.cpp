@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the input translation tables
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "input_translation.h"
+#include "UserInputBitset.h"
+#include "event_helpers.h"
+#include "user_input_generated.h"
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <flatbuffers/flatbuffers.h>
+#include <string>
+#include <vector>
+
+using namespace steamrot;
+
+namespace {
+/////////////////////////////////////////////////
+const UserInputBitsetData *
+BuildUserInputBitsetData(flatbuffers::FlatBufferBuilder &builder,
+                         const std::vector<uint8_t> &keyboard_pressed,
+                         const std::vector<uint8_t> &keyboard_released,
+                         const std::vector<uint8_t> &mouse_pressed,
+                         const std::vector<uint8_t> &mouse_released) {
+  auto data = CreateUserInputBitsetDataDirect(
+      builder, &keyboard_pressed, &keyboard_released, &mouse_pressed,
+      &mouse_released);
+  builder.Finish(data);
+  return flatbuffers::GetRoot<UserInputBitsetData>(
+      builder.GetBufferPointer());
+}
+} // namespace
+
+TEST_CASE("Every KeyboardInput maps to the SFML key of the same letter",
+          "[input_translation]") {
+  for (size_t index = 0; index < kKeyboardInputCount; index++) {
+    KeyboardInput keyboard_input = static_cast<KeyboardInput>(index);
+    REQUIRE(std::string(EnumNameKeyboardInput(keyboard_input)) ==
+            std::string(1, static_cast<char>('A' + index)));
+    REQUIRE(static_cast<size_t>(ToSFMLKey(static_cast<uint8_t>(index))) ==
+            index);
+  }
+  REQUIRE(ToSFMLKey(static_cast<uint8_t>(kKeyboardInputCount)) == sf::Keyboard::Key::Unknown);
+}
+
+TEST_CASE("MouseInput maps clicks to buttons and scrolling to nothing",
+          "[input_translation]") {
+  REQUIRE(ToSFMLButton(MouseInput_LEFT_CLICK) == sf::Mouse::Button::Left);
+  REQUIRE(ToSFMLButton(MouseInput_RIGHT_CLICK) == sf::Mouse::Button::Right);
+  REQUIRE(ToSFMLButton(MouseInput_MIDDLE_CLICK) == sf::Mouse::Button::Middle);
+  REQUIRE_FALSE(ToSFMLButton(MouseInput_SCROLL_UP).has_value());
+  REQUIRE_FALSE(ToSFMLButton(MouseInput_SCROLL_DOWN).has_value());
+  REQUIRE_FALSE(ToSFMLButton(static_cast<uint8_t>(kMouseInputCount)).has_value());
+}
+
+TEST_CASE("ConvertFBDataToUserInputBitset sets a bit per input",
+          "[input_translation]") {
+  flatbuffers::FlatBufferBuilder builder;
+  const UserInputBitsetData *data = BuildUserInputBitsetData(
+      builder, {KeyboardInput_I, KeyboardInput_W}, {KeyboardInput_J},
+      {MouseInput_LEFT_CLICK}, {MouseInput_RIGHT_CLICK});
+
+  auto result = ConvertFBDataToUserInputBitset(*data);
+  REQUIRE(result.has_value());
+
+  UserInputBitset expected;
+  expected.setKeyPressed(sf::Keyboard::Key::I);
+  expected.setKeyPressed(sf::Keyboard::Key::W);
+  expected.setKeyReleased(sf::Keyboard::Key::J);
+  expected.setMousePressed(sf::Mouse::Button::Left);
+  expected.setMouseReleased(sf::Mouse::Button::Right);
+  REQUIRE(result.value() == expected);
+}
+
+TEST_CASE("ConvertFBDataToUserInputBitset fails on inputs SFML lacks",
+          "[input_translation]") {
+  flatbuffers::FlatBufferBuilder builder;
+  const UserInputBitsetData *data = BuildUserInputBitsetData(
+      builder, {KeyboardInput_A}, {}, {MouseInput_SCROLL_UP}, {});
+
+  auto result = ConvertFBDataToUserInputBitset(*data);
+  REQUIRE_FALSE(result.has_value());
+  REQUIRE(result.error().mode == FailMode::NonExistentEnumValue);
+}
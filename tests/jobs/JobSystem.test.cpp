@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the JobSystem class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "JobSystem.h"
+#include "WorkStealingQueue.h"
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <vector>
+
+TEST_CASE("WorkStealingQueue pops newest and steals oldest", "[JobSystem]") {
+
+  steamrot::WorkStealingQueue queue;
+  std::vector<int> order;
+
+  for (int i = 0; i < 3; ++i) {
+    queue.Push([&order, i]() { order.push_back(i); });
+  }
+
+  (*queue.Pop())();
+  (*queue.Steal())();
+  (*queue.Pop())();
+
+  REQUIRE(order == std::vector<int>{2, 0, 1});
+  REQUIRE(queue.IsEmpty());
+  REQUIRE_FALSE(queue.Pop().has_value());
+  REQUIRE_FALSE(queue.Steal().has_value());
+}
+
+TEST_CASE("JobSystem runs every submitted job before Wait returns",
+          "[JobSystem]") {
+
+  // zero workers means the waiting thread has to run everything itself
+  const size_t worker_count = GENERATE(0, 1, 4);
+  steamrot::JobSystem job_system(worker_count);
+  REQUIRE(job_system.GetWorkerCount() == worker_count);
+
+  std::vector<size_t> results(1000, 0);
+  steamrot::JobCounter counter;
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    job_system.Submit([&results, i]() { results[i] = i * 2; }, counter);
+  }
+  job_system.Wait(counter);
+
+  REQUIRE(counter.pending.load() == 0);
+  for (size_t i = 0; i < results.size(); ++i) {
+    REQUIRE(results[i] == i * 2);
+  }
+}
+
+TEST_CASE("JobSystem jobs can submit and wait on nested batches",
+          "[JobSystem]") {
+
+  const size_t worker_count = GENERATE(0, 2);
+  steamrot::JobSystem job_system(worker_count);
+
+  std::atomic<size_t> total{0};
+  steamrot::JobCounter outer_counter;
+
+  for (size_t i = 0; i < 8; ++i) {
+    job_system.Submit(
+        [&job_system, &total]() {
+          steamrot::JobCounter inner_counter;
+          for (size_t j = 0; j < 16; ++j) {
+            job_system.Submit([&total]() { ++total; }, inner_counter);
+          }
+          job_system.Wait(inner_counter);
+        },
+        outer_counter);
+  }
+  job_system.Wait(outer_counter);
+
+  REQUIRE(total.load() == 8 * 16);
+}
+
+TEST_CASE("JobSystem::IsRunningJob is only true inside a job", "[JobSystem]") {
+
+  const size_t worker_count = GENERATE(0, 2);
+  steamrot::JobSystem job_system(worker_count);
+
+  REQUIRE_FALSE(steamrot::JobSystem::IsRunningJob());
+
+  std::atomic<size_t> running_count{0};
+  steamrot::JobCounter counter;
+  for (size_t i = 0; i < 16; ++i) {
+    job_system.Submit(
+        [&running_count]() {
+          if (steamrot::JobSystem::IsRunningJob()) {
+            ++running_count;
+          }
+        },
+        counter);
+  }
+  job_system.Wait(counter);
+
+  REQUIRE(running_count.load() == 16);
+  REQUIRE_FALSE(steamrot::JobSystem::IsRunningJob());
+}
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the ErrorLogBuffer class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ErrorLogBuffer.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+TEST_CASE("ErrorLogBuffer returns records oldest first and empties",
+          "[ErrorLogBuffer]") {
+  steamrot::ErrorLogBuffer error_log_buffer;
+  REQUIRE(error_log_buffer.GetSize() == 0);
+
+  error_log_buffer.Push(steamrot::log_handler::LogCode::kFileNotFound,
+                        "first");
+  error_log_buffer.Push(steamrot::log_handler::LogCode::kNoCode, "second");
+  REQUIRE(error_log_buffer.GetSize() == 2);
+
+  size_t dropped_count{1};
+  auto records = error_log_buffer.TakeRecords(dropped_count);
+  REQUIRE(dropped_count == 0);
+  REQUIRE(records.size() == 2);
+  REQUIRE(records[0].GetMessage() == "first");
+  REQUIRE(records[0].code == steamrot::log_handler::LogCode::kFileNotFound);
+  REQUIRE(records[1].GetMessage() == "second");
+  REQUIRE(records[0].time <= records[1].time);
+
+  REQUIRE(error_log_buffer.GetSize() == 0);
+  REQUIRE(error_log_buffer.TakeRecords(dropped_count).empty());
+}
+
+TEST_CASE("ErrorLogBuffer overwrites the oldest records when full",
+          "[ErrorLogBuffer]") {
+  steamrot::ErrorLogBuffer error_log_buffer;
+
+  const size_t extra_records = 3;
+  for (size_t index = 0; index < steamrot::kErrorLogCapacity + extra_records;
+       index++) {
+    error_log_buffer.Push(steamrot::log_handler::LogCode::kNoCode,
+                          std::to_string(index));
+  }
+  REQUIRE(error_log_buffer.GetSize() == steamrot::kErrorLogCapacity);
+
+  size_t dropped_count{0};
+  auto records = error_log_buffer.TakeRecords(dropped_count);
+  REQUIRE(dropped_count == extra_records);
+  REQUIRE(records.size() == steamrot::kErrorLogCapacity);
+  REQUIRE(records.front().GetMessage() == std::to_string(extra_records));
+  REQUIRE(records.back().GetMessage() ==
+          std::to_string(steamrot::kErrorLogCapacity + extra_records - 1));
+
+  // the dropped count resets once reported
+  error_log_buffer.Push(steamrot::log_handler::LogCode::kNoCode, "after");
+  records = error_log_buffer.TakeRecords(dropped_count);
+  REQUIRE(dropped_count == 0);
+  REQUIRE(records.size() == 1);
+}
+
+TEST_CASE("ErrorLogBuffer truncates long messages", "[ErrorLogBuffer]") {
+  steamrot::ErrorLogBuffer error_log_buffer;
+
+  const std::string long_message(steamrot::kErrorMessageCapacity + 10, 'x');
+  error_log_buffer.Push(steamrot::log_handler::LogCode::kNoCode, long_message);
+
+  size_t dropped_count{0};
+  auto records = error_log_buffer.TakeRecords(dropped_count);
+  REQUIRE(records.size() == 1);
+  REQUIRE(records[0].GetMessage() ==
+          std::string_view{long_message}.substr(
+              0, steamrot::kErrorMessageCapacity));
+}
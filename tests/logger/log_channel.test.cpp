@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the channel loggers
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "log_channel.h"
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief Put every channel back to its default level
+/////////////////////////////////////////////////
+void ResetChannelLevels() {
+  for (size_t index = 0; index < steamrot::kLogChannelCount; index++) {
+    steamrot::SetChannelLevel(static_cast<steamrot::LogChannel>(index),
+                              steamrot::kDefaultChannelLevel);
+  }
+}
+
+/////////////////////////////////////////////////
+spdlog::level::level_enum GetLevel(steamrot::LogChannel channel) {
+  return steamrot::GetChannelLogger(channel).level();
+}
+} // namespace
+
+TEST_CASE("Channel loggers start at the default level", "[log_channel]") {
+  ResetChannelLevels();
+
+  for (size_t index = 0; index < steamrot::kLogChannelCount; index++) {
+    const auto channel = static_cast<steamrot::LogChannel>(index);
+    REQUIRE(GetLevel(channel) == steamrot::kDefaultChannelLevel);
+    REQUIRE(steamrot::GetChannelLogger(channel).name() ==
+            steamrot::kLogChannelNames[index]);
+  }
+}
+
+TEST_CASE("SetChannelLevels sets the listed channels", "[log_channel]") {
+  ResetChannelLevels();
+
+  auto result = steamrot::SetChannelLevels("events=trace,ui=debug");
+  REQUIRE(result.has_value());
+  REQUIRE(GetLevel(steamrot::LogChannel::Events) == spdlog::level::trace);
+  REQUIRE(GetLevel(steamrot::LogChannel::UI) == spdlog::level::debug);
+  REQUIRE(GetLevel(steamrot::LogChannel::Display) ==
+          steamrot::kDefaultChannelLevel);
+
+  result = steamrot::SetChannelLevels("all=warn");
+  REQUIRE(result.has_value());
+  for (size_t index = 0; index < steamrot::kLogChannelCount; index++) {
+    REQUIRE(GetLevel(static_cast<steamrot::LogChannel>(index)) ==
+            spdlog::level::warn);
+  }
+
+  ResetChannelLevels();
+}
+
+TEST_CASE("SetChannelLevels changes nothing when an entry is invalid",
+          "[log_channel]") {
+  ResetChannelLevels();
+
+  SECTION("Unknown channel") {
+    auto result = steamrot::SetChannelLevels("events=trace,sound=debug");
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().mode == steamrot::FailMode::NonExistentEnumValue);
+  }
+
+  SECTION("Unknown level") {
+    auto result = steamrot::SetChannelLevels("events=trace,ui=loud");
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().mode == steamrot::FailMode::NonExistentEnumValue);
+  }
+
+  SECTION("Missing level") {
+    auto result = steamrot::SetChannelLevels("events=trace,ui");
+    REQUIRE_FALSE(result.has_value());
+    REQUIRE(result.error().mode == steamrot::FailMode::ParameterOutOfBounds);
+  }
+
+  REQUIRE(GetLevel(steamrot::LogChannel::Events) ==
+          steamrot::kDefaultChannelLevel);
+}
+
+TEST_CASE("Log macros only evaluate their arguments when the channel is on",
+          "[log_channel]") {
+  ResetChannelLevels();
+
+  int evaluations = 0;
+  auto count_evaluation = [&evaluations]() { return ++evaluations; };
+
+  STEAMROT_LOG_TRACE(steamrot::LogChannel::Events, "value={}",
+                     count_evaluation());
+  REQUIRE(evaluations == 0);
+
+  steamrot::SetChannelLevel(steamrot::LogChannel::Events, spdlog::level::off);
+  STEAMROT_LOG_ERROR(steamrot::LogChannel::Events, "value={}",
+                     count_evaluation());
+  REQUIRE(evaluations == 0);
+
+  // error is compiled in at every STEAMROT_LOG_LEVEL
+  steamrot::SetChannelLevel(steamrot::LogChannel::Events, spdlog::level::err);
+  STEAMROT_LOG_ERROR(steamrot::LogChannel::Events, "value={}",
+                     count_evaluation());
+  REQUIRE(evaluations == 1);
+
+  steamrot::FlushChannelLoggers();
+  ResetChannelLevels();
+}
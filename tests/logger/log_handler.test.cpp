@@ -0,0 +1,55 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the log_handler functions
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ErrorLogBuffer.h"
+#include "log_handler.h"
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief Empty the shared error log so tests start clean
+/////////////////////////////////////////////////
+void ClearErrorLog() {
+  size_t dropped_count{0};
+  steamrot::log_handler::GetErrorLogBuffer().TakeRecords(dropped_count);
+}
+} // namespace
+
+TEST_CASE("ProcessErrorLog buffers the error without throwing",
+          "[log_handler]") {
+  ClearErrorLog();
+
+  REQUIRE_NOTHROW(steamrot::log_handler::ProcessLog(
+      spdlog::level::err, steamrot::log_handler::LogCode::kNoCode,
+      "recoverable"));
+  REQUIRE_NOTHROW(steamrot::log_handler::ProcessErrorLog(
+      steamrot::log_handler::LogCode::kNoCode, "also recoverable"));
+  REQUIRE(steamrot::log_handler::GetErrorLogBuffer().GetSize() == 2);
+
+  // without a global logger the errors wait in the buffer
+  steamrot::log_handler::FlushErrorLog();
+  REQUIRE(steamrot::log_handler::GetErrorLogBuffer().GetSize() == 2);
+
+  ClearErrorLog();
+}
+
+TEST_CASE("ProcessFatalLog records the error and throws", "[log_handler]") {
+  ClearErrorLog();
+
+  REQUIRE_THROWS_AS(steamrot::log_handler::ProcessFatalLog(
+                        steamrot::log_handler::LogCode::kNoCode, "fatal"),
+                    std::runtime_error);
+  REQUIRE_THROWS_AS(steamrot::log_handler::ProcessLog(
+                        spdlog::level::critical,
+                        steamrot::log_handler::LogCode::kNoCode, "fatal"),
+                    std::runtime_error);
+  REQUIRE(steamrot::log_handler::GetErrorLogBuffer().GetSize() == 2);
+
+  ClearErrorLog();
+}
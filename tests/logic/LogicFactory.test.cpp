@@ -96,3 +96,48 @@ TEST_CASE("LogicFactory creates correct Logic instances for CraftingScene",
   steamrot::tests::CheckStaticLogicCollections(
       logic_collection, steamrot::SceneType::SceneType_CRAFTING);
 }
+
+TEST_CASE("LogicFactory builds LogicSchedules for CraftingScene",
+          "[LogicFactory]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  steamrot::tests::TestContext test_context{
+      steamrot::SceneType::SceneType_CRAFTING};
+  // create a LogicFactory instance
+  steamrot::LogicFactory logic_factory(
+      steamrot::SceneType::SceneType_CRAFTING,
+      test_context.GetLogicContextForCraftingScene());
+
+  auto logic_schedules_result = logic_factory.CreateLogicSchedules();
+  if (!logic_schedules_result.has_value()) {
+    FAIL("LogicFactory failed to create logic schedules: " +
+         logic_schedules_result.error().message);
+  }
+
+  steamrot::tests::CheckStaticLogicSchedules(
+      logic_schedules_result.value(), steamrot::SceneType::SceneType_CRAFTING);
+}
+
+TEST_CASE("LogicFactory creates no Render Logic when headless",
+          "[LogicFactory]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  steamrot::tests::TestContext test_context{
+      steamrot::SceneType::SceneType_CRAFTING};
+  // create a headless LogicFactory instance
+  steamrot::LogicFactory logic_factory(
+      steamrot::SceneType::SceneType_CRAFTING,
+      test_context.GetLogicContextForCraftingScene(),
+      steamrot::DisplayMode::Headless);
+
+  auto logic_schedules_result = logic_factory.CreateLogicSchedules();
+  if (!logic_schedules_result.has_value()) {
+    FAIL("LogicFactory failed to create logic schedules: " +
+         logic_schedules_result.error().message);
+  }
+
+  REQUIRE(logic_schedules_result.value().render_schedule.IsEmpty());
+  REQUIRE(logic_schedules_result.value()
+              .update_schedule.GetExecutionOrder()
+              .size() == 3);
+}
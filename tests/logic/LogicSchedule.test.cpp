@@ -0,0 +1,189 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for LogicSchedule class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "LogicSchedule.h"
+#include "ArchetypeHelpers.h"
+#include "TestContext.h"
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <memory>
+
+namespace {
+/////////////////////////////////////////////////
+/// @brief Logic that only counts how often it has run
+/////////////////////////////////////////////////
+class CountingLogic : public steamrot::Logic {
+private:
+  std::atomic<size_t> &m_run_count;
+
+  void ProcessLogic() override { ++m_run_count; }
+
+public:
+  CountingLogic(const steamrot::LogicContext logic_context,
+                const steamrot::ComponentAccess &component_access,
+                std::atomic<size_t> &run_count)
+      : Logic(logic_context), m_run_count(run_count) {
+    m_component_access = component_access;
+  }
+};
+
+/////////////////////////////////////////////////
+/// @brief CountingLogic types that can name each other in RunAfter
+/////////////////////////////////////////////////
+class FirstLogic;
+class SecondLogic;
+
+class FirstLogic : public CountingLogic {
+public:
+  FirstLogic(const steamrot::LogicContext logic_context,
+             std::atomic<size_t> &run_count, bool after_second = false)
+      : CountingLogic(logic_context, {}, run_count) {
+    if (after_second) {
+      RunAfter<SecondLogic>();
+    }
+  }
+};
+
+class SecondLogic : public CountingLogic {
+public:
+  SecondLogic(const steamrot::LogicContext logic_context,
+              std::atomic<size_t> &run_count, bool after_first = false)
+      : CountingLogic(logic_context, {}, run_count) {
+    if (after_first) {
+      RunAfter<FirstLogic>();
+    }
+  }
+};
+} // namespace
+
+TEST_CASE("ComponentAccess only conflicts on shared writes or resources",
+          "[LogicSchedule]") {
+
+  const ArchetypeID ui_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface>();
+  const ArchetypeID ui_state_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUIState>();
+
+  steamrot::ComponentAccess ui_reader{.reads = ui_id};
+  steamrot::ComponentAccess ui_writer{.writes = ui_id};
+  steamrot::ComponentAccess ui_state_writer{.writes = ui_state_id};
+  steamrot::ComponentAccess event_writer{.writes_event_bus = true};
+
+  REQUIRE_FALSE(ui_reader.ConflictsWith(ui_reader));
+  REQUIRE(ui_reader.ConflictsWith(ui_writer));
+  REQUIRE(ui_writer.ConflictsWith(ui_reader));
+  REQUIRE_FALSE(ui_writer.ConflictsWith(ui_state_writer));
+  REQUIRE(event_writer.ConflictsWith(event_writer));
+  REQUIRE_FALSE(event_writer.ConflictsWith(ui_writer));
+}
+
+TEST_CASE("LogicSchedule groups non conflicting Logics into stages",
+          "[LogicSchedule]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  steamrot::tests::TestContext test_context;
+  const steamrot::LogicContext &logic_context =
+      test_context.GetLogicContextForTestScene();
+
+  const ArchetypeID ui_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface>();
+  const ArchetypeID ui_state_id =
+      steamrot::GenerateArchetypeIDfromTypes<steamrot::CUIState>();
+
+  std::atomic<size_t> run_count{0};
+  steamrot::LogicVector logics;
+
+  // 0 and 1 write different components, 2 reads what 0 writes, 3 draws what 1
+  // writes
+  logics.push_back(std::make_unique<CountingLogic>(
+      logic_context, steamrot::ComponentAccess{.writes = ui_id}, run_count));
+  logics.push_back(std::make_unique<CountingLogic>(
+      logic_context, steamrot::ComponentAccess{.writes = ui_state_id},
+      run_count));
+  logics.push_back(std::make_unique<CountingLogic>(
+      logic_context, steamrot::ComponentAccess{.reads = ui_id}, run_count));
+  logics.push_back(std::make_unique<CountingLogic>(
+      logic_context,
+      steamrot::ComponentAccess{.reads = ui_state_id,
+                                .uses_scene_texture = true},
+      run_count));
+
+  std::vector<steamrot::Logic *> declared;
+  for (const auto &logic : logics) {
+    declared.push_back(logic.get());
+  }
+
+  auto build_result = steamrot::LogicSchedule::Build(std::move(logics));
+  if (!build_result.has_value()) {
+    FAIL(build_result.error().message);
+  }
+  steamrot::LogicSchedule &schedule = build_result.value();
+
+  REQUIRE(schedule.GetStageCount() == 2);
+  REQUIRE(schedule.GetStage(0).size() == 2);
+  REQUIRE(schedule.GetStage(0)[0] == declared[0]);
+  REQUIRE(schedule.GetStage(0)[1] == declared[1]);
+  REQUIRE(schedule.GetStage(1).size() == 2);
+  REQUIRE(schedule.GetStage(1)[0] == declared[2]);
+  REQUIRE(schedule.GetStage(1)[1] == declared[3]);
+
+  // every Logic runs exactly once, with or without workers
+  const size_t worker_count = GENERATE(0, 2);
+  steamrot::JobSystem job_system(worker_count);
+  schedule.Run(job_system);
+  REQUIRE(run_count.load() == declared.size());
+}
+
+TEST_CASE("LogicSchedule applies RunAfter over declared order",
+          "[LogicSchedule]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  steamrot::tests::TestContext test_context;
+  const steamrot::LogicContext &logic_context =
+      test_context.GetLogicContextForTestScene();
+
+  std::atomic<size_t> run_count{0};
+  steamrot::LogicVector logics;
+  logics.push_back(
+      std::make_unique<FirstLogic>(logic_context, run_count, true));
+  logics.push_back(std::make_unique<SecondLogic>(logic_context, run_count));
+
+  steamrot::Logic *first = logics[0].get();
+  steamrot::Logic *second = logics[1].get();
+
+  auto build_result = steamrot::LogicSchedule::Build(std::move(logics));
+  if (!build_result.has_value()) {
+    FAIL(build_result.error().message);
+  }
+
+  // the Logics share nothing, so only the constraint separates them
+  const steamrot::LogicSchedule &schedule = build_result.value();
+  REQUIRE(schedule.GetStageCount() == 2);
+  REQUIRE(schedule.GetExecutionOrder() ==
+          std::vector<steamrot::Logic *>{second, first});
+}
+
+TEST_CASE("LogicSchedule fails on a RunAfter cycle", "[LogicSchedule]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  steamrot::tests::TestContext test_context;
+  const steamrot::LogicContext &logic_context =
+      test_context.GetLogicContextForTestScene();
+
+  std::atomic<size_t> run_count{0};
+  steamrot::LogicVector logics;
+  logics.push_back(
+      std::make_unique<FirstLogic>(logic_context, run_count, true));
+  logics.push_back(
+      std::make_unique<SecondLogic>(logic_context, run_count, true));
+
+  auto build_result = steamrot::LogicSchedule::Build(std::move(logics));
+  REQUIRE_FALSE(build_result.has_value());
+  REQUIRE(build_result.error().mode == steamrot::FailMode::DependencyCycle);
+}
@@ -8,11 +8,15 @@
 /////////////////////////////////////////////////
 #include "UIActionLogic.h"
 #include "EventPacket.h"
+#include "EventReplay.h"
 #include "Subscriber.h"
 #include "TestContext.h"
+#include "collision.h"
+#include "event_recording.h"
 #include "events_generated.h"
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <optional>
 #include <variant>
@@ -508,3 +512,62 @@ TEST_CASE("ProcessNestedUIActionsAndEvents processes parent when child has no "
           steamrot::EnumNameEventType(steamrot::EventType_EVENT_TEST));
 }
 
+TEST_CASE("A replayed click lands on the button it was recorded on",
+          "[UIActionLogic][EventReplay]") {
+  // Arrange
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  steamrot::tests::TestContext test_context;
+  steamrot::GameContext &game_context = test_context.GetGameContext();
+  steamrot::EventHandler &event_handler = game_context.event_handler;
+
+  steamrot::ButtonElement button_element;
+  button_element.position = {100.0f, 100.0f};
+  button_element.size = {200.0f, 50.0f};
+  button_element.label = "Quit Game";
+  button_element.subscription = std::make_shared<steamrot::Subscriber>(
+      steamrot::EventType_EVENT_USER_INPUT);
+  auto registration_result =
+      event_handler.RegisterSubscriber(button_element.subscription);
+  REQUIRE(registration_result);
+  button_element.response_event = steamrot::EventPacket{
+      steamrot::EventType_EVENT_QUIT_GAME, std::monostate()};
+
+  // the mouse moves onto the button, then clicks it
+  steamrot::UserInputBitset left_click;
+  left_click.setMousePressed(sf::Mouse::Button::Left);
+  steamrot::EventRecording recording;
+  recording.end_loop_number = 2;
+  recording.mouse_positions.push_back({1, sf::Vector2i{150, 120}});
+  recording.events.push_back(
+      {1, steamrot::EventPacket{steamrot::EventType_EVENT_USER_INPUT,
+                                left_click}});
+  steamrot::EventReplay event_replay{std::move(recording)};
+
+  game_context.mouse_position = {0, 0};
+  steamrot::collision::CheckMouseOverUIElement(game_context.mouse_position,
+                                               button_element);
+  REQUIRE_FALSE(button_element.is_mouse_over);
+
+  // Act - one tick, in GameEngine::UpdateSystems order
+  event_handler.PreloadEvents(event_replay, 1, game_context.input_state,
+                              game_context.mouse_position);
+  game_context.input_state.Snapshot();
+  event_handler.PreloadEvents(game_context.input_state,
+                              game_context.mouse_position);
+  event_handler.ProcessWaitingRoomEventBus();
+  event_handler.UpateSubscribersFromGlobalEventBus();
+
+  steamrot::collision::CheckMouseOverUIElement(game_context.mouse_position,
+                                               button_element);
+  steamrot::ProcessUIActionsAndEvents(
+      button_element, event_handler,
+      test_context.GetLogicContextForTestScene());
+  event_handler.ProcessWaitingRoomEventBus();
+
+  // Assert
+  REQUIRE(game_context.mouse_position == sf::Vector2i{150, 120});
+  REQUIRE(button_element.is_mouse_over);
+  const auto &event = event_handler.GetGlobalEventBus().back();
+  REQUIRE(steamrot::EnumNameEventType(event.m_event_type) ==
+          steamrot::EnumNameEventType(steamrot::EventType_EVENT_QUIT_GAME));
+}
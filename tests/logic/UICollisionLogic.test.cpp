@@ -41,8 +41,9 @@ TEST_CASE("UICollisionLogic::RunLogic changes is_mouse_over to true if mouse "
       steamrot::GenerateArchetypeIDfromTypes<steamrot::CUserInterface>();
 
   // check if the archetype exists
-  auto const it = logic_context.archetypes.find(archetype_id);
-  REQUIRE(it != logic_context.archetypes.end());
+  const auto &archetypes = logic_context.archetype_manager.GetArchetypes();
+  auto const it = archetypes.find(archetype_id);
+  REQUIRE(it != archetypes.end());
 
   // assign the archetype
   steamrot::Archetype archetype = it->second;
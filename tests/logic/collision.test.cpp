@@ -8,9 +8,11 @@
 /////////////////////////////////////////////////
 #include "collision.h"
 #include "PanelElement.h"
+#include "UISpatialIndex.h"
 #include "catch2/generators/catch_generators.hpp"
 #include <SFML/Graphics/Rect.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <memory>
 
 TEST_CASE("IsMouseOverBounds returns false for point outside bounds",
           "[collision]") {
@@ -118,3 +120,45 @@ TEST_CASE("CheckMouseOverNestedUIElement toggles parent and child elements",
   REQUIRE(child_element.is_mouse_over == false);
   REQUIRE(parent_element.is_mouse_over == false);
 }
+
+TEST_CASE("UpdateMouseOverFromIndex only flips the elements that change",
+          "[collision]") {
+  // parent with a child in the middle
+  steamrot::PanelElement parent_element;
+  parent_element.size = {200, 200};
+  parent_element.children_active = true;
+  steamrot::UIElement &child_element = parent_element.AddChildElement(
+      std::make_unique<steamrot::PanelElement>());
+  child_element.position = {50, 50};
+  child_element.size = {100, 100};
+
+  steamrot::UISpatialIndex index;
+  index.Update({&parent_element});
+
+  // mouse over the child
+  steamrot::UIElement *hovered = steamrot::collision::UpdateMouseOverFromIndex(
+      sf::Vector2i(75, 75), index, nullptr);
+  REQUIRE(hovered == &child_element);
+  REQUIRE(child_element.is_mouse_over == true);
+  REQUIRE(parent_element.is_mouse_over == false);
+
+  // mouse outside child but inside parent
+  hovered = steamrot::collision::UpdateMouseOverFromIndex(sf::Vector2i(25, 25),
+                                                          index, hovered);
+  REQUIRE(hovered == &parent_element);
+  REQUIRE(child_element.is_mouse_over == false);
+  REQUIRE(parent_element.is_mouse_over == true);
+
+  // an element that is not changing is left alone
+  child_element.is_mouse_over = true;
+  hovered = steamrot::collision::UpdateMouseOverFromIndex(sf::Vector2i(30, 30),
+                                                          index, hovered);
+  REQUIRE(child_element.is_mouse_over == true);
+  child_element.is_mouse_over = false;
+
+  // mouse outside both
+  hovered = steamrot::collision::UpdateMouseOverFromIndex(
+      sf::Vector2i(250, 250), index, hovered);
+  REQUIRE(hovered == nullptr);
+  REQUIRE(parent_element.is_mouse_over == false);
+}
@@ -12,9 +12,12 @@
 #include "ButtonElement.h"
 #include "DropDownButtonElement.h"
 #include "DropDownContainerElement.h"
+#include "DropDownItemElement.h"
 #include "DropDownListElement.h"
 #include "PanelElement.h"
+#include "UIBatch.h"
 #include "draw_ui_elements_helpers.h"
+#include "ui_layout.h"
 #include <SFML/Graphics.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
@@ -411,7 +414,8 @@ TEST_CASE("steamrot::draw_ui_elements::DrawNestedUIElements draws a unexpanded "
   auto style = asset_manager.GetDefaultUIStyle();
   // clear the RenderTexture
   render_texture.clear(sf::Color::Black);
-  // draw the DropDownContainerElement and its children on the RenderTexture
+  // size and position the children, then draw them on the RenderTexture
+  steamrot::ui_layout::LayOutUIElements(dd_container, style);
   steamrot::draw_ui_elements::DrawNestedUIElements(render_texture, dd_container,
                                                    style);
   // display the button for visual inspection
@@ -464,3 +468,130 @@ TEST_CASE("steamrot::draw_ui_elements::DrawNestedUIElements draws an expanded "
   // clear the RenderTexture
   render_texture.clear(sf::Color::Black);
 }
+
+TEST_CASE("steamrot::UIBatch draws the labels of a tree over its boxes",
+          "[draw_ui_elements]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  // create a RenderTexture
+  size_t width = 200;
+  size_t height = 200;
+  sf::RenderTexture render_texture{sf::Vector2u(
+      {static_cast<unsigned int>(width), static_cast<unsigned int>(height)})};
+
+  // create a panel holding two buttons
+  steamrot::PanelElement panel;
+  panel.position = {0.0f, 0.0f};
+  panel.size = {200.0f, 200.0f};
+  panel.children_active = true;
+  auto &first_button = static_cast<steamrot::ButtonElement &>(
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>()));
+  first_button.label = "First";
+  auto &second_button = static_cast<steamrot::ButtonElement &>(
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>()));
+  second_button.label = "Second";
+
+  // load the default UIStyle
+  steamrot::AssetManager asset_manager;
+  auto load_default_assets_result = asset_manager.LoadDefaultAssets();
+  if (!load_default_assets_result) {
+    FAIL(load_default_assets_result.error().message);
+  }
+  auto style = asset_manager.GetDefaultUIStyle();
+
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+
+  steamrot::UIBatch batch;
+  batch.Update(panel, style);
+
+  // both labels share a font and size, so one glyph page
+  REQUIRE(batch.GetTextPageCount() == 1);
+
+  // labels are not rebuilt when nothing changed
+  const uint64_t label_version = first_button.cached_label.GetVersion();
+  batch.Update(panel, style);
+  REQUIRE(first_button.cached_label.GetVersion() == label_version);
+
+  // a new label is rebuilt
+  first_button.label = "Renamed";
+  batch.Update(panel, style);
+  REQUIRE(first_button.cached_label.GetVersion() != label_version);
+
+  // clear the RenderTexture
+  render_texture.clear(sf::Color::Black);
+  batch.Draw(render_texture);
+  render_texture.display();
+
+  // get the image from the RenderTexture
+  sf::Image image = render_texture.getTexture().copyToImage();
+  steamrot::tests::TestTextIsPresent(image, first_button.position,
+                                     first_button.size,
+                                     style.button_style.text_color);
+
+  // hidden buttons draw no labels
+  panel.children_active = false;
+  batch.Update(panel, style);
+  REQUIRE(batch.GetTextPageCount() == 0);
+}
+
+TEST_CASE("steamrot::UIBatch draws the items of an expanded drop down list "
+          "over the list's label",
+          "[draw_ui_elements]") {
+
+  steamrot::PathProvider path_provider{steamrot::EnvironmentType::Test};
+  // create a RenderTexture
+  size_t width = 200;
+  size_t height = 200;
+  sf::RenderTexture render_texture{sf::Vector2u(
+      {static_cast<unsigned int>(width), static_cast<unsigned int>(height)})};
+
+  // an expanded list lays its items out from its own top left corner, over
+  // its label, as in the crafting scene
+  steamrot::DropDownListElement dd_list;
+  dd_list.position = {10.0f, 10.0f};
+  dd_list.size = {180.0f, 60.0f};
+  dd_list.is_expanded = true;
+  dd_list.children_active = true;
+  dd_list.layout = steamrot::LayoutType::LayoutType_DropDown;
+  auto &first_item = static_cast<steamrot::DropDownItemElement &>(
+      dd_list.AddChildElement(
+          std::make_unique<steamrot::DropDownItemElement>()));
+  // no label, so anything drawn inside it comes from the list
+  first_item.label = "";
+  auto &second_item = static_cast<steamrot::DropDownItemElement &>(
+      dd_list.AddChildElement(
+          std::make_unique<steamrot::DropDownItemElement>()));
+  second_item.label = "Second";
+
+  // load the default UIStyle
+  steamrot::AssetManager asset_manager;
+  auto load_default_assets_result = asset_manager.LoadDefaultAssets();
+  if (!load_default_assets_result) {
+    FAIL(load_default_assets_result.error().message);
+  }
+  auto style = asset_manager.GetDefaultUIStyle();
+
+  steamrot::ui_layout::LayOutUIElements(dd_list, style);
+  REQUIRE(first_item.position.y + first_item.size.y <= height);
+  REQUIRE(second_item.position.y + second_item.size.y <= height);
+
+  steamrot::UIBatch batch;
+  batch.Update(dd_list, style);
+
+  // clear the RenderTexture
+  render_texture.clear(sf::Color::Black);
+  batch.Draw(render_texture);
+  render_texture.display();
+
+  // get the image from the RenderTexture
+  sf::Image image = render_texture.getTexture().copyToImage();
+
+  // the first item hides the list's label completely
+  steamrot::tests::TestDrawBoxWithBorder(image, style.drop_down_item_style,
+                                         first_item.position, first_item.size,
+                                         true);
+  // and an item's own label is drawn over its box
+  steamrot::tests::TestTextIsPresent(image, second_item.position,
+                                     second_item.size,
+                                     style.drop_down_item_style.text_color);
+}
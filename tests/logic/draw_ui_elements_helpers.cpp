@@ -16,6 +16,33 @@
 
 namespace steamrot::tests {
 
+/////////////////////////////////////////////////
+UIStyle CreateTestUIStyle() {
+  UIStyle style;
+  style.panel_style.border_thickness = 1.f;
+  style.panel_style.inner_margin = {10.f, 10.f};
+  style.panel_style.border_color = sf::Color::White;
+  style.panel_style.background_color = sf::Color::Green;
+  style.button_style.border_thickness = 1.f;
+  style.button_style.border_color = sf::Color::White;
+  style.button_style.background_color = sf::Color::Blue;
+  style.button_style.hover_color = sf::Color::Red;
+  style.drop_down_button_style.border_thickness = 1.f;
+  style.drop_down_button_style.inner_margin = {2.f, 2.f};
+  return style;
+}
+
+/////////////////////////////////////////////////
+std::unique_ptr<PanelElement> CreateTestPanelWithTwoButtons() {
+  auto panel = std::make_unique<PanelElement>();
+  panel->size = {222.f, 232.f};
+  panel->layout = LayoutType::LayoutType_Vertical;
+  panel->children_active = true;
+  panel->AddChildElement(std::make_unique<ButtonElement>());
+  panel->AddChildElement(std::make_unique<ButtonElement>());
+  return panel;
+}
+
 /////////////////////////////////////////////////
 void TestDrawBoxWithBorder(const sf::Image &image, const Style &base_style,
                            const sf::Vector2f &position,
@@ -13,9 +13,21 @@
 #include "UIStyle.h"
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <memory>
 namespace steamrot::tests {
 
+/////////////////////////////////////////////////
+/// @brief UIStyle with 1 pixel borders, 10 pixel panel margins and a distinct
+/// colour for each box, for tests that do not load assets
+/////////////////////////////////////////////////
 UIStyle CreateTestUIStyle();
+
+/////////////////////////////////////////////////
+/// @brief Vertical 222 x 232 panel holding two buttons, laid out with
+/// CreateTestUIStyle they sit at (11, 11) and (11, 121), both 200 x 100
+/////////////////////////////////////////////////
+std::unique_ptr<PanelElement> CreateTestPanelWithTwoButtons();
+
 /////////////////////////////////////////////////
 /// @brief Test that drawing a box with a border produces the correct pixels
 ///
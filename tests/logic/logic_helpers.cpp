@@ -110,4 +110,35 @@ void CheckStaticLogicCollections(const steamrot::LogicCollection &collection,
   }
   }
 }
+
+/////////////////////////////////////////////////
+void CheckStaticLogicSchedules(const steamrot::SceneLogicSchedules &schedules,
+                               const steamrot::SceneType &scene_type) {
+
+  const std::vector<steamrot::Logic *> &update_order =
+      schedules.update_schedule.GetExecutionOrder();
+  const std::vector<steamrot::Logic *> &render_order =
+      schedules.render_schedule.GetExecutionOrder();
+
+  // every scene updates its UI the same way
+  REQUIRE(update_order.size() == 3);
+
+  switch (scene_type) {
+  case steamrot::SceneType::SceneType_TEST:
+  case steamrot::SceneType::SceneType_TITLE: {
+    REQUIRE(render_order.size() == 1);
+    break;
+  }
+  case steamrot::SceneType::SceneType_CRAFTING: {
+    REQUIRE(render_order.size() == 2);
+    break;
+  }
+  default: {
+    FAIL("Unhandled SceneType in CheckStaticLogicSchedules");
+  }
+  }
+
+  // the UI is always drawn last, over anything else in the scene
+  REQUIRE(dynamic_cast<steamrot::UIRenderLogic *>(render_order.back()));
+}
 } // namespace steamrot::tests
@@ -25,4 +25,13 @@ namespace steamrot::tests {
 /////////////////////////////////////////////////
 void CheckStaticLogicCollections(const steamrot::LogicCollection &collection,
                                  const steamrot::SceneType &scene_type);
+
+/////////////////////////////////////////////////
+/// @brief Checks the LogicSchedules built for each Scene Type
+///
+/// @param schedules SceneLogicSchedules to check
+/// @param scene_type Scene Type to check against
+/////////////////////////////////////////////////
+void CheckStaticLogicSchedules(const steamrot::SceneLogicSchedules &schedules,
+                               const steamrot::SceneType &scene_type);
 } // namespace steamrot::tests
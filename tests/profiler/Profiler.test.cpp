@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the Profiler class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "Profiler.h"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST_CASE("Profiler aggregates ScopedZones per frame", "[Profiler]") {
+
+  steamrot::Profiler::Reset();
+
+  for (int i = 0; i < 3; ++i) {
+    steamrot::ScopedZone zone{"Profiler.test::Loop"};
+  }
+  {
+    steamrot::ScopedZone zone{"Profiler.test::Once"};
+  }
+
+  steamrot::Profiler::EndFrame();
+  const auto &stats = steamrot::Profiler::GetFrameStats();
+
+  REQUIRE(stats.size() == 2);
+  const steamrot::ZoneStats &loop_stats = stats.at("Profiler.test::Loop");
+  REQUIRE(loop_stats.call_count == 3);
+  REQUIRE(loop_stats.total_ns >= loop_stats.max_ns);
+  REQUIRE(stats.at("Profiler.test::Once").call_count == 1);
+
+  // the next frame only holds zones recorded after EndFrame
+  steamrot::Profiler::EndFrame();
+  REQUIRE(steamrot::Profiler::GetFrameStats().empty());
+}
+
+TEST_CASE("Profiler collects zones from other threads", "[Profiler]") {
+
+  steamrot::Profiler::Reset();
+
+  std::thread worker(
+      []() { steamrot::ScopedZone zone{"Profiler.test::Worker"}; });
+  worker.join();
+  {
+    steamrot::ScopedZone zone{"Profiler.test::Main"};
+  }
+
+  steamrot::Profiler::BeginCapture();
+  steamrot::Profiler::EndFrame();
+  steamrot::Profiler::EndCapture();
+
+  const auto &events = steamrot::Profiler::GetTraceEvents();
+  REQUIRE(events.size() == 2);
+  REQUIRE(events[0].thread_id != events[1].thread_id);
+}
+
+TEST_CASE("Profiler writes captured zones as a Chrome trace", "[Profiler]") {
+
+  steamrot::Profiler::Reset();
+
+  // zones are only kept for the trace while capturing
+  {
+    steamrot::ScopedZone zone{"Profiler.test::Ignored"};
+  }
+  steamrot::Profiler::EndFrame();
+
+  steamrot::Profiler::BeginCapture();
+  {
+    steamrot::ScopedZone zone{"Profiler.test::\"Quoted\""};
+  }
+  steamrot::Profiler::EndFrame();
+  steamrot::Profiler::EndCapture();
+
+  const std::filesystem::path trace_path =
+      std::filesystem::temp_directory_path() / "steamrot_profiler_test.json";
+  auto write_result = steamrot::Profiler::WriteChromeTrace(trace_path);
+  REQUIRE(write_result.has_value());
+
+  std::ifstream trace_file(trace_path);
+  std::stringstream trace_stream;
+  trace_stream << trace_file.rdbuf();
+  const std::string trace = trace_stream.str();
+
+  REQUIRE(trace.starts_with("{\"traceEvents\":[{"));
+  REQUIRE(trace.find("\"name\":\"Profiler.test::\\\"Quoted\\\"\"") !=
+          std::string::npos);
+  REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+  REQUIRE(trace.find("Ignored") == std::string::npos);
+
+  std::filesystem::remove(trace_path);
+}
+
+TEST_CASE("Profiler fails to write a trace to a missing directory",
+          "[Profiler]") {
+
+  auto write_result = steamrot::Profiler::WriteChromeTrace(
+      std::filesystem::temp_directory_path() / "steamrot_missing_dir" /
+      "trace.json");
+  REQUIRE_FALSE(write_result.has_value());
+  REQUIRE(write_result.error().mode == steamrot::FailMode::WriteFailure);
+}
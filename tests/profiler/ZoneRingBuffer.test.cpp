@@ -0,0 +1,50 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the ZoneRingBuffer class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ZoneRingBuffer.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("ZoneRingBuffer drains zones in the order they were pushed",
+          "[ZoneRingBuffer]") {
+
+  steamrot::ZoneRingBuffer buffer(3, 8);
+  REQUIRE(buffer.GetThreadID() == 3);
+
+  buffer.Push({"first", 10, 1});
+  buffer.Push({"second", 20, 2});
+
+  std::vector<steamrot::ProfileZone> zones;
+  REQUIRE(buffer.Drain(zones) == 0);
+  REQUIRE(zones.size() == 2);
+  REQUIRE(std::string_view(zones[0].name) == "first");
+  REQUIRE(zones[1].start_ns == 20);
+  REQUIRE(zones[1].duration_ns == 2);
+
+  // drained zones are not handed out twice
+  zones.clear();
+  REQUIRE(buffer.Drain(zones) == 0);
+  REQUIRE(zones.empty());
+}
+
+TEST_CASE("ZoneRingBuffer drops the oldest zones when lapped",
+          "[ZoneRingBuffer]") {
+
+  steamrot::ZoneRingBuffer buffer(0, 4);
+  for (uint64_t i = 0; i < 10; ++i) {
+    buffer.Push({"zone", i, 0});
+  }
+
+  std::vector<steamrot::ProfileZone> zones;
+  REQUIRE(buffer.Drain(zones) == 6);
+  REQUIRE(zones.size() == 4);
+  for (size_t i = 0; i < zones.size(); ++i) {
+    REQUIRE(zones[i].start_ns == 6 + i);
+  }
+}
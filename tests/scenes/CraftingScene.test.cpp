@@ -29,17 +29,9 @@ TEST_CASE("CraftingScene's call to sRender is correct", "[CraftingScene]") {
   if (!configure_result.has_value()) {
     FAIL("Scene configuration failed: " + configure_result.error().message);
   }
-  // add the LogicMap
-  steamrot::LogicFactory logic_factory(steamrot::SceneType::SceneType_CRAFTING,
-                                       crafting_scene->GetLogicContext());
-  auto create_map_result = logic_factory.CreateLogicMap();
-  if (!create_map_result) {
-    FAIL("Logic map creation failed: " + create_map_result.error().message);
-  }
-  // pass the created logic map to the scene
-  crafting_scene->SetLogicMap(std::move(create_map_result.value()));
   // call sRender
   REQUIRE_NOTHROW(crafting_scene->sRender());
+
   // evaluate render texture visually
   steamrot::tests::DisplayRenderTexture(crafting_scene->GetRenderTexture());
 }
@@ -95,9 +95,8 @@ TEST_CASE("SceneManager::ConfigureSubscribersFromData configures subscribers",
   }
   const steamrot::SceneManagerData *sm_data = load_sm_data_result.value();
   // check that the EventHandler subscriptions are empty
-  REQUIRE(test_context.GetGameContext()
-              .event_handler.GetSubcriberRegister()
-              .empty());
+  REQUIRE(test_context.GetGameContext().event_handler.GetSubscriberCount() ==
+          0);
   // Configure subscribers from data
   auto configure_result =
       scene_manager.ConfigureSubscribersFromData(sm_data->subscriptions());
@@ -108,9 +107,8 @@ TEST_CASE("SceneManager::ConfigureSubscribersFromData configures subscribers",
   // Check that the correct number of subscribers were added
   REQUIRE(scene_manager.GetSubscriptions().size() ==
           sm_data->subscriptions()->size());
-  REQUIRE(test_context.GetGameContext()
-              .event_handler.GetSubcriberRegister()
-              .size() == sm_data->subscriptions()->size());
+  REQUIRE(test_context.GetGameContext().event_handler.GetSubscriberCount() ==
+          sm_data->subscriptions()->size());
 
   // Check that specific subscribers were added using contains
   REQUIRE(scene_manager.GetSubscriptions().contains(
@@ -33,18 +33,7 @@ TEST_CASE("TitleScene's call of sRender is correct", "[TitleScene]") {
   if (!configure_result.has_value()) {
     FAIL("Scene configuration failed: " + configure_result.error().message);
   }
-  // add the LogicMap
-  steamrot::LogicFactory logic_factory(steamrot::SceneType::SceneType_TITLE,
-                                       title_scene->GetLogicContext());
-
-  auto create_map_result = logic_factory.CreateLogicMap();
-  if (!create_map_result) {
-    FAIL("Logic map creation failed: " + create_map_result.error().message);
-  }
-  // pass the created logic map to the scene
-  title_scene->SetLogicMap(std::move(create_map_result.value()));
   // call sRender
-
   REQUIRE_NOTHROW(title_scene->sRender());
 
   // evaluate render texture visually
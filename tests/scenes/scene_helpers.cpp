@@ -38,7 +38,7 @@ void CheckDefaultSceneConfiguration(const Scene &scene) {
   TestArchetypesOfConfiguredEMPfromDefaultData(scene.GetArchetypes(),
                                                scene_type);
 
-  // check logic map default configuration
-  CheckStaticLogicCollections(scene.GetLogicMap(), scene_type);
+  // check logic schedules default configuration
+  CheckStaticLogicSchedules(scene.GetLogicSchedules(), scene_type);
 }
 } // namespace steamrot::tests
@@ -14,6 +14,7 @@
 #include <SFML/Window/Mouse.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
+#include <chrono>
 
 TEST_CASE("GameEngine fails when EnviromentType is None", "[GameEngine]") {
   // Attempt to create a GameEngine instance with EnvironmentType::None
@@ -72,6 +73,43 @@ TEST_CASE("GameEngine runs for a set number of frames in test enviroment",
   SUCCEED("GameEngine ran for the specified number of frames");
 }
 
+TEST_CASE("GameEngine simulation mode is not held to real time",
+          "[GameEngine]") {
+
+  // create and pre-initialize PathProvider
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  // Create a GameEngine instance
+  steamrot::GameEngine game_engine(steamrot::EnvironmentType::Test);
+
+  // run two seconds worth of ticks
+  const size_t tick_count{120};
+  const auto start_time = std::chrono::steady_clock::now();
+  game_engine.RunGame(tick_count, true);
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+  REQUIRE(game_engine.GetLoopNumber() == tick_count);
+  REQUIRE(elapsed_time < game_engine.GetTickDuration() * tick_count);
+}
+
+TEST_CASE("GameEngine runs headless without opening a window",
+          "[GameEngine]") {
+
+  // create and pre-initialize PathProvider
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  // Create a headless GameEngine instance
+  steamrot::GameEngine game_engine(steamrot::EnvironmentType::Test,
+                                   steamrot::DisplayMode::Headless);
+  REQUIRE_FALSE(game_engine.GetWindow().isOpen());
+
+  const size_t tick_count{1000};
+  game_engine.RunGame(tick_count, true);
+
+  REQUIRE(game_engine.GetLoopNumber() == tick_count);
+  REQUIRE(game_engine.IsRunning());
+  REQUIRE(game_engine.GetGameContext().display_mode ==
+          steamrot::DisplayMode::Headless);
+}
+
 TEST_CASE("GameEngine runs for a set number of frames in production enviroment",
           "[GameEngine]") {
 
@@ -88,6 +126,24 @@ TEST_CASE("GameEngine runs for a set number of frames in production enviroment",
   SUCCEED("GameEngine ran for the specified number of frames");
 }
 
+TEST_CASE("GameEngine::RunGameLoop ends when the window is closed",
+          "[GameEngine]") {
+
+  // create and pre-initialize PathProvider
+  steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
+  // Create a GameEngine instance
+  steamrot::GameEngine game_engine(steamrot::EnvironmentType::Test);
+  REQUIRE(game_engine.GetWindow().isOpen());
+
+  // as the close button or Escape would, without a loop limit to fall back on
+  game_engine.GetWindow().close();
+  game_engine.RunGame(0, false);
+
+  // stopped before the first tick
+  REQUIRE_FALSE(game_engine.IsRunning());
+  REQUIRE(game_engine.GetLoopNumber() == 1);
+}
+
 TEST_CASE("GameEngine::RegisterSubscriber adds a subscriber", "[GameEngine]") {
   // create and pre-initialize PathProvider
   steamrot::PathProvider path_provider(steamrot::EnvironmentType::Test);
@@ -181,6 +237,10 @@ TEST_CASE("GameEngine::ConfigureGameEngineFromData configures without errors",
   // Check that the correct number of subscribers were added
   REQUIRE(game_engine.GetSubscriptions().size() ==
           ge_data->subscriptions()->size());
+  // Check that the tick length comes from the tick rate
+  REQUIRE(game_engine.GetTickDuration() ==
+          std::chrono::nanoseconds{std::chrono::seconds(1)} /
+              ge_data->tick_rate());
 }
 
 TEST_CASE("GameEngine::ProcessSubscribers quits game when correct Subscriber "
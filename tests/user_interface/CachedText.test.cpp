@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the CachedText class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "CachedText.h"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("CachedText only rebuilds when its inputs change", "[CachedText]") {
+  steamrot::CachedText cached_text;
+  const sf::FloatRect bounds{{0.f, 0.f}, {100.f, 20.f}};
+
+  REQUIRE(cached_text.GetVersion() == 0);
+
+  REQUIRE(cached_text.Update("label", nullptr, 12, bounds, sf::Color::White));
+  const uint64_t first_version = cached_text.GetVersion();
+  REQUIRE(first_version != 0);
+
+  // nothing changed
+  REQUIRE_FALSE(
+      cached_text.Update("label", nullptr, 12, bounds, sf::Color::White));
+  REQUIRE(cached_text.GetVersion() == first_version);
+
+  // each input causes a rebuild
+  REQUIRE(cached_text.Update("other", nullptr, 12, bounds, sf::Color::White));
+  REQUIRE(cached_text.Update("other", nullptr, 14, bounds, sf::Color::White));
+  REQUIRE(cached_text.Update("other", nullptr, 14, {{5.f, 0.f}, {100.f, 20.f}},
+                             sf::Color::White));
+  REQUIRE(cached_text.Update("other", nullptr, 14, {{5.f, 0.f}, {100.f, 20.f}},
+                             sf::Color::Red));
+  REQUIRE(cached_text.GetVersion() != first_version);
+}
+
+TEST_CASE("CachedText without a font has nothing to draw", "[CachedText]") {
+  steamrot::CachedText cached_text;
+  cached_text.Update("label", nullptr, 12, {{0.f, 0.f}, {100.f, 20.f}},
+                     sf::Color::White);
+
+  REQUIRE(cached_text.GetVertices().empty());
+  REQUIRE(cached_text.GetTexture() == nullptr);
+}
+
+TEST_CASE("CachedText versions are not shared between instances",
+          "[CachedText]") {
+  const sf::FloatRect bounds{{0.f, 0.f}, {100.f, 20.f}};
+
+  steamrot::CachedText first;
+  steamrot::CachedText second;
+  first.Update("label", nullptr, 12, bounds, sf::Color::White);
+  second.Update("label", nullptr, 12, bounds, sf::Color::White);
+
+  REQUIRE(first.GetVersion() != second.GetVersion());
+}
@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the UIBatch class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIBatch.h"
+#include "ButtonElement.h"
+#include "DropDownButtonElement.h"
+#include "PanelElement.h"
+#include "UIStyle.h"
+#include "draw_ui_elements.h"
+#include "draw_ui_elements_helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+constexpr size_t kBoxVertices =
+    steamrot::draw_ui_elements::kBorderAndBackgroundVertexCount;
+
+TEST_CASE("UIBatch writes every element of a tree into one vertex array",
+          "[UIBatch]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.size = {100.f, 100.f};
+  panel.children_active = true;
+  panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+  panel.AddChildElement(std::make_unique<steamrot::DropDownButtonElement>());
+
+  steamrot::UIBatch batch;
+  batch.Update(panel, style);
+
+  REQUIRE(batch.GetVertexCount() == 3 * kBoxVertices + 3);
+  REQUIRE(batch.GetRewrittenCount() == 3);
+}
+
+TEST_CASE("UIBatch only rewrites elements whose drawn state changed",
+          "[UIBatch]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.size = {100.f, 100.f};
+  panel.children_active = true;
+  steamrot::UIElement &button =
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+  auto &dd_button = static_cast<steamrot::DropDownButtonElement &>(
+      panel.AddChildElement(std::make_unique<steamrot::DropDownButtonElement>()));
+
+  steamrot::UIBatch batch;
+  batch.Update(panel, style);
+
+  // nothing changed
+  batch.Update(panel, style);
+  REQUIRE(batch.GetRewrittenCount() == 0);
+
+  // hovering a button changes its colour
+  button.is_mouse_over = true;
+  batch.Update(panel, style);
+  REQUIRE(batch.GetRewrittenCount() == 1);
+
+  // expanding flips the dropdown triangle
+  dd_button.is_expanded = true;
+  batch.Update(panel, style);
+  REQUIRE(batch.GetRewrittenCount() == 1);
+
+  // hiding the children collapses both of them
+  panel.children_active = false;
+  batch.Update(panel, style);
+  REQUIRE(batch.GetRewrittenCount() == 2);
+  REQUIRE(batch.GetVertexCount() == 3 * kBoxVertices + 3);
+
+  // a different style rewrites everything
+  steamrot::UIStyle other_style = steamrot::tests::CreateTestUIStyle();
+  batch.Update(panel, other_style);
+  REQUIRE(batch.GetRewrittenCount() == 3);
+}
+
+TEST_CASE("UIBatch rebuilds when the tree changes shape", "[UIBatch]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.size = {100.f, 100.f};
+  panel.children_active = true;
+  panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+
+  steamrot::UIBatch batch;
+  batch.Update(panel, style);
+  REQUIRE(batch.GetVertexCount() == 2 * kBoxVertices);
+
+  panel.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  batch.Update(panel, style);
+  REQUIRE(batch.GetVertexCount() == 3 * kBoxVertices);
+  REQUIRE(batch.GetRewrittenCount() == 3);
+
+  panel.ClearChildElements();
+  batch.Update(panel, style);
+  REQUIRE(batch.GetVertexCount() == kBoxVertices);
+}
+
+TEST_CASE("Batched buttons use the hover colour", "[UIBatch]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::ButtonElement button;
+  button.size = {50.f, 50.f};
+
+  sf::VertexArray drawn{sf::PrimitiveType::Triangles, kBoxVertices};
+  steamrot::draw_ui_elements::WriteBorderAndBackground(&drawn[0], button,
+                                                       style.button_style);
+  REQUIRE(drawn[0].color == sf::Color::Blue);
+
+  button.is_mouse_over = true;
+  steamrot::draw_ui_elements::WriteBorderAndBackground(&drawn[0], button,
+                                                       style.button_style);
+  REQUIRE(drawn[0].color == sf::Color::Red);
+  REQUIRE(drawn[6].color == style.button_style.border_color);
+}
+
+TEST_CASE("UIBatch reports whether the last Update changed anything",
+          "[UIBatch]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.position = {10.f, 20.f};
+  panel.size = {100.f, 100.f};
+  panel.children_active = true;
+  steamrot::UIElement &button =
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+  button.position = {100.f, 110.f};
+  button.size = {50.f, 50.f};
+
+  steamrot::UIBatch batch;
+  batch.Update(panel, style);
+  REQUIRE(batch.HasChanged());
+
+  // bounds enclose every visible element
+  REQUIRE(batch.GetBounds() ==
+          sf::FloatRect{{10.f, 20.f}, {140.f, 140.f}});
+
+  batch.Update(panel, style);
+  REQUIRE_FALSE(batch.HasChanged());
+
+  // hiding the button changes what is drawn and shrinks the bounds
+  panel.children_active = false;
+  batch.Update(panel, style);
+  REQUIRE(batch.HasChanged());
+  REQUIRE(batch.GetBounds() ==
+          sf::FloatRect{{10.f, 20.f}, {100.f, 100.f}});
+}
@@ -42,8 +42,7 @@ TEST_CASE("UIElementFactory::CreateUIElement - Panel", "[UIElementFactory]") {
   steamrot::tests::TestContext test_context;
   // check that the map from the EventHandler is empty
   REQUIRE(test_context.GetGameContext()
-              .event_handler.GetSubcriberRegister()
-              .size() == 0);
+              .event_handler.GetSubscriberCount() == 0);
 
   flatbuffers::FlatBufferBuilder builder{1024};
   const auto *panel_data =
@@ -59,8 +58,7 @@ TEST_CASE("UIElementFactory::CreateUIElement - Panel", "[UIElementFactory]") {
   }
   // assert
   REQUIRE(test_context.GetGameContext()
-              .event_handler.GetSubcriberRegister()
-              .size() == 1);
+              .event_handler.GetSubscriberCount() == 1);
 
   // pull out as PanelElement
   auto panel_element =
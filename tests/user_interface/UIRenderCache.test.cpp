@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the UIRenderCache class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UIRenderCache.h"
+#include "ButtonElement.h"
+#include "PanelElement.h"
+#include "UIBatch.h"
+#include "UIStyle.h"
+#include "draw_ui_elements_helpers.h"
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+TEST_CASE("UIRenderCache only redraws a tree when it changes",
+          "[UIRenderCache]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.position = {10.f, 10.f};
+  panel.size = {60.f, 60.f};
+  panel.children_active = true;
+  steamrot::UIElement &button =
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+  button.position = {20.f, 20.f};
+  button.size = {20.f, 20.f};
+
+  sf::RenderTexture render_texture{sf::Vector2u{100, 100}};
+  steamrot::UIBatch batch;
+  steamrot::UIRenderCache cache;
+
+  batch.Update(panel, style);
+  cache.Draw(render_texture, batch);
+  REQUIRE(cache.GetRedrawCount() == 1);
+
+  // an unchanged tree is composited from the cache
+  batch.Update(panel, style);
+  cache.Draw(render_texture, batch);
+  REQUIRE(cache.GetRedrawCount() == 1);
+
+  // hovering changes the tree
+  button.is_mouse_over = true;
+  batch.Update(panel, style);
+  cache.Draw(render_texture, batch);
+  REQUIRE(cache.GetRedrawCount() == 2);
+
+  // invalidating forces a redraw
+  cache.Invalidate();
+  batch.Update(panel, style);
+  cache.Draw(render_texture, batch);
+  REQUIRE(cache.GetRedrawCount() == 3);
+}
+
+TEST_CASE("UIRenderCache draws the same pixels as the batch",
+          "[UIRenderCache]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.position = {10.f, 10.f};
+  panel.size = {60.f, 60.f};
+  panel.children_active = true;
+  steamrot::UIElement &button =
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+  button.position = {20.f, 20.f};
+  button.size = {20.f, 20.f};
+
+  steamrot::UIBatch batch;
+  batch.Update(panel, style);
+
+  sf::RenderTexture direct_texture{sf::Vector2u{100, 100}};
+  direct_texture.clear(sf::Color::Black);
+  batch.Draw(direct_texture);
+  direct_texture.display();
+
+  // draw twice so the second frame comes from the cache
+  steamrot::UIRenderCache cache;
+  sf::RenderTexture cached_texture{sf::Vector2u{100, 100}};
+  cache.Draw(cached_texture, batch);
+  batch.Update(panel, style);
+  cached_texture.clear(sf::Color::Black);
+  cache.Draw(cached_texture, batch);
+  cached_texture.display();
+  REQUIRE(cache.GetRedrawCount() == 1);
+
+  const sf::Image direct = direct_texture.getTexture().copyToImage();
+  const sf::Image cached = cached_texture.getTexture().copyToImage();
+  for (unsigned int x = 0; x < 100; x++) {
+    for (unsigned int y = 0; y < 100; y++) {
+      REQUIRE(cached.getPixel({x, y}) == direct.getPixel({x, y}));
+    }
+  }
+  REQUIRE(cached.getPixel({50, 50}) == sf::Color::Green);
+  REQUIRE(cached.getPixel({30, 30}) == sf::Color::Blue);
+  REQUIRE(cached.getPixel({5, 5}) == sf::Color::Black);
+}
@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the UISpatialIndex class
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "UISpatialIndex.h"
+#include "ButtonElement.h"
+#include "DropDownItemElement.h"
+#include "DropDownListElement.h"
+#include "PanelElement.h"
+#include "UIStyle.h"
+#include "draw_ui_elements_helpers.h"
+#include "ui_layout.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+TEST_CASE("UISpatialIndex finds the topmost visible element",
+          "[UISpatialIndex]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  // two buttons at (11, 11) and (11, 121), both 200 x 100
+  auto panel_ptr = steamrot::tests::CreateTestPanelWithTwoButtons();
+  steamrot::PanelElement &panel = *panel_ptr;
+  steamrot::UIElement &top = *panel.child_elements[0];
+  steamrot::UIElement &bottom = *panel.child_elements[1];
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+
+  steamrot::UISpatialIndex index;
+  REQUIRE(index.Update({&panel}));
+  REQUIRE(index.GetElements().size() == 3);
+
+  // children are drawn over their parent
+  REQUIRE(index.FindTopmostElementAt({50.f, 50.f}) == &top);
+  REQUIRE(index.FindTopmostElementAt({50.f, 150.f}) == &bottom);
+
+  // the gap between the buttons is only the panel
+  REQUIRE(index.FindTopmostElementAt({50.f, 115.f}) == &panel);
+
+  // outside everything
+  REQUIRE(index.FindTopmostElementAt({500.f, 500.f}) == nullptr);
+
+  // hidden children cannot be hit, and hiding them needs no rebuild
+  panel.children_active = false;
+  REQUIRE_FALSE(index.Update({&panel}));
+  REQUIRE(index.FindTopmostElementAt({50.f, 50.f}) == &panel);
+}
+
+TEST_CASE("UISpatialIndex puts dropdown items over a later sibling",
+          "[UISpatialIndex]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  // a list at (11, 11) and a button at (11, 121), both 200 x 100
+  steamrot::PanelElement panel;
+  panel.size = {222.f, 232.f};
+  panel.children_active = true;
+  auto &dd_list = static_cast<steamrot::DropDownListElement &>(
+      panel.AddChildElement(std::make_unique<steamrot::DropDownListElement>()));
+  steamrot::UIElement &button =
+      panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+
+  // expanded items stack down past the list, the second over the button
+  dd_list.layout = steamrot::LayoutType::LayoutType_DropDown;
+  dd_list.is_expanded = true;
+  dd_list.children_active = true;
+  dd_list.AddChildElement(std::make_unique<steamrot::DropDownItemElement>());
+  steamrot::UIElement &second_item = dd_list.AddChildElement(
+      std::make_unique<steamrot::DropDownItemElement>());
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(second_item.position.y + second_item.size.y > button.position.y);
+
+  steamrot::UISpatialIndex index;
+  index.Update({&panel});
+
+  // the items are drawn a depth below the button, so on top of it
+  REQUIRE(index.FindTopmostElementAt({50.f, 150.f}) == &second_item);
+  REQUIRE(index.FindTopmostElementAt({50.f, 215.f}) == &button);
+
+  // collapsed, the button can be hit again
+  dd_list.children_active = false;
+  REQUIRE(index.FindTopmostElementAt({50.f, 150.f}) == &button);
+}
+
+TEST_CASE("UISpatialIndex prefers the tree drawn last", "[UISpatialIndex]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement below;
+  below.size = {100.f, 100.f};
+  steamrot::PanelElement above;
+  above.SetPosition({50.f, 50.f});
+  above.size = {100.f, 100.f};
+  steamrot::ui_layout::LayOutUIElements(below, style);
+  steamrot::ui_layout::LayOutUIElements(above, style);
+
+  steamrot::UISpatialIndex index;
+  index.Update({&below, &above});
+  REQUIRE(index.FindTopmostElementAt({75.f, 75.f}) == &above);
+  REQUIRE(index.FindTopmostElementAt({25.f, 25.f}) == &below);
+
+  // swapping the draw order swaps the result
+  REQUIRE(index.Update({&above, &below}));
+  REQUIRE(index.FindTopmostElementAt({75.f, 75.f}) == &below);
+}
+
+TEST_CASE("UISpatialIndex rebuilds only after the layout changes",
+          "[UISpatialIndex]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  auto panel_ptr = steamrot::tests::CreateTestPanelWithTwoButtons();
+  steamrot::PanelElement &panel = *panel_ptr;
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+
+  steamrot::UISpatialIndex index;
+  REQUIRE(index.Update({&panel}));
+
+  // nothing was laid out
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE_FALSE(index.Update({&panel}));
+
+  // moving the panel moves the buttons with it
+  panel.SetPosition({300.f, 0.f});
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(index.Update({&panel}));
+  REQUIRE(index.FindTopmostElementAt({50.f, 50.f}) == nullptr);
+  REQUIRE(index.FindTopmostElementAt({350.f, 50.f}) ==
+          panel.child_elements[0].get());
+}
+
+TEST_CASE("UISpatialIndex only tests the elements in the hit cell",
+          "[UISpatialIndex]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  // a row of 50 buttons, each far wider than a cell
+  steamrot::PanelElement panel;
+  panel.size = {10000.f, 100.f};
+  panel.layout = steamrot::LayoutType::LayoutType_Horizontal;
+  panel.children_active = true;
+  for (size_t i = 0; i < 50; i++) {
+    panel.AddChildElement(std::make_unique<steamrot::ButtonElement>());
+  }
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+
+  steamrot::UISpatialIndex index;
+  index.Update({&panel});
+
+  steamrot::UIElement *hit = index.FindTopmostElementAt({5000.f, 50.f});
+  REQUIRE(hit != nullptr);
+  REQUIRE(hit != &panel);
+  REQUIRE(index.GetCandidateCount() <= 3);
+}
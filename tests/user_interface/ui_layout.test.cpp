@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////
+/// @file
+/// @brief Unit tests for the ui_layout namespace
+/////////////////////////////////////////////////
+
+/////////////////////////////////////////////////
+/// Headers
+/////////////////////////////////////////////////
+#include "ui_layout.h"
+#include "PanelElement.h"
+#include "UIStyle.h"
+#include "draw_ui_elements_helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+TEST_CASE("LayOutUIElements positions children and clears dirty flags",
+          "[ui_layout]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  auto panel_ptr = steamrot::tests::CreateTestPanelWithTwoButtons();
+  steamrot::PanelElement &panel = *panel_ptr;
+  steamrot::UIElement &top = *panel.child_elements[0];
+  steamrot::UIElement &bottom = *panel.child_elements[1];
+
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+
+  // 232 high less borders and margins is 210, less one gap is 200
+  REQUIRE(top.position == sf::Vector2f{11.f, 11.f});
+  REQUIRE(top.size == sf::Vector2f{200.f, 100.f});
+  REQUIRE(bottom.position == sf::Vector2f{11.f, 121.f});
+  REQUIRE(bottom.size == sf::Vector2f{200.f, 100.f});
+  REQUIRE(top.parent == &panel);
+
+  REQUIRE_FALSE(panel.layout_dirty);
+  REQUIRE_FALSE(panel.descendant_layout_dirty);
+  REQUIRE_FALSE(top.layout_dirty);
+  REQUIRE_FALSE(bottom.descendant_layout_dirty);
+}
+
+TEST_CASE("LayOutUIElements leaves a clean tree alone", "[ui_layout]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.size = {222.f, 232.f};
+  steamrot::UIElement &child =
+      panel.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  const uint64_t layout_generation = panel.layout_generation;
+  REQUIRE(layout_generation != 0);
+
+  // a direct write is not picked up until the element is marked dirty
+  child.position = {500.f, 500.f};
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(child.position == sf::Vector2f{500.f, 500.f});
+  REQUIRE(panel.layout_generation == layout_generation);
+
+  panel.MarkLayoutDirty();
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(child.position == sf::Vector2f{11.f, 11.f});
+  REQUIRE(panel.layout_generation != layout_generation);
+}
+
+TEST_CASE("Changes deep in the tree are propagated up and laid out",
+          "[ui_layout]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.size = {222.f, 232.f};
+  steamrot::UIElement &middle =
+      panel.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  steamrot::UIElement &leaf =
+      middle.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(leaf.size == sf::Vector2f{178.f, 188.f});
+
+  // adding a sibling marks middle dirty and flags the root
+  steamrot::UIElement &sibling =
+      middle.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  REQUIRE(middle.layout_dirty);
+  REQUIRE(panel.descendant_layout_dirty);
+  REQUIRE_FALSE(panel.layout_dirty);
+
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(leaf.size == sf::Vector2f{178.f, 89.f});
+  REQUIRE(sibling.position == sf::Vector2f{22.f, 121.f});
+  REQUIRE_FALSE(panel.descendant_layout_dirty);
+  REQUIRE_FALSE(middle.layout_dirty);
+
+  // resizing the root moves everything below it
+  panel.SetSize({222.f, 132.f});
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+  REQUIRE(middle.size == sf::Vector2f{200.f, 110.f});
+  REQUIRE(leaf.size == sf::Vector2f{178.f, 39.f});
+}
+
+TEST_CASE("LayOutUIElements relays out the tree for a new style",
+          "[ui_layout]") {
+  steamrot::UIStyle style = steamrot::tests::CreateTestUIStyle();
+
+  steamrot::PanelElement panel;
+  panel.size = {222.f, 232.f};
+  steamrot::UIElement &middle =
+      panel.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  steamrot::UIElement &leaf =
+      middle.AddChildElement(std::make_unique<steamrot::PanelElement>());
+  steamrot::ui_layout::LayOutUIElements(panel, style);
+
+  steamrot::UIStyle wider_margins = steamrot::tests::CreateTestUIStyle();
+  wider_margins.panel_style.inner_margin = {20.f, 20.f};
+  steamrot::ui_layout::LayOutUIElements(panel, wider_margins);
+
+  REQUIRE(middle.position == sf::Vector2f{21.f, 21.f});
+  REQUIRE(leaf.position == sf::Vector2f{42.f, 42.f});
+}